@@ -19,6 +19,7 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <chrono>
+#include <iostream>
 #include <string>
 #include <cstdint>
 
@@ -33,9 +34,10 @@ class benchmark
   std::string title_;
   std::string unit_;
   std::chrono::time_point<std::chrono::high_resolution_clock> start_;
+  std::ostream *out_;
 
 public:
-  explicit benchmark (const std::string&, const std::string& = "iB");
+  explicit benchmark (const std::string&, const std::string& = "iB", std::ostream& = std::cout);
   std::uint64_t mtime () const;
   void end (std::uint64_t);
 };
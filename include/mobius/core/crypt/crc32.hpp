@@ -18,11 +18,15 @@
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/bytearray.hpp>
+#include <cstddef>
 #include <cstdint>
 
 namespace mobius::core::crypt
 {
 std::uint32_t crc32 (std::uint32_t, std::uint8_t) noexcept;
+std::uint32_t crc32 (std::uint32_t, const std::uint8_t *, std::size_t) noexcept;
+std::uint32_t crc32 (std::uint32_t, const mobius::core::bytearray&) noexcept;
 
 } // namespace mobius::core::crypt
 
@@ -0,0 +1,82 @@
+#ifndef MOBIUS_CORE_CRYPT_MULTI_HASH_HPP
+#define MOBIUS_CORE_CRYPT_MULTI_HASH_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/bytearray.hpp>
+#include <mobius/core/io/reader.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mobius::core::crypt
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Calculates many hash digests in a single pass over the data
+// @author Eduardo Aguiar
+//
+// Each hash function runs in its own worker thread. Data blocks are shared
+// (not copied) by all workers through a bounded queue, so the caller can
+// read the next block while the previous ones are being hashed. With only
+// one hash type, data is hashed in the calling thread.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class multi_hash
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  using digest_list_type = std::vector <std::pair <std::string, mobius::core::bytearray>>;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit multi_hash (const std::vector <std::string>&);
+  multi_hash (const multi_hash&) noexcept = default;
+  multi_hash (multi_hash&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  multi_hash& operator= (const multi_hash&) noexcept = default;
+  multi_hash& operator= (multi_hash&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void update (const mobius::core::bytearray&);
+  std::uint64_t update (mobius::core::io::reader, std::uint64_t = 65536);
+  void reset ();
+
+  std::vector <std::string> get_types () const;
+  mobius::core::bytearray get_digest (const std::string&) const;
+  digest_list_type get_digests () const;
+
+private:
+  // @brief Implementation class forward declaration
+  class impl;
+
+  // @brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace mobius::core::crypt
+
+#endif
@@ -44,6 +44,10 @@ namespace mobius::core::database
 //
 // 5. Successive calls to pool.get_database from the same thread are guaranteed
 //    to return the same database object.
+//
+// 6. pool.enable_wal switches the database to WAL journal mode. Every
+//    connection created afterwards is configured for WAL, so readers and
+//    writers from different threads do not block each other.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class connection_pool
 {
@@ -66,6 +70,7 @@ public:
   // prototypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   void set_path (const std::string&);
+  void enable_wal ();
   connection acquire ();
   database get_database () const;
   void release ();
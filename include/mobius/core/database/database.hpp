@@ -20,6 +20,8 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/database/statement.hpp>
 #include <mobius/core/database/transaction.hpp>
+#include <mobius/core/io/reader.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -41,6 +43,10 @@ class database
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     database ();
     explicit database (const std::string &);
+    explicit database (
+        const mobius::core::io::reader &,
+        const mobius::core::io::reader & = {}
+    );
     database (const database &) noexcept = default;
     database (database &&) noexcept = default;
 
@@ -67,8 +73,21 @@ class database
     bool has_table (const std::string &) const;
     bool table_has_column (const std::string &, const std::string &) const;
 
+    void enable_wal (std::int64_t = 4000);
+    bool is_wal () const;
+    void checkpoint ();
+
+    void set_statement_cache_size (std::size_t);
+    std::size_t get_statement_cache_size () const;
+    std::uint64_t get_statement_cache_hits () const;
+    std::uint64_t get_statement_cache_misses () const;
+
   private:
     std::shared_ptr<database_impl> impl_;
+
+    // statements return their sqlite3_stmt to the cache on destruction
+    void release_statement (const std::string &, sqlite3_stmt *);
+    friend class statement;
 };
 
 } // namespace mobius::core::database
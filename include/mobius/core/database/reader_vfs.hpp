@@ -0,0 +1,42 @@
+#ifndef MOBIUS_CORE_DATABASE_READER_VFS_HPP
+#define MOBIUS_CORE_DATABASE_READER_VFS_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/io/reader.hpp>
+#include <string>
+
+namespace mobius::core::database
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Read-only sqlite3 VFS over mobius readers
+//
+// Readers are registered under synthetic paths, which can then be opened by
+// sqlite3 using the VFS returned by get_reader_vfs_name (). Pages are served
+// directly from the readers, without extracting data to temporary files.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const char *get_reader_vfs_name ();
+std::string register_reader_vfs_file (
+    const mobius::core::io::reader &,
+    const mobius::core::io::reader & = {}
+);
+void unregister_reader_vfs_file (const std::string &);
+
+} // namespace mobius::core::database
+
+#endif
@@ -42,6 +42,7 @@ public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   statement ();
   statement (database, sqlite3_stmt *);
+  statement (database, sqlite3_stmt *, const std::string&);
   statement (const statement&) noexcept = default;
   statement (statement&&) noexcept = default;
 
@@ -0,0 +1,79 @@
+#ifndef MOBIUS_CORE_DATABASE_WRITE_QUEUE_HPP
+#define MOBIUS_CORE_DATABASE_WRITE_QUEUE_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/database/connection_pool.hpp>
+#include <mobius/core/database/database.hpp>
+#include <functional>
+#include <memory>
+
+namespace mobius::core::database
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Serialized database writer
+// @author Eduardo Aguiar
+//
+// Write tasks are submitted by any thread and run, in submission order, by
+// a single writer thread. The writer thread acquires its own connection from
+// the connection pool, so tasks can use objects that get their database from
+// the pool, such as case items. Pending tasks are grouped in one
+// transaction, each task inside its own savepoint, so a failing task is
+// rolled back alone. Submitting threads never wait for database locks.
+// Call wait to be sure that the tasks have been committed, or use run to
+// submit one task and wait for it.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class write_queue
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  using task_type = std::function <void (database&)>;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit write_queue (const connection_pool&);
+  write_queue (const write_queue&) noexcept = default;
+  write_queue (write_queue&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  write_queue& operator= (const write_queue&) noexcept = default;
+  write_queue& operator= (write_queue&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void submit (task_type);
+  void run (task_type);
+  void wait ();
+
+private:
+  // @brief Implementation class forward declaration
+  class impl;
+
+  // @brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace mobius::core::database
+
+#endif
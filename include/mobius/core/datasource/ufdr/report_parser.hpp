@@ -0,0 +1,88 @@
+#ifndef MOBIUS_CORE_DATASOURCE_UFDR_REPORT_PARSER_HPP
+#define MOBIUS_CORE_DATASOURCE_UFDR_REPORT_PARSER_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/datasource/ufdr/extraction.hpp>
+#include <mobius/core/io/reader.hpp>
+#include <mobius/core/pod/map.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace mobius::core::datasource::ufdr
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Cellebrite UFDR report.xml streaming parser
+// @author Eduardo Aguiar
+//
+// report.xml is inflated directly from the UFDR zip file and parsed with
+// libxml2 text reader, one element at a time. Only <file> and <model>
+// subtrees are expanded in memory, so memory use does not depend on the
+// report size. Handlers return true to stop parsing.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class report_parser
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  using element_handler_type = std::function <bool (const std::string&)>;
+  using data_handler_type = std::function <bool (const mobius::core::pod::map&)>;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit report_parser (const mobius::core::io::reader&);
+  report_parser (report_parser&&) noexcept = default;
+  report_parser (const report_parser&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  report_parser& operator= (const report_parser&) noexcept = default;
+  report_parser& operator= (report_parser&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void set_element_start_handler (const element_handler_type&);
+  void set_element_end_handler (const element_handler_type&);
+  void set_tagged_file_handler (const data_handler_type&);
+  void set_model_handler (const data_handler_type&);
+  void run ();
+
+  mobius::core::pod::map get_case_info () const;
+  std::vector <extraction> get_extractions () const;
+  std::int64_t get_model_count () const;
+  std::set <std::string> get_unknown_datatypes () const;
+
+private:
+  // @brief Implementation class forward declaration
+  class impl;
+
+  // @brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace mobius::core::datasource::ufdr
+
+#endif
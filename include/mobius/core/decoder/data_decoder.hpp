@@ -21,12 +21,17 @@
 #include <mobius/core/datetime/datetime.hpp>
 #include <mobius/core/io/reader.hpp>
 #include <string>
+#include <vector>
 
 namespace mobius::core::decoder
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Data decoder class
 // @author Eduardo Aguiar
+//
+// If reader is seekable, small values are decoded from an internal read-ahead
+// buffer, filled with reader.read_at. Reader position is always kept in sync
+// with the decoder, so reader and decoder can be used interchangeably.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class data_decoder
 {
@@ -75,6 +80,10 @@ class data_decoder
     std::uint64_t get_uint64_le ();
     std::uint64_t get_uint64_be ();
 
+    std::vector<std::uint16_t> get_uint16_le_vector (std::size_t);
+    std::vector<std::uint32_t> get_uint32_le_vector (std::size_t);
+    std::vector<std::uint64_t> get_uint64_le_vector (std::size_t);
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Date/time
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -107,7 +116,30 @@ class data_decoder
     std::string get_ipv4 (); //! \deprecated
 
   private:
+    // @brief Reader object
     mobius::core::io::reader in_;
+
+    // @brief Whether read-ahead buffer is used
+    bool is_buffered_ = false;
+
+    // @brief Read-ahead buffer
+    mobius::core::bytearray buffer_;
+
+    // @brief Buffer offset from the start of data
+    size_type buffer_pos_ = 0;
+
+    // @brief Number of valid bytes in buffer
+    size_type buffer_size_ = 0;
+
+    // @brief Number of bytes to read on next buffer fill
+    size_type fill_size_ = 0;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Helper functions
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    const std::uint8_t *_read (size_type);
+    mobius::core::bytearray _read_bytearray (size_type);
+    void _fill_buffer (size_type, size_type);
 };
 
 } // namespace mobius::core::decoder
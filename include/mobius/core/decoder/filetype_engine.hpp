@@ -0,0 +1,122 @@
+#ifndef MOBIUS_CORE_DECODER_FILETYPE_ENGINE_HPP
+#define MOBIUS_CORE_DECODER_FILETYPE_ENGINE_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/bytearray.hpp>
+#include <mobius/core/io/file.hpp>
+#include <mobius/core/io/folder.hpp>
+#include <mobius/core/io/reader.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mobius::core::decoder
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Signature based filetype identification engine
+// @author Eduardo Aguiar
+//
+// Header patterns of all signatures are compiled into a single Aho-Corasick
+// automaton, so the first HEAD_SIZE bytes of a file are scanned once,
+// whatever the number of signatures. A signature matches when all of its
+// header patterns are found at their offsets. Patterns beyond HEAD_SIZE are
+// read directly, only for signatures whose other patterns have matched.
+// Footers are searched in the last TAIL_SIZE bytes and are used to break
+// ties between matching signatures. Signature max_size is used only by the
+// carver, to bound carved files, and never rejects a classification.
+//
+// Files are classified in parallel by a thread pool. When classifying a
+// folder, files sharing the same inode and size are read only once.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class filetype_engine
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constants
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  static constexpr std::int64_t ANY_OFFSET = -1;
+  static constexpr std::uint64_t HEAD_SIZE = 4096;
+  static constexpr std::uint64_t TAIL_SIZE = 1024;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  struct pattern
+  {
+    std::int64_t offset = 0;            // offset or ANY_OFFSET (inside head)
+    std::string bytes;                  // pattern bytes
+  };
+
+  struct signature
+  {
+    std::string type;                   // filetype (e.g. "image.png")
+    std::string extension;              // usual file extension
+    std::vector <pattern> header;       // header patterns (all must match)
+    std::string footer;                 // footer bytes (optional)
+    std::uint64_t max_size = 0;         // max carved size (0 = unknown)
+    int priority = 0;                   // priority among matches
+  };
+
+  using file_type = mobius::core::io::file;
+  using folder_type = mobius::core::io::folder;
+  using file_list_type = std::vector <file_type>;
+  using result_list_type = std::vector <std::pair <file_type, std::string>>;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit filetype_engine (unsigned int = 0);
+  filetype_engine (const std::vector <signature>&, unsigned int = 0);
+  filetype_engine (filetype_engine&&) noexcept = default;
+  filetype_engine (const filetype_engine&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  filetype_engine& operator= (const filetype_engine&) noexcept = default;
+  filetype_engine& operator= (filetype_engine&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void add_signature (const signature&);
+  std::vector <signature> get_signatures () const;
+  unsigned int get_threads () const;
+
+  std::string classify (const mobius::core::bytearray&) const;
+  std::string classify (const mobius::core::io::reader&) const;
+  std::string classify (const file_type&) const;
+  std::vector <std::string> classify (const file_list_type&) const;
+  result_list_type classify (const folder_type&, bool = true) const;
+
+  static std::vector <signature> get_default_signatures ();
+
+private:
+  // @brief Implementation class forward declaration
+  class impl;
+
+  // @brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace mobius::core::decoder
+
+#endif
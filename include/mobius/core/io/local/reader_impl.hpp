@@ -48,7 +48,14 @@ public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Virtual methods
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  mobius::core::bytearray read (size_type) override;
+  mobius::core::bytearray
+  read (size_type size) override
+  {
+    return _read_using_read_into (size);
+  }
+
+  size_type read_into (std::uint8_t *, size_type) override;
+  size_type read_at (size_type, std::uint8_t *, size_type) override;
   void seek (offset_type, whence_type = whence_type::beginning) override;
   offset_type tell () const override;
   bool eof () const override;
@@ -96,6 +103,13 @@ public:
 private:
   std::shared_ptr <FILE> fp_;
   size_type size_;
+
+  // @brief Read position. FILE position is updated only before fread, so
+  // seek and tell do not need to call fseek/ftell
+  size_type pos_ = 0;
+
+  // @brief Current FILE position
+  size_type file_pos_ = 0;
 };
 
 } // namespace mobius::core::io::local
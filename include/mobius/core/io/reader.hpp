@@ -151,6 +151,36 @@ public:
     return impl_->read (size);
   }
 
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // @brief Read bytes from reader into buffer
+  // @param buffer Buffer, with at least size bytes
+  // @param size size in bytes
+  // @return Number of bytes read
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  size_type
+  read_into (std::uint8_t *buffer, size_type size)
+  {
+    return impl_->read_into (buffer, size);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // @brief Read bytes from a given position into buffer
+  // @param offset offset in bytes from the beginning of data
+  // @param buffer Buffer, with at least size bytes
+  // @param size size in bytes
+  // @return Number of bytes read
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  size_type
+  read_at (size_type offset, std::uint8_t *buffer, size_type size)
+  {
+    return impl_->read_at (offset, buffer, size);
+  }
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  mobius::core::bytearray read_at (size_type, size_type);
+
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // @brief Check if end-of-file indicator is set
   // @return true/false
@@ -20,12 +20,23 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/bytearray.hpp>
 #include <cstdint>
+#include <mutex>
 
 namespace mobius::core::io
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Abstract base implementation class for data readers
 // @author Eduardo Aguiar
+//
+// Derived classes must implement <b>read</b>. The default <b>read_into</b>
+// copies data returned by <b>read</b>. Readers that can fill caller's
+// buffers directly should override <b>read_into</b> too, and implement
+// <b>read</b> with <b>_read_using_read_into</b>, so no intermediate
+// bytearray is allocated.
+//
+// Readers that can read from a given position without changing their state
+// (e.g. using pread) should override <b>read_at</b>, so they can be shared by
+// many threads. The default implementation is a locked seek + read_into.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class reader_impl_base
 {
@@ -63,6 +74,8 @@ public:
   virtual offset_type tell () const;
   virtual void seek (offset_type, whence_type = whence_type::beginning);
   virtual size_type get_size () const;
+  virtual size_type read_into (std::uint8_t *, size_type);
+  virtual size_type read_at (size_type, std::uint8_t *, size_type);
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Abstract methods
@@ -119,6 +132,13 @@ public:
   {
     seek (size, whence_type::current);
   }
+
+protected:
+  mobius::core::bytearray _read_using_read_into (size_type);
+
+private:
+  // @brief Serializes default read_at implementation
+  std::mutex read_at_mutex_;
 };
 
 } // namespace mobius::core::io
@@ -95,7 +95,14 @@ public:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Virtual methods
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  bytearray read (size_type) override;
+  mobius::core::bytearray
+  read (size_type size) override
+  {
+    return _read_using_read_into (size);
+  }
+
+  size_type read_into (std::uint8_t *, size_type) override;
+  size_type read_at (size_type, std::uint8_t *, size_type) override;
   void seek (offset_type, whence_type = whence_type::beginning) override;
 
 private:
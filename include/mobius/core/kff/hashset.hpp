@@ -22,7 +22,10 @@
 #include <mobius/core/database/connection.hpp>
 #include <mobius/core/database/statement.hpp>
 #include <mobius/core/database/transaction.hpp>
+#include <mobius/core/io/reader.hpp>
+#include <mobius/core/io/writer.hpp>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -41,6 +44,7 @@ public:
   // Datatypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   using hash_type = std::pair <std::string, std::string>;
+  using progress_callback_type = std::function <void (std::uint64_t, std::uint64_t)>;
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // Constructors
@@ -64,12 +68,15 @@ public:
   void set_description (const std::string&);
   bool is_alert () const;
   std::uint64_t get_size () const;
+  std::uint64_t get_revision () const;
   void create (bool);
   void clear ();
   void add (const std::string&, const std::string&);
   void remove (const std::string&, const std::string&);
   bool lookup (const std::string&, const std::string&) const;
   mobius::core::collection <hash_type> get_hashes () const;
+  std::uint64_t import_hashes (mobius::core::io::reader, const std::string&, const std::string& = {}, const progress_callback_type& = {});
+  std::uint64_t export_hashes (mobius::core::io::writer, const std::string&) const;
 
 
 private:
@@ -20,6 +20,8 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/kff/hashset.hpp>
 #include <mobius/core/database/connection_set.hpp>
+#include <mobius/core/bytearray.hpp>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -56,6 +58,7 @@ public:
   std::vector <std::pair <std::string, hashset>> get_hashsets () const;
   std::vector <std::string> alert_lookup (const std::string&, const std::string&) const;
   char lookup (const std::string&, const std::string&) const;
+  std::vector <char> lookup (const std::string&, std::span <const mobius::core::bytearray>) const;
 };
 
 } // namespace mobius::core::kff
@@ -171,6 +171,8 @@ private:
 // Function prototypes
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void set_logfile_path (const std::string&);
+void set_logfile_level (event::type);
+void flush_log ();
 
 } // namespace mobius::core
 
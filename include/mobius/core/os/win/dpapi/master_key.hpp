@@ -61,6 +61,7 @@ public:
   bool decrypt_with_key (const mobius::core::bytearray&);
   bool decrypt_with_password_hash (const std::string&, const mobius::core::bytearray&);
   bool decrypt_with_password (const std::string&, const std::string&);
+  bool test_password_hash (const std::string&, const mobius::core::bytearray&) const;
   bool is_decrypted () const;
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
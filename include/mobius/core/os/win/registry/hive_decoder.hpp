@@ -120,6 +120,24 @@ struct vk_data
   std::string name;
 };
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Subkeys list entry struct
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct subkey_entry
+{
+  // @brief hint types
+  enum class hint_type { none, name, hash };
+
+  // @brief offset of the subkey (nk) cell
+  std::uint32_t offset;
+
+  // @brief hint type: none (li), first 4 name chars (lf) or name hash (lh)
+  hint_type type = hint_type::none;
+
+  // @brief hint value
+  std::uint32_t hint = 0;
+};
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Windows' registry file decoder
 // @author Eduardo Aguiar
@@ -136,6 +154,7 @@ public:
   header_data decode_header ();
   vk_data decode_vk (offset_type);
   std::vector <offset_type> decode_subkeys_list (offset_type);
+  std::vector <subkey_entry> decode_subkeys_entries (offset_type);
   std::vector <offset_type> decode_values_list (offset_type, std::uint32_t);
   mobius::core::bytearray decode_data (offset_type, std::uint32_t);
   mobius::core::bytearray decode_data_cell (offset_type);
@@ -148,7 +167,7 @@ private:
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   // helper functions
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-  void _retrieve_subkeys (std::vector <offset_type>&, offset_type);
+  void _retrieve_subkeys (std::vector <subkey_entry>&, offset_type);
 
 };
 
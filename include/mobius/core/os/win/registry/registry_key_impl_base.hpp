@@ -54,6 +54,7 @@ public:
   virtual void remove_key (const std::string&) = 0;
   virtual void clear_keys () = 0;
   virtual std::vector <registry_value> get_values () const = 0;
+  virtual registry_key get_key_by_name (const std::string&) const;
 };
 
 } // namespace mobius::core::os::win::registry
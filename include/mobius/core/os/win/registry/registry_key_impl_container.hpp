@@ -153,6 +153,17 @@ public:
     subkeys_.clear ();
   }
 
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // @brief get subkey by name
+  // @param name subkey name
+  // @return subkey or empty key, if not found
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  registry_key
+  get_key_by_name (const std::string& name) const override
+  {
+    return subkeys_.get (name);
+  }
+
 private:
   // @brief key name
   std::string name_;
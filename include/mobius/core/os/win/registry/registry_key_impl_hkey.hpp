@@ -158,6 +158,18 @@ public:
     subkeys_loaded_ = true;
   }
 
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // @brief get subkey by name
+  // @param name subkey name
+  // @return subkey or empty key, if not found
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  registry_key
+  get_key_by_name (const std::string& name) const override
+  {
+    _load_subkeys ();
+    return subkeys_.get (name);
+  }
+
 private:
   // @brief hive key
   hive_key hive_key_;
@@ -149,6 +149,17 @@ public:
     key_.clear_keys ();
   }
 
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // @brief get subkey by name
+  // @param name subkey name
+  // @return subkey or empty key, if not found
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  registry_key
+  get_key_by_name (const std::string& name) const override
+  {
+    return key_.get_key_by_name (name);
+  }
+
 private:
   // @brief key
   registry_key key_;
@@ -20,6 +20,9 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/os/win/registry/registry_key_impl_base.hpp>
 #include <mobius/core/os/win/registry/registry_key.hpp>
+#include <cstddef>
+#include <string>
+#include <unordered_map>
 
 namespace mobius::core::os::win::registry
 {
@@ -101,6 +104,7 @@ public:
   clear ()
   {
     keys_.clear ();
+    _reset_index ();
   }
 
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -111,11 +115,29 @@ public:
   append (registry_key key)
   {
     keys_.push_back (key);
+    _reset_index ();
   }
 
 private:
   // @brief keys
   std::vector <registry_key> keys_;
+
+  // @brief keys index by lowercase name
+  mutable std::unordered_map <std::string, std::size_t> index_;
+
+  // @brief index loaded flag
+  mutable bool index_loaded_ = false;
+
+  // helper functions
+  void _load_index () const;
+
+  // @brief invalidate index
+  void
+  _reset_index ()
+  {
+    index_.clear ();
+    index_loaded_ = false;
+  }
 };
 
 } // namespace mobius::core::os::win::registry
@@ -275,8 +275,8 @@ class data
 std::ostream &operator<< (std::ostream &, const data &);
 bool operator== (const data &, const data &);
 bool operator!= (const data &, const data &);
-mobius::core::bytearray serialize (const data &);
-void serialize (mobius::core::io::writer, const data &);
+mobius::core::bytearray serialize (const data &, std::uint32_t = 1);
+void serialize (mobius::core::io::writer, const data &, std::uint32_t = 1);
 data unserialize (const mobius::core::bytearray &);
 data unserialize (mobius::core::io::reader);
 
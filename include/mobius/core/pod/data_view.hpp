@@ -0,0 +1,96 @@
+#ifndef MOBIUS_CORE_POD_DATA_VIEW_HPP
+#define MOBIUS_CORE_POD_DATA_VIEW_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/bytearray.hpp>
+#include <mobius/core/pod/data.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mobius::core::pod
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read-only view of serialized data
+// @author Eduardo Aguiar
+//
+// Navigates serialized data (versions 1 and 2) in place. Map and list
+// items are located by skipping over their siblings, so reading one key
+// does not build the whole data tree. Child views share the same buffer.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class data_view
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit data_view (const mobius::core::bytearray &);
+    data_view () noexcept = default;
+    data_view (data_view &&) noexcept = default;
+    data_view (const data_view &) noexcept = default;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    data_view &operator= (const data_view &) noexcept = default;
+    data_view &operator= (data_view &&) noexcept = default;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Function prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint32_t get_version () const;
+    data::type get_type () const;
+    std::uint64_t get_size () const;
+
+    bool has_key (const std::string &) const;
+    std::vector<std::string> get_keys () const;
+    data_view get_view (const std::string &) const;
+    data_view get_view (std::uint64_t) const;
+    data get (const std::string &, const data & = {}) const;
+
+    data get_data () const;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Check if object is valid
+    // @return true/false
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit
+    operator bool () const noexcept
+    {
+        return bool (impl_);
+    }
+
+  private:
+    // @brief Implementation class forward declaration
+    class impl;
+
+    // @brief Implementation pointer (shared buffer)
+    std::shared_ptr<const impl> impl_;
+
+    // @brief Value offset into buffer
+    std::uint64_t pos_ = 0;
+
+    // Helper functions
+    data_view (const std::shared_ptr<const impl> &, std::uint64_t);
+};
+
+} // namespace mobius::core::pod
+
+#endif
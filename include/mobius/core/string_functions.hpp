@@ -87,6 +87,7 @@ bool startswith (const std::string&, const std::string&);
 bool endswith (const std::string&, const std::string&);
 bool fnmatch (const std::string&, const std::string&);
 bool case_insensitive_fnmatch (const std::string&, const std::string&);
+bool has_wildcards (const std::string&);
 bool case_insensitive_match (const std::string&, const std::string&);
 bool case_sensitive_match (const std::string&, const std::string&);
 
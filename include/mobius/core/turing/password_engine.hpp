@@ -0,0 +1,99 @@
+#ifndef MOBIUS_CORE_TURING_PASSWORD_ENGINE_HPP
+#define MOBIUS_CORE_TURING_PASSWORD_ENGINE_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/bytearray.hpp>
+#include <mobius/core/io/reader.hpp>
+#include <mobius/core/os/win/dpapi/master_key.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace mobius::core::turing
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Password testing engine
+// @author Eduardo Aguiar
+//
+// Candidate passwords are tested against password hashes (nt, lm, msdcc1,
+// msdcc2, sha1.utf16) and DPAPI master keys. Candidates are split in
+// batches and each batch is tested by a worker thread. Hashes common to
+// all targets are computed once per candidate. Hits are reported through
+// the hit callback, always from the calling thread, after each round of
+// batches. Targets are tested until a password is found for them.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class password_engine
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  struct hit
+  {
+    std::string id;             // target ID
+    std::string type;           // hash type or "dpapi.mk"
+    std::string password;       // password found
+  };
+
+  using hit_callback_type = std::function <void (const hit&)>;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit password_engine (unsigned int = 0);
+  password_engine (password_engine&&) noexcept = default;
+  password_engine (const password_engine&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  password_engine& operator= (const password_engine&) noexcept = default;
+  password_engine& operator= (password_engine&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void add_hash (const std::string&, const std::string&, const mobius::core::bytearray&, const std::string& = {}, std::uint32_t = 10240);
+  void add_master_key (const std::string&, const mobius::core::os::win::dpapi::master_key&, const std::string&);
+  void set_hit_callback (const hit_callback_type&);
+  void set_batch_size (std::uint32_t);
+
+  std::uint64_t test (const std::vector <std::string>&);
+  std::uint64_t test (const mobius::core::io::reader&, const std::string& = "UTF-8");
+  double benchmark (std::uint64_t = 10000);
+
+  unsigned int get_threads () const;
+  std::uint64_t get_target_count () const;
+  std::uint64_t get_pending_count () const;
+  std::uint64_t get_word_count () const;
+  double get_words_per_second () const;
+
+private:
+  // @brief Implementation class forward declaration
+  class impl;
+
+  // @brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace mobius::core::turing
+
+#endif
@@ -19,6 +19,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/database/transaction.hpp>
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -37,6 +39,7 @@ public:
   // Datatypes
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   using hashlist_type = std::vector <std::tuple <std::string, std::string, std::string>>;
+  using hashkeys_type = std::vector <std::pair <std::string, std::string>>;
 
   enum class pwd_status {
      not_found,		// not set in database
@@ -65,7 +68,9 @@ public:
 
   bool has_hash (const std::string&, const std::string&);
   void set_hash (const std::string&, const std::string&, const std::string&);
+  std::uint64_t set_hashes (const hashlist_type&);
   std::pair <pwd_status, std::string> get_hash_password (const std::string&, const std::string&) const;
+  std::vector <std::pair <pwd_status, std::string>> get_hash_passwords (const hashkeys_type&) const;
   hashlist_type get_hashes () const;
   void remove_hashes ();
 
@@ -0,0 +1,117 @@
+#ifndef MOBIUS_CORE_VFS_CARVER_HPP
+#define MOBIUS_CORE_VFS_CARVER_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/decoder/filetype_engine.hpp>
+#include <mobius/core/io/reader.hpp>
+#include <mobius/core/vfs/block.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mobius::core::vfs
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Signature based file carving engine
+// @author Eduardo Aguiar
+//
+// Data is read sequentially, in chunks, by the calling thread, while worker
+// threads scan previous chunks. Each chunk overlaps the next one by the
+// length of the longest header, so patterns crossing chunk boundaries are
+// found exactly once. Each header and footer is indexed by one of its
+// two-byte windows, and a 64 KiB filter flags the windows in use, so most
+// positions are rejected by a single table lookup, whatever the number of
+// signatures. Positions passing the filter are verified against the
+// patterns sharing that window. Only headers starting at alignment
+// boundaries are considered.
+//
+// Candidates are closed by their footer, by the next header of a signature
+// without footer, or by their signature max size. They are reported through
+// the candidate callback, as soon as they are closed, always from the
+// calling thread, as slices of the carved data.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class carver
+{
+public:
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Datatypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  using signature = mobius::core::decoder::filetype_engine::signature;
+  using range_type = std::pair <std::uint64_t, std::uint64_t>;
+
+  struct candidate
+  {
+    std::string type;                   // filetype (e.g. "image.png")
+    std::string extension;              // usual file extension
+    std::uint64_t offset = 0;           // offset from the start of data
+    std::uint64_t size = 0;             // size in bytes
+    bool has_footer = false;            // true if closed by footer
+    mobius::core::io::reader reader;    // candidate data
+  };
+
+  using candidate_callback_type = std::function <void (const candidate&)>;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Constructors
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  explicit carver (unsigned int = 0);
+  carver (const std::vector <signature>&, unsigned int = 0);
+  carver (carver&&) noexcept = default;
+  carver (const carver&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Operators
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  carver& operator= (const carver&) noexcept = default;
+  carver& operator= (carver&&) noexcept = default;
+
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  // Function prototypes
+  // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+  void set_candidate_callback (const candidate_callback_type&);
+  void set_alignment (std::uint64_t);
+  void set_chunk_size (std::uint64_t);
+
+  std::uint64_t carve (const block&, bool = false);
+  std::uint64_t carve (const mobius::core::io::reader&);
+  std::uint64_t carve (const mobius::core::io::reader&, const std::vector <range_type>&);
+
+  unsigned int get_threads () const;
+  std::uint64_t get_alignment () const;
+  std::uint64_t get_chunk_size () const;
+  std::uint64_t get_signature_count () const;
+  std::uint64_t get_candidate_count () const;
+  std::uint64_t get_bytes_scanned () const;
+  double get_elapsed_time () const;
+  double get_bytes_per_second () const;
+
+private:
+  // @brief Implementation class forward declaration
+  class impl;
+
+  // @brief Implementation pointer
+  std::shared_ptr <impl> impl_;
+};
+
+} // namespace mobius::core::vfs
+
+#endif
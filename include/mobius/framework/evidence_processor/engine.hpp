@@ -52,6 +52,8 @@ class engine
     mobius::framework::model::item get_item () const;
     profile get_profile () const;
     mobius::core::pod::map get_status () const;
+    unsigned int get_threads () const;
+    void set_threads (unsigned int);
 
   private:
     // @brief Implementation class forward declaration
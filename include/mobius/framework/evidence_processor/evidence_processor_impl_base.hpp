@@ -21,6 +21,7 @@
 #include <mobius/core/io/folder.hpp>
 #include <mobius/core/pod/map.hpp>
 #include <mobius/framework/model/evidence.hpp>
+#include <memory>
 
 namespace mobius::framework::evidence_processor
 {
@@ -64,6 +65,32 @@ class evidence_processor_impl_base
         mobius::framework::model::evidence, const std::string &
     ) {};
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Parallel folder traversal
+    //
+    // Thread-safe implementations are split into workers, one per subtree.
+    // Each worker receives folder events for its subtree only, on a pool
+    // thread. After traversal, workers are joined back into the original
+    // implementation, in subtree order, on the engine thread.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+    // @brief Check if implementation supports parallel folder traversal
+    virtual bool
+    is_thread_safe () const
+    {
+        return false;
+    }
+
+    // @brief Create worker to process a subtree
+    virtual std::shared_ptr<evidence_processor_impl_base>
+    new_worker () const
+    {
+        return {};
+    }
+
+    // @brief Merge results collected by a worker
+    virtual void join_worker (evidence_processor_impl_base &) {};
+
     // @brief Get current status
     virtual mobius::core::pod::map
     get_status () const
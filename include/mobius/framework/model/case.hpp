@@ -20,6 +20,7 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/database/connection_pool.hpp>
 #include <mobius/core/database/transaction.hpp>
+#include <mobius/core/database/write_queue.hpp>
 #include <mobius/framework/model/item.hpp>
 #include <mobius/framework/model/evidence.hpp>
 #include <cstdint>
@@ -63,6 +64,8 @@ public:
   mobius::core::database::connection new_connection ();
   mobius::core::database::transaction new_transaction ();
   mobius::core::database::database get_database () const;
+  mobius::core::database::write_queue get_write_queue () const;
+  void enable_wal ();
 
   std::vector <evidence> get_passwords () const;
   std::vector <evidence> get_password_hashes () const;
@@ -26,6 +26,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
 
 namespace mobius::framework::model
 {
@@ -57,10 +58,22 @@ class evidence
         std::string description;
     };
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Evidence data, loaded at once from database
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    struct snapshot
+    {
+        std::map<std::string, mobius::core::pod::data> attributes;
+        std::set<std::string> tags;
+        std::vector<source> sources;
+        std::map<std::string, std::string> hashes;
+    };
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Constructors
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     evidence (item, std::int64_t, const std::string &);
+    evidence (item, std::int64_t, const std::string &, snapshot &&);
     evidence () noexcept = default;
     evidence (evidence &&) noexcept = default;
     evidence (const evidence &) noexcept = default;
@@ -0,0 +1,99 @@
+#ifndef MOBIUS_FRAMEWORK_MODEL_EVIDENCE_BUILDER_HPP
+#define MOBIUS_FRAMEWORK_MODEL_EVIDENCE_BUILDER_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/io/file.hpp>
+#include <mobius/core/io/folder.hpp>
+#include <mobius/core/pod/data.hpp>
+#include <mobius/framework/model/evidence.hpp>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace mobius::framework::model
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Evidence builder
+// @author Eduardo Aguiar
+//
+// Holds evidence type, attributes, tags, sources and hashes in memory, so
+// many evidences can be written at once with item::new_evidences.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class evidence_builder
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit evidence_builder (const std::string &);
+    evidence_builder () noexcept = default;
+    evidence_builder (evidence_builder &&) noexcept = default;
+    evidence_builder (const evidence_builder &) noexcept = default;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    evidence_builder &operator= (const evidence_builder &) noexcept = default;
+    evidence_builder &operator= (evidence_builder &&) noexcept = default;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Function prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::string get_type () const;
+
+    void set_attribute (const std::string &, const mobius::core::pod::data &);
+    void
+    set_attributes (const std::map<std::string, mobius::core::pod::data> &);
+    std::map<std::string, mobius::core::pod::data> get_attributes () const;
+
+    void set_tag (const std::string &);
+    void set_tags (const std::set<std::string> &);
+    std::set<std::string> get_tags () const;
+
+    void add_source (const mobius::core::io::file &);
+    void add_source (const mobius::core::io::folder &);
+    void add_source (const evidence &);
+    std::vector<evidence::source> get_sources () const;
+
+    void add_hash (const std::string &, const std::string &);
+    std::map<std::string, std::string> get_hashes () const;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Check if object is valid
+    // @return true/false
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit
+    operator bool () const noexcept
+    {
+        return bool (impl_);
+    }
+
+  private:
+    // @brief Implementation class forward declaration
+    class impl;
+
+    // @brief Implementation pointer
+    std::shared_ptr<impl> impl_;
+};
+
+} // namespace mobius::framework::model
+
+#endif
@@ -34,6 +34,7 @@ namespace mobius::framework::model
 class ant;
 class Case;
 class evidence;
+class evidence_builder;
 class event;
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -121,6 +122,7 @@ public:
   // Evidences
   // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
   evidence new_evidence (const std::string&);
+  std::vector <evidence> new_evidences (const std::vector <evidence_builder>&);
   evidence add_evidence (const evidence&);
   std::vector <evidence> get_evidences () const;
   std::vector <evidence> get_evidences (const std::string&) const;
@@ -32,6 +32,7 @@
 #include <mobius/core/string_functions.hpp>
 #include <mobius/framework/evidence_flag.hpp>
 #include <mobius/framework/model/evidence.hpp>
+#include <mobius/framework/model/evidence_builder.hpp>
 #include <mobius/framework/utils.hpp>
 #include <iomanip>
 #include <sstream>
@@ -140,6 +141,40 @@ evidence_processor_impl::on_folder_entered (
     _scan_profile (folder);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create worker to scan a subtree
+// @return New worker
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::shared_ptr<
+    mobius::framework::evidence_processor::evidence_processor_impl_base>
+evidence_processor_impl::new_worker () const
+{
+    return std::make_shared<evidence_processor_impl> (
+        item_, mobius::framework::evidence_processor::profile (), mediator_
+    );
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Merge profiles and encryption keys found by a worker
+// @param worker Worker object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+evidence_processor_impl::join_worker (
+    mobius::framework::evidence_processor::evidence_processor_impl_base &worker
+)
+{
+    auto &w = dynamic_cast<evidence_processor_impl &> (worker);
+
+    profiles_.insert (
+        profiles_.end (), w.profiles_.begin (), w.profiles_.end ()
+    );
+
+    encryption_keys_.insert (
+        encryption_keys_.end (), w.encryption_keys_.begin (),
+        w.encryption_keys_.end ()
+    );
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Scan folder for Local State files
 // @param folder Folder to scan
@@ -296,15 +331,30 @@ evidence_processor_impl::on_complete ()
     _save_visited_urls ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create evidences and tell mediator about them
+// @param evidences Evidence builders
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+evidence_processor_impl::_create_evidences (
+    const std::vector<mobius::framework::model::evidence_builder> &evidences
+)
+{
+    for (const auto &e : item_.new_evidences (evidences))
+        mediator_.on_evidence_created (e);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Save app profiles
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
 evidence_processor_impl::_save_app_profiles ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
-        auto e = item_.new_evidence ("app-profile");
+        mobius::framework::model::evidence_builder e ("app-profile");
 
         // Attributes
         e.set_attribute ("app_id", p.get_app_id ());
@@ -337,9 +387,11 @@ evidence_processor_impl::_save_app_profiles ()
         e.set_tag ("app.browser");
         e.add_source (p.get_folder ());
 
-        // Tell mediator about the new evidence
-        mediator_.on_evidence_created (e);
+        // Add evidence to batch
+        evidences.push_back (e);
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -348,11 +400,13 @@ evidence_processor_impl::_save_app_profiles ()
 void
 evidence_processor_impl::_save_autofills ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
         for (const auto &a : p.get_autofill_entries ())
         {
-            auto e = item_.new_evidence ("autofill");
+            mobius::framework::model::evidence_builder e ("autofill");
 
             e.set_attribute ("field_name", a.name);
             e.set_attribute ("app_name", p.get_app_name ());
@@ -376,10 +430,12 @@ evidence_processor_impl::_save_autofills ()
             e.set_tag ("app.browser");
             e.add_source (a.f);
 
-            // Tell mediator about the new evidence
-            mediator_.on_evidence_created (e);
+            // Add evidence to batch
+            evidences.push_back (e);
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -389,11 +445,13 @@ evidence_processor_impl::_save_autofills ()
 void
 evidence_processor_impl::_save_bookmarked_urls ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
         for (const auto &b : p.get_bookmarks ())
         {
-            auto e = item_.new_evidence ("bookmarked-url");
+            mobius::framework::model::evidence_builder e ("bookmarked-url");
             e.set_attribute ("url", b.url);
             e.set_attribute ("app_name", p.get_app_name ());
             e.set_attribute ("app_family", APP_FAMILY);
@@ -413,10 +471,12 @@ evidence_processor_impl::_save_bookmarked_urls ()
             e.set_tag ("app.browser");
             e.add_source (b.f);
 
-            // Tell mediator about the new evidence
-            mediator_.on_evidence_created (e);
+            // Add evidence to batch
+            evidences.push_back (e);
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -425,11 +485,13 @@ evidence_processor_impl::_save_bookmarked_urls ()
 void
 evidence_processor_impl::_save_cookies ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
         for (const auto &c : p.get_cookies ())
         {
-            auto e = item_.new_evidence ("cookie");
+            mobius::framework::model::evidence_builder e ("cookie");
             e.set_attribute ("app_id", p.get_app_id ());
             e.set_attribute ("app_name", p.get_app_name ());
             e.set_attribute ("app_family", APP_FAMILY);
@@ -464,10 +526,12 @@ evidence_processor_impl::_save_cookies ()
             e.set_tag ("app.browser");
             e.add_source (c.f);
 
-            // Tell mediator about the new evidence
-            mediator_.on_evidence_created (e);
+            // Add evidence to batch
+            evidences.push_back (e);
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -476,11 +540,13 @@ evidence_processor_impl::_save_cookies ()
 void
 evidence_processor_impl::_save_credit_cards ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
         for (const auto &cc : p.get_credit_cards ())
         {
-            auto e = item_.new_evidence ("credit-card");
+            mobius::framework::model::evidence_builder e ("credit-card");
             e.set_attribute ("app_id", p.get_app_id ());
             e.set_attribute ("app_name", p.get_app_name ());
             e.set_attribute ("username", p.get_username ());
@@ -528,10 +594,12 @@ evidence_processor_impl::_save_credit_cards ()
             e.set_tag ("app.browser");
             e.add_source (cc.f);
 
-            // Tell mediator about the new evidence
-            mediator_.on_evidence_created (e);
+            // Add evidence to batch
+            evidences.push_back (e);
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -540,6 +608,8 @@ evidence_processor_impl::_save_credit_cards ()
 void
 evidence_processor_impl::_save_encryption_keys ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &ek : encryption_keys_)
     {
         const auto [app_id, app_name] = get_app_from_path (ek.f.get_path ());
@@ -547,7 +617,7 @@ evidence_processor_impl::_save_encryption_keys ()
             mobius::framework::get_username_from_path (ek.f.get_path ());
 
         // create evidence
-        auto e = item_.new_evidence ("encryption-key");
+        mobius::framework::model::evidence_builder e ("encryption-key");
 
         e.set_attribute ("key_type", "chromium." + ek.type);
         e.set_attribute ("id", ek.id);
@@ -569,9 +639,11 @@ evidence_processor_impl::_save_encryption_keys ()
         e.set_tag ("app.browser");
         e.add_source (ek.f);
 
-        // Tell mediator about the new evidence
-        mediator_.on_evidence_created (e);
+        // Add evidence to batch
+        evidences.push_back (e);
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -580,6 +652,8 @@ evidence_processor_impl::_save_encryption_keys ()
 void
 evidence_processor_impl::_save_passwords ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
         for (const auto &login : p.get_logins ())
@@ -588,7 +662,7 @@ evidence_processor_impl::_save_passwords ()
             auto domain = uri.get_host ();
 
             // Set attributes
-            auto e = item_.new_evidence ("password");
+            mobius::framework::model::evidence_builder e ("password");
             e.set_attribute ("password_type", "net.http/" + domain);
             e.set_attribute ("value", mobius::core::bytearray {});
             e.set_attribute ("encrypted_value", login.password_value);
@@ -649,10 +723,12 @@ evidence_processor_impl::_save_passwords ()
             e.set_tag ("app.browser");
             e.add_source (login.f);
 
-            // Tell mediator about the new evidence
-            mediator_.on_evidence_created (e);
+            // Add evidence to batch
+            evidences.push_back (e);
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -661,6 +737,8 @@ evidence_processor_impl::_save_passwords ()
 void
 evidence_processor_impl::_save_pdis ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
         for (const auto &ap : p.get_autofill_profiles ())
@@ -679,7 +757,7 @@ evidence_processor_impl::_save_pdis ()
             {
                 if (!email.empty ())
                 {
-                    auto e = item_.new_evidence ("pdi");
+                    mobius::framework::model::evidence_builder e ("pdi");
                     e.set_attribute ("pdi_type", "email");
                     e.set_attribute ("value", email);
                     e.set_attribute ("app_family", APP_FAMILY);
@@ -688,8 +766,8 @@ evidence_processor_impl::_save_pdis ()
                     e.set_tag ("app.browser");
                     e.add_source (ap.f);
 
-                    // Tell mediator about the new evidence
-                    mediator_.on_evidence_created (e);
+                    // Add evidence to batch
+                    evidences.push_back (e);
                 }
             }
 
@@ -704,7 +782,7 @@ evidence_processor_impl::_save_pdis ()
 
                 if (!value.empty ())
                 {
-                    auto e = item_.new_evidence ("pdi");
+                    mobius::framework::model::evidence_builder e ("pdi");
                     e.set_attribute ("pdi_type", "phone");
                     e.set_attribute ("value", value);
                     e.set_attribute ("app_family", APP_FAMILY);
@@ -717,8 +795,8 @@ evidence_processor_impl::_save_pdis ()
                     e.set_tag ("app.browser");
                     e.add_source (ap.f);
 
-                    // Tell mediator about the new evidence
-                    mediator_.on_evidence_created (e);
+                    // Add evidence to batch
+                    evidences.push_back (e);
                 }
             }
 
@@ -748,7 +826,7 @@ evidence_processor_impl::_save_pdis ()
 
                 if (!value.empty ())
                 {
-                    auto e = item_.new_evidence ("pdi");
+                    mobius::framework::model::evidence_builder e ("pdi");
                     e.set_attribute ("pdi_type", "address");
                     e.set_attribute ("value", value);
                     e.set_attribute ("app_family", APP_FAMILY);
@@ -757,8 +835,8 @@ evidence_processor_impl::_save_pdis ()
                     e.set_tag ("app.browser");
                     e.add_source (ap.f);
 
-                    // Tell mediator about the new evidence
-                    mediator_.on_evidence_created (e);
+                    // Add evidence to batch
+                    evidences.push_back (e);
                 }
             }
 
@@ -781,7 +859,7 @@ evidence_processor_impl::_save_pdis ()
 
                 if (!value.empty ())
                 {
-                    auto e = item_.new_evidence ("pdi");
+                    mobius::framework::model::evidence_builder e ("pdi");
                     e.set_attribute ("pdi_type", "fullname");
                     e.set_attribute ("value", value);
                     e.set_attribute ("app_family", APP_FAMILY);
@@ -790,12 +868,14 @@ evidence_processor_impl::_save_pdis ()
                     e.set_tag ("app.browser");
                     e.add_source (ap.f);
 
-                    // Tell mediator about the new evidence
-                    mediator_.on_evidence_created (e);
+                    // Add evidence to batch
+                    evidences.push_back (e);
                 }
             }
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -804,13 +884,15 @@ evidence_processor_impl::_save_pdis ()
 void
 evidence_processor_impl::_save_received_files ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &profile : profiles_)
     {
         for (const auto &entry : profile.get_downloads ())
         {
             if (entry.timestamp)
             {
-                auto e = item_.new_evidence ("received-file");
+                mobius::framework::model::evidence_builder e ("received-file");
 
                 e.set_attribute ("timestamp", entry.timestamp);
                 e.set_attribute ("username", profile.get_username ());
@@ -825,11 +907,13 @@ evidence_processor_impl::_save_received_files ()
                 e.set_tag ("app.browser");
                 e.add_source (entry.f);
 
-                // Tell mediator about the new evidence
-                mediator_.on_evidence_created (e);
+                // Add evidence to batch
+                evidences.push_back (e);
             }
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -838,6 +922,8 @@ evidence_processor_impl::_save_received_files ()
 void
 evidence_processor_impl::_save_user_accounts ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
         // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -845,7 +931,7 @@ evidence_processor_impl::_save_user_accounts ()
         // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
         for (const auto &acc : p.get_accounts ())
         {
-            auto e = item_.new_evidence ("user-account");
+            mobius::framework::model::evidence_builder e ("user-account");
 
             // Set attributes
             e.set_attribute ("account_type", "app.chromium");
@@ -871,8 +957,8 @@ evidence_processor_impl::_save_user_accounts ()
             e.set_tag ("app.browser");
             e.add_source (acc.f);
 
-            // Tell mediator about the new evidence
-            mediator_.on_evidence_created (e);
+            // Add evidence to batch
+            evidences.push_back (e);
         }
 
         // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -883,7 +969,7 @@ evidence_processor_impl::_save_user_accounts ()
             auto uri = mobius::core::io::uri (login.origin_url);
             auto domain = uri.get_host ();
 
-            auto e = item_.new_evidence ("user-account");
+            mobius::framework::model::evidence_builder e ("user-account");
 
             // Set attributes
             e.set_attribute ("account_type", "net.http/" + domain);
@@ -948,10 +1034,12 @@ evidence_processor_impl::_save_user_accounts ()
             e.set_tag ("app.browser");
             e.add_source (login.f);
 
-            // Tell mediator about the new evidence
-            mediator_.on_evidence_created (e);
+            // Add evidence to batch
+            evidences.push_back (e);
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -960,11 +1048,13 @@ evidence_processor_impl::_save_user_accounts ()
 void
 evidence_processor_impl::_save_visited_urls ()
 {
+    std::vector<mobius::framework::model::evidence_builder> evidences;
+
     for (const auto &p : profiles_)
     {
         for (const auto &entry : p.get_history_entries ())
         {
-            auto e = item_.new_evidence ("visited-url");
+            mobius::framework::model::evidence_builder e ("visited-url");
 
             e.set_attribute ("username", p.get_username ());
             e.set_attribute ("url", entry.url);
@@ -976,10 +1066,12 @@ evidence_processor_impl::_save_visited_urls ()
             e.set_tag ("app.browser");
             e.add_source (entry.f);
 
-            // Tell mediator about the new evidence
-            mediator_.on_evidence_created (e);
+            // Add evidence to batch
+            evidences.push_back (e);
         }
     }
+
+    _create_evidences (evidences);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -21,6 +21,7 @@
 #include <mobius/framework/evidence_processor/evidence_processor_impl_base.hpp>
 #include <mobius/framework/evidence_processor/mediator.hpp>
 #include <mobius/framework/evidence_processor/profile.hpp>
+#include <mobius/framework/model/evidence_builder.hpp>
 #include <mobius/framework/model/item.hpp>
 #include <unordered_map>
 #include <set>
@@ -61,6 +62,23 @@ class evidence_processor_impl
     void on_evidence_loaded (mobius::framework::model::evidence) final;
     void on_complete () final;
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Check if implementation supports parallel folder traversal
+    // @return true
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    bool
+    is_thread_safe () const final
+    {
+        return true;
+    }
+
+    std::shared_ptr<
+        mobius::framework::evidence_processor::evidence_processor_impl_base>
+    new_worker () const final;
+    void join_worker (
+        mobius::framework::evidence_processor::evidence_processor_impl_base &
+    ) final;
+
   private:
     // @brief Case item
     mobius::framework::model::item item_;
@@ -110,6 +128,9 @@ class evidence_processor_impl
     void _save_received_files ();
     void _save_user_accounts ();
     void _save_visited_urls ();
+    void _create_evidences (
+        const std::vector<mobius::framework::model::evidence_builder> &
+    );
 
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Evidence processing functions
@@ -17,7 +17,6 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "file_history.hpp"
 #include <mobius/core/database/database.hpp>
-#include <mobius/core/io/tempfile.hpp>
 #include <mobius/core/log.hpp>
 #include <mobius/core/string_functions.hpp>
 #include <unordered_map>
@@ -107,8 +106,12 @@ namespace mobius::extension::app::chromium
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Constructor
 // @param reader Reader object
+// @param wal_reader "-wal" file reader (optional)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-file_history::file_history (const mobius::core::io::reader &reader)
+file_history::file_history (
+    const mobius::core::io::reader &reader,
+    const mobius::core::io::reader &wal_reader
+)
 {
     mobius::core::log log (__FILE__, __FUNCTION__);
 
@@ -117,16 +120,10 @@ file_history::file_history (const mobius::core::io::reader &reader)
 
     try
     {
-        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        // Copy reader content to temporary file
-        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        mobius::core::io::tempfile tfile;
-        tfile.copy_from (reader);
-
         // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
         // Get schema version
         // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        mobius::core::database::database db (tfile.get_path ());
+        mobius::core::database::database db (reader, wal_reader);
         schema_version_ = get_db_schema_version (db);
 
         if (!schema_version_)
@@ -617,10 +617,32 @@ profile::impl::add_history_file (const mobius::core::io::file &f)
 {
     mobius::core::log log (__FILE__, __FUNCTION__);
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Get "-wal" file, holding pages not yet written to History file
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    mobius::core::io::reader wal_reader;
+
+    if (!f.is_deleted ())
+    {
+        try
+        {
+            auto wal = f.get_parent ().get_child_by_name (
+                f.get_name () + "-wal"
+            );
+
+            if (wal && wal.is_file () && !wal.is_deleted ())
+                wal_reader = wal.get_file ().new_reader ();
+        }
+        catch (const std::exception &e)
+        {
+            log.warning (__LINE__, e.what ());
+        }
+    }
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Decode file
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    file_history fh (f.new_reader ());
+    file_history fh (f.new_reader (), wal_reader);
 
     if (!fh)
     {
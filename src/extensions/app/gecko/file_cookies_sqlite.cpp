@@ -17,7 +17,6 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "file_cookies_sqlite.hpp"
 #include <mobius/core/database/database.hpp>
-#include <mobius/core/io/tempfile.hpp>
 #include <mobius/core/log.hpp>
 #include "common.hpp"
 
@@ -38,12 +37,8 @@ file_cookies_sqlite::file_cookies_sqlite (
 
     try
     {
-        // Copy reader content to temporary file
-        mobius::core::io::tempfile tfile;
-        tfile.copy_from (reader);
-
         // Load data
-        mobius::core::database::database db (tfile.get_path ());
+        mobius::core::database::database db (reader);
         _load_cookies (db);
     }
     catch (const std::exception &e)
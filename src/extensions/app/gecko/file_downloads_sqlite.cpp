@@ -17,7 +17,6 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "file_downloads_sqlite.hpp"
 #include <mobius/core/database/database.hpp>
-#include <mobius/core/io/tempfile.hpp>
 #include <mobius/core/log.hpp>
 #include "common.hpp"
 
@@ -39,12 +38,8 @@ file_downloads_sqlite::file_downloads_sqlite (
 
     try
     {
-        // Copy reader content to temporary file
-        mobius::core::io::tempfile tfile;
-        tfile.copy_from (reader);
-
         // Load data
-        mobius::core::database::database db (tfile.get_path ());
+        mobius::core::database::database db (reader);
         _load_downloads (db);
     }
     catch (const std::exception &e)
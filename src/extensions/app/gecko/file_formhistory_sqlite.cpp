@@ -17,7 +17,6 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "file_formhistory_sqlite.hpp"
 #include <mobius/core/database/database.hpp>
-#include <mobius/core/io/tempfile.hpp>
 #include <mobius/core/log.hpp>
 #include "common.hpp"
 
@@ -38,12 +37,8 @@ file_formhistory_sqlite::file_formhistory_sqlite (
 
     try
     {
-        // Copy reader content to temporary file
-        mobius::core::io::tempfile tfile;
-        tfile.copy_from (reader);
-
         // Load data
-        mobius::core::database::database db (tfile.get_path ());
+        mobius::core::database::database db (reader);
         _load_form_history (db);
     }
     catch (const std::exception &e)
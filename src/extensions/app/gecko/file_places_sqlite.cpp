@@ -17,7 +17,6 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "file_places_sqlite.hpp"
 #include <mobius/core/database/database.hpp>
-#include <mobius/core/io/tempfile.hpp>
 #include <mobius/core/log.hpp>
 #include <unordered_map>
 #include "common.hpp"
@@ -60,12 +59,8 @@ file_places_sqlite::file_places_sqlite (const mobius::core::io::reader &reader)
 
     try
     {
-        // Copy reader content to temporary file
-        mobius::core::io::tempfile tfile;
-        tfile.copy_from (reader);
-
         // Load data
-        mobius::core::database::database db (tfile.get_path ());
+        mobius::core::database::database db (reader);
         _load_bookmarks (db);
         _load_visited_urls (db);
     }
@@ -18,7 +18,6 @@
 #include "file_plum_sqlite.hpp"
 #include <mobius/core/database/database.hpp>
 #include <mobius/core/datetime/datetime.hpp>
-#include <mobius/core/io/tempfile.hpp>
 #include <mobius/core/log.hpp>
 
 namespace
@@ -58,12 +57,8 @@ file_plum_sqlite::file_plum_sqlite (const mobius::core::io::reader &reader)
 
     try
     {
-        // Copy reader content to temporary file
-        mobius::core::io::tempfile tfile;
-        tfile.copy_from (reader);
-
         // Load data
-        mobius::core::database::database db (tfile.get_path ());
+        mobius::core::database::database db (reader);
         _load_notes (db);
     }
     catch (const std::exception &e)
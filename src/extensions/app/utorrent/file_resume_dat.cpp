@@ -20,7 +20,6 @@
 #include <mobius/core/decoder/btencode.hpp>
 #include <mobius/core/decoder/data_decoder.hpp>
 #include <mobius/core/file_decoder/torrent.hpp>
-#include <mobius/core/io/tempfile.hpp>
 #include <mobius/core/log.hpp>
 #include <mobius/core/pod/map.hpp>
 #include <mobius/core/string_functions.hpp>
@@ -102,12 +101,8 @@ file_resume_dat::_decode_sqlite (const mobius::core::io::reader &reader)
 
     try
     {
-        // Copy reader content to temporary file
-        mobius::core::io::tempfile tfile;
-        tfile.copy_from (reader);
-
         // Get schema version
-        mobius::core::database::database db (tfile.get_path ());
+        mobius::core::database::database db (reader);
 
         // Prepare SQL statement for table TORRENTS
         auto stmt = db.new_statement (
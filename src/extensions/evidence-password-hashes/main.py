@@ -293,26 +293,31 @@ class HashesView(object):
         count = 0
         password_count = 0
 
+        hashes = [h for item in itemlist for h in item.load_evidences(EVIDENCE_TYPE)]
+
+        # resolve unknown passwords at once
         turing = mobius.core.turing.turing()
+        unknown = [h for h in hashes if not h.has_attribute("password")]
+        passwords = turing.get_hash_passwords([(h.password_hash_type, h.value) for h in unknown])
+        resolved = dict(zip(map(id, unknown), passwords))
 
-        for item in itemlist:
-            for h in item.get_evidences(EVIDENCE_TYPE):
-                count += 1
+        for h in hashes:
+            count += 1
+
+            if h.has_attribute("password"):
+                status = 1  # found
+                password_count += 1
+                password = h.password
 
-                if h.has_attribute("password"):
-                    status = 1  # found
-                    password_count += 1
-                    password = h.password
+            else:
+                status, password = resolved[id(h)]
 
+                if status == 1:
+                    h.password = password
                 else:
-                    status, password = turing.get_hash_password(h.password_hash_type, h.value)
-
-                    if status == 1:
-                        h.password = password
-                    else:
-                        flag_has_unknown_password = True
+                    flag_has_unknown_password = True
 
-                model.append((h.password_hash_type, h.value, password, STATUS[status], h.description, h))
+            model.append((h.password_hash_type, h.value, password, STATUS[status], h.description, h))
 
         # enable/disable options
         model.set_sort_column_id(0, Gtk.SortType.ASCENDING)
@@ -122,7 +122,7 @@ class GenericView(object):
         evidences = []
 
         for item in itemlist:
-            evidences += item.get_evidences(self.__evidence_type)
+            evidences += item.load_evidences(self.__evidence_type)
 
         self.__master_view_selector.set_data(evidences)
         self.__widget.show_content()
@@ -291,6 +291,7 @@ class ICEWindow(object):
         # if user hit OK, create a new case
         if response == Gtk.ResponseType.OK:
             case = mobius.framework.model.new_case(case_folder)
+            case.enable_wal()
             case.root_item.id = case_id
             case.root_item.name = case_name
 
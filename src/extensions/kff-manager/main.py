@@ -34,14 +34,14 @@ from gi.repository import Gtk
 EXTENSION_ID = 'kff-manager'
 EXTENSION_NAME = 'KFF Manager'
 EXTENSION_AUTHOR = 'Eduardo Aguiar'
-EXTENSION_VERSION = '1.3'
+EXTENSION_VERSION = '1.4'
 EXTENSION_DESCRIPTION = 'Known File Filter (KFF) Manager'
 
 
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 # @brief Get hashes from json file
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-def import_json(f, hashset):
+def import_json(f, hashset, progress=None):
     fp = mobius.core.io.text_reader(f.new_reader())
     d = json.load(fp)
 
@@ -53,41 +53,28 @@ def import_json(f, hashset):
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 # @brief Get hashes from tab separated file
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-def import_tab_separated(f, hashset):
-    fp = mobius.core.io.line_reader(f.new_reader())
-
-    for line in fp:
-        htype, hvalue = line.split('\t')
-        hashset.add(htype, hvalue)
+def import_tab_separated(f, hashset, progress=None):
+    hashset.import_hashes(f.new_reader(), 'tab', '', progress)
 
 
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 # @brief Get hashes from .csv file
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-def import_csv(f, hashset):
-    fp = mobius.core.io.line_reader(f.new_reader())
-    first = True
-
-    for line in fp:
-        if first:
-            first = False
-
-        else:
-            htype, hvalue = line.split(',')
+def import_csv(f, hashset, progress=None):
+    hashset.import_hashes(f.new_reader(), 'csv', '', progress)
 
-            if htype[0] == '"':
-                htype = htype[1:-1]
 
-            if hvalue[0] == '"':
-                hvalue = hvalue[1:-1]
-
-            hashset.add(htype, hvalue)
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+# @brief Import hashes from NSRL RDS file (NSRLFile.txt)
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+def import_nsrl(f, hashset, progress=None):
+    hashset.import_hashes(f.new_reader(), 'nsrl', '', progress)
 
 
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 # @brief Import hashes from LED .txt file
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-def import_led(f, hashset):
+def import_led(f, hashset, progress=None):
     fp = mobius.core.io.line_reader(f.new_reader(), 'iso-8859-1')
 
     for line in fp:
@@ -117,21 +104,14 @@ def export_json(f, hashset):
 # @brief Export hashset as tab separated file
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 def export_tab(f, hashset):
-    fp = mobius.core.io.text_writer(f.new_writer())
-
-    for htype, hvalue in hashset.hashes:
-        fp.write('%s\t%s\n' % (htype, hvalue))
+    hashset.export_hashes(f.new_writer(), 'tab')
 
 
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 # @brief Export hashset as csv file
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 def export_csv(f, hashset):
-    fp = mobius.core.io.text_writer(f.new_writer())
-    fp.write('id,name,value\r\n')
-
-    for htype, hvalue in hashset.hashes:
-        fp.write('%s,%s\n' % (htype, hvalue))
+    hashset.export_hashes(f.new_writer(), 'csv')
 
 
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -151,14 +131,10 @@ def walk(folder):
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 def calculate_hash(f, hash_type):
     reader = f.new_reader()
-    h = mobius.core.crypt.hash(hash_type)
-    data = reader.read(65536)
-
-    while data:
-        h.update(data)
-        data = reader.read(65536)
+    h = mobius.core.crypt.multi_hash([hash_type])
+    h.update(reader)
 
-    return h.get_hex_digest()
+    return h.get_digest(hash_type).hex()
 
 
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -533,6 +509,13 @@ class KFFView(object):
         filefilter.add_pattern('*.csv')
         fs.add_filter(filefilter)
 
+        filefilter = Gtk.FileFilter()
+        filefilter.handler = import_nsrl
+        filefilter.extension = 'txt'
+        filefilter.set_name('NSRL RDS file (NSRLFile.txt)')
+        filefilter.add_pattern('*.txt')
+        fs.add_filter(filefilter)
+
         filefilter = Gtk.FileFilter()
         filefilter.handler = import_led
         filefilter.extension = 'txt'
@@ -561,8 +544,12 @@ class KFFView(object):
             self.__status_label.set_text(f'Importing {url}')
             mobius.core.ui.flush()
 
+            def progress(bytes_read, hashes_read, url=url):
+                self.__status_label.set_text(f'Importing {url}: {hashes_read} hashes read')
+                mobius.core.ui.flush()
+
             f = mobius.core.io.new_file_by_url(url)
-            handler(f, hashset)
+            handler(f, hashset, progress)
 
         transaction.commit()
 
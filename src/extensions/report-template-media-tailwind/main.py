@@ -501,7 +501,7 @@ class Generator(object):
         # Get evidences
         evidences = []
 
-        for e in item.get_evidences(evidence_type):
+        for e in item.load_evidences(evidence_type):
             getters = self.__getters.get(evidence_type, [])
             data = {'uid': e.uid,
                     'attrs': dict((k, g(e)) for k, g in getters),
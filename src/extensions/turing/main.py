@@ -238,17 +238,9 @@ class DatabaseView(object):
         fp.close()
 
         # store data
-        transaction = self.__turing.new_transaction()
-        count = 0
-
-        for t, v, p in model.get('hashes', []):
-            if not self.__turing.has_hash(t, v):
-                self.__turing.set_hash(t, v, p)
-                count += 1
-
-        transaction.commit()
+        hashes = [(t, v, p) for t, v, p in model.get('hashes', [])]
 
-        return count
+        return self.__turing.set_hashes(hashes)
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Import .pot file
@@ -257,9 +249,8 @@ class DatabaseView(object):
         f = mobius.core.io.new_file_by_path(filename)
         fp = mobius.core.io.line_reader(f.new_reader(), 'utf-8', '\n')
 
-        # store data
-        transaction = self.__turing.new_transaction()
-        count = 0
+        # parse data
+        hashes = []
 
         for line in fp:
 
@@ -291,15 +282,13 @@ class DatabaseView(object):
                 hash_type = None
                 hash_value = None
 
-            # set hash
-            if hash_type and not self.__turing.has_hash(hash_type, hash_value):
-                self.__turing.set_hash(hash_type, hash_value, password)
-                count += 1
+            if hash_type:
+                hashes.append((hash_type, hash_value, password))
 
-        transaction.commit()
         fp.close()
 
-        return count
+        # store data
+        return self.__turing.set_hashes(hashes)
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Export wordlist file
@@ -113,8 +113,7 @@ superblock::superblock (mobius::core::decoder::data_decoder &decoder)
     keylocker_count_ = decoder.get_uint64_le ();
 
     // Read ephemeral info
-    for (std::size_t i = 0; i < NX_EPH_INFO_COUNT; i++)
-        ephemeral_info_.push_back (decoder.get_uint64_le ());
+    ephemeral_info_ = decoder.get_uint64_le_vector (NX_EPH_INFO_COUNT);
 
     // Read other fields
     test_oid_ = decoder.get_uint64_le ();
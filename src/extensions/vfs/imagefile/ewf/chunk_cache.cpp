@@ -0,0 +1,176 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "chunk_cache.hpp"
+#include <algorithm>
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param loader Chunk loader function
+// @param capacity Max number of chunks kept in memory
+// @param workers Number of prefetch worker threads (0 = no prefetching)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+chunk_cache::chunk_cache (loader_type loader, size_type capacity,
+                          unsigned int workers)
+    : loader_ (std::move (loader)),
+      capacity_ (std::max<size_type> (capacity, 1)),
+      workers_ (workers)
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get chunk
+// @param idx Chunk index
+// @return Chunk data
+//
+// If chunk is being prefetched, wait for it. Otherwise, load it on the
+// calling thread, so loader errors are reported to the caller.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+chunk_cache::chunk_type
+chunk_cache::get (idx_type idx)
+{
+    std::unique_lock<std::mutex> lock (mutex_);
+
+    while (true)
+    {
+        auto iter = entries_.find (idx);
+
+        if (iter != entries_.end ())
+        {
+            lru_.splice (lru_.begin (), lru_, iter->second.lru_iter);
+            hits_++;
+            return iter->second.data;
+        }
+
+        if (pending_.find (idx) == pending_.end ())
+            break;
+
+        ready_cv_.wait (lock);
+    }
+
+    // load chunk on this thread
+    misses_++;
+    pending_.insert (idx);
+    lock.unlock ();
+
+    chunk_type data;
+
+    try
+    {
+        data = std::make_shared<const mobius::core::bytearray> (loader_ (idx));
+    }
+    catch (...)
+    {
+        lock.lock ();
+        pending_.erase (idx);
+        ready_cv_.notify_all ();
+        throw;
+    }
+
+    lock.lock ();
+    pending_.erase (idx);
+    _insert (idx, data);
+    ready_cv_.notify_all ();
+
+    return data;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Schedule chunks to be loaded in background
+// @param first_idx First chunk index
+// @param count Number of chunks
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+chunk_cache::prefetch (idx_type first_idx, size_type count)
+{
+    if (!workers_)
+        return;
+
+    // never prefetch more chunks than the cache can hold
+    count = std::min (count, capacity_ - 1);
+
+    std::lock_guard<std::mutex> lock (mutex_);
+
+    for (idx_type idx = first_idx; idx < first_idx + count; idx++)
+    {
+        if (entries_.find (idx) != entries_.end () ||
+            pending_.find (idx) != pending_.end ())
+            continue;
+
+        if (!pool_)
+            pool_.emplace (workers_);
+
+        pending_.insert (idx);
+        pool_->submit ([this, idx] { _load (idx); });
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Insert chunk into cache, evicting least recently used ones
+// @param idx Chunk index
+// @param data Chunk data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+chunk_cache::_insert (idx_type idx, const chunk_type &data)
+{
+    auto iter = entries_.find (idx);
+
+    if (iter != entries_.end ())
+    {
+        iter->second.data = data;
+        lru_.splice (lru_.begin (), lru_, iter->second.lru_iter);
+        return;
+    }
+
+    lru_.push_front (idx);
+    entries_[idx] = entry {data, lru_.begin ()};
+
+    while (entries_.size () > capacity_)
+    {
+        entries_.erase (lru_.back ());
+        lru_.pop_back ();
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Load chunk in background (worker thread)
+// @param idx Chunk index
+//
+// Errors are ignored here. If chunk cannot be loaded, get () will try again
+// on the calling thread and report the error.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+chunk_cache::_load (idx_type idx)
+{
+    chunk_type data;
+
+    try
+    {
+        data = std::make_shared<const mobius::core::bytearray> (loader_ (idx));
+    }
+    catch (...)
+    {
+    }
+
+    std::lock_guard<std::mutex> lock (mutex_);
+    pending_.erase (idx);
+
+    if (data)
+        _insert (idx, data);
+
+    ready_cv_.notify_all ();
+}
@@ -0,0 +1,140 @@
+#ifndef MOBIUS_EXTENSION_CHUNK_CACHE_HPP
+#define MOBIUS_EXTENSION_CHUNK_CACHE_HPP
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/bytearray.hpp>
+#include <mobius/core/thread_pool.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief LRU cache of decoded chunks, with background prefetching
+// @author Eduardo Aguiar
+//
+// Chunks are decoded by a loader function, either on the calling thread
+// (cache miss) or by worker threads (prefetch). The loader function must be
+// thread-safe. At most "capacity" chunks are kept in memory, including the
+// ones prefetched and not yet read.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class chunk_cache
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Datatypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    using size_type = std::uint64_t;
+    using idx_type = std::uint64_t;
+    using chunk_type = std::shared_ptr<const mobius::core::bytearray>;
+    using loader_type = std::function<mobius::core::bytearray (idx_type)>;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    chunk_cache (loader_type, size_type, unsigned int);
+    chunk_cache (const chunk_cache &) = delete;
+    chunk_cache (chunk_cache &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    chunk_cache &operator= (const chunk_cache &) = delete;
+    chunk_cache &operator= (chunk_cache &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of cache hits
+    // @return Number of hits
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    size_type
+    get_hits () const
+    {
+        return hits_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of cache misses
+    // @return Number of misses
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    size_type
+    get_misses () const
+    {
+        return misses_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    chunk_type get (idx_type);
+    void prefetch (idx_type, size_type);
+
+  private:
+    // @brief Cache entry
+    struct entry
+    {
+        chunk_type data;
+        std::list<idx_type>::iterator lru_iter;
+    };
+
+    // @brief Chunk loader function
+    loader_type loader_;
+
+    // @brief Max number of chunks in memory
+    size_type capacity_;
+
+    // @brief Number of worker threads
+    unsigned int workers_;
+
+    // @brief Cached chunks
+    std::unordered_map<idx_type, entry> entries_;
+
+    // @brief Chunk indexes, from most to least recently used
+    std::list<idx_type> lru_;
+
+    // @brief Chunks being loaded
+    std::unordered_set<idx_type> pending_;
+
+    // @brief Cache hits
+    size_type hits_ = 0;
+
+    // @brief Cache misses
+    size_type misses_ = 0;
+
+    // @brief Cache mutex
+    std::mutex mutex_;
+
+    // @brief Signaled when a pending chunk is done
+    std::condition_variable ready_cv_;
+
+    // @brief Worker threads, created on first prefetch (must be last member)
+    std::optional<mobius::core::thread_pool> pool_;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Helper functions
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void _insert (idx_type, const chunk_type &);
+    void _load (idx_type);
+};
+
+#endif
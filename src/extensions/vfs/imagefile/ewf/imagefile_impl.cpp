@@ -92,6 +92,7 @@ imagefile_impl::imagefile_impl (const mobius::core::io::file &f)
 {
     attributes_.set ("compression_level", 0);                  // no compression
     attributes_.set ("segment_size", 4 * 1024 * 1024 * 1024L); // 4 GiB
+    attributes_.set ("compression_threads", 0); // one per core
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
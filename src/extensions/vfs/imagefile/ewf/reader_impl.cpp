@@ -18,23 +18,57 @@
 #include "reader_impl.hpp"
 #include "imagefile_impl.hpp"
 #include <mobius/core/exception.inc>
+#include <mobius/core/thread_pool.hpp>
 #include <mobius/core/zlib_functions.hpp>
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Max number of prefetch worker threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr unsigned int MAX_WORKERS = 8;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get default number of prefetch worker threads
+// @return One thread per core, except the calling one
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+unsigned int
+get_default_workers ()
+{
+    unsigned int threads = mobius::core::get_hardware_threads ();
+    return std::min (std::max (threads, 2U) - 1, MAX_WORKERS);
+}
+
+} // namespace
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Constructor
 // @param impl imagefile implementation
+// @param cache_chunks Max number of decompressed chunks kept in memory
+// @param prefetch_chunks Chunks to read ahead on sequential access (0 = off)
+// @param workers Prefetch worker threads (0 = one per core, up to 8)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-reader_impl::reader_impl (const imagefile_impl &impl)
+reader_impl::reader_impl (const imagefile_impl &impl, size_type cache_chunks,
+                          size_type prefetch_chunks, unsigned int workers)
     : size_ (impl.get_size ()),
       chunk_size_ (impl.get_chunk_size ()),
       segments_ (impl.get_segment_array ()),
       chunk_offset_table_ (impl.get_chunk_offset_table ()),
       chunk_idx_ (impl.get_chunk_count ()),
-      last_chunk_idx_ (impl.get_chunk_count () - 1)
+      last_chunk_idx_ (impl.get_chunk_count () - 1),
+      prefetch_chunks_ (prefetch_chunks),
+      cache_ ([this] (size_type idx) { return _load_chunk (idx); },
+              std::max (cache_chunks, prefetch_chunks + 1),
+              prefetch_chunks ? (workers ? workers : get_default_workers ())
+                              : 0)
 {
-    segments_.scan ();
-    segment_idx_ = segments_.get_size ();
+    // segments are already scanned by imagefile_impl. Scanning them again
+    // would race with prefetch workers of other readers sharing the array
+    if (segments_.get_size () == 0)
+        segments_.scan ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -70,39 +104,81 @@ reader_impl::seek (offset_type offset, whence_type w)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Read bytes from reader
+// @brief Read bytes from reader into buffer
+// @param buffer buffer, with at least size bytes
 // @param size size in bytes
-// @return bytearray containing data
+// @return number of bytes read
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-mobius::core::bytearray
-reader_impl::read (size_type size)
+reader_impl::size_type
+reader_impl::read_into (std::uint8_t *buffer, size_type size)
 {
     size = std::min (size_ - pos_, size);
-    mobius::core::bytearray data;
+    size_type count = 0;
 
-    while (size > 0)
+    while (count < size)
     {
         _retrieve_current_chunk ();
 
         size_type slice_start = pos_ % chunk_size_;
-        size_type slice_end =
-            std::min (slice_start + size - 1, chunk_data_.size () - 1);
 
-        if (slice_end < slice_start)
-            return data;
+        if (!chunk_data_ || slice_start >= chunk_data_->size ())
+            break;
+
+        size_type slice_size =
+            std::min (size - count, chunk_data_->size () - slice_start);
+
+        std::memcpy (buffer + count, chunk_data_->data () + slice_start,
+                     slice_size);
+        pos_ += slice_size;
+        count += slice_size;
+    }
+
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from a given position into buffer
+// @param offset offset in bytes from the beginning of data
+// @param buffer buffer, with at least size bytes
+// @param size size in bytes
+// @return number of bytes read
+//
+// Chunks are retrieved directly from the cache, without changing read
+// position or the current chunk, so this function is thread-safe.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+reader_impl::size_type
+reader_impl::read_at (size_type offset, std::uint8_t *buffer, size_type size)
+{
+    if (offset >= size_)
+        return 0;
+
+    size = std::min (size_ - offset, size);
+    size_type count = 0;
 
-        mobius::core::bytearray tmp =
-            chunk_data_.slice (slice_start, slice_end);
-        data += tmp;
-        pos_ += tmp.size ();
-        size -= tmp.size ();
+    while (count < size)
+    {
+        size_type pos = offset + count;
+        auto data = cache_.get (pos / chunk_size_);
+        size_type slice_start = pos % chunk_size_;
+
+        if (!data || slice_start >= data->size ())
+            break;
+
+        size_type slice_size =
+            std::min (size - count, data->size () - slice_start);
+
+        std::memcpy (buffer + count, data->data () + slice_start, slice_size);
+        count += slice_size;
     }
 
-    return data;
+    return count;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Retrieve current data chunk
+//
+// When chunks are being read sequentially, the next chunks are scheduled to
+// be decoded by worker threads.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
 reader_impl::_retrieve_current_chunk ()
@@ -113,21 +189,51 @@ reader_impl::_retrieve_current_chunk ()
     if (chunk_idx == chunk_idx_)
         return;
 
-    // find segment info for pos_ offset (binary search)
+    // detect sequential access
+    if (chunk_idx == chunk_idx_ + 1)
+        sequential_count_++;
+
+    else
+        sequential_count_ = 0;
+
+    // get chunk data
+    chunk_data_ = cache_.get (chunk_idx);
+    chunk_idx_ = chunk_idx;
+
+    // read ahead
+    if (sequential_count_ >= SEQUENTIAL_THRESHOLD && chunk_idx < last_chunk_idx_)
+        cache_.prefetch (chunk_idx + 1,
+                         std::min (prefetch_chunks_, last_chunk_idx_ - chunk_idx));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Load and decompress chunk
+// @param chunk_idx Chunk index
+// @return Chunk data
+//
+// This function is called both by the reader thread and by prefetch workers,
+// so each call takes its own segment reader from the free streams list.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::bytearray
+reader_impl::_load_chunk (size_type chunk_idx)
+{
+    size_type pos = chunk_idx * chunk_size_;
+
+    // find segment info for pos offset (binary search)
     int hi = chunk_offset_table_.size ();
     int lo = 0;
-    int mid;
+    int mid = 0;
     bool found = false;
 
     while (lo < hi && !found)
     {
         mid = (lo + hi) / 2;
 
-        if (chunk_offset_table_[mid].start > pos_)
+        if (chunk_offset_table_[mid].start > pos)
             hi = mid;
 
-        else if (chunk_offset_table_[mid].end < pos_)
-            lo = mid;
+        else if (chunk_offset_table_[mid].end < pos)
+            lo = mid + 1;
 
         else
             found = true;
@@ -135,39 +241,63 @@ reader_impl::_retrieve_current_chunk ()
 
     // if segment info not found, return
     if (!found)
-        return;
-
-    // set stream
-    auto segment_idx = mid;
-
-    if (segment_idx != segment_idx_)
-    {
-        stream_ = segments_.new_reader (segment_idx);
-        segment_idx_ = segment_idx;
-    }
+        return {};
 
     // get chunk data offset
     const auto &offset_table = chunk_offset_table_[mid];
-    size_type table_idx = (pos_ - offset_table.start) / chunk_size_;
+    size_type table_idx = (pos - offset_table.start) / chunk_size_;
     auto offset = offset_table.offsets[table_idx];
 
     constexpr std::uint64_t compressed_bit = std::uint64_t (1) << 63;
     bool compressed = offset & compressed_bit;
     offset = offset & 0x7fffffffffffffff;
 
+    // get segment reader
+    stream_slot stream;
+
+    {
+        std::lock_guard<std::mutex> lock (streams_mutex_);
+
+        auto iter = std::find_if (
+            free_streams_.begin (), free_streams_.end (),
+            [mid] (const stream_slot &s) { return s.segment_idx == mid; });
+
+        if (iter == free_streams_.end () && !free_streams_.empty ())
+            iter = free_streams_.begin ();
+
+        if (iter != free_streams_.end ())
+        {
+            stream = std::move (*iter);
+            free_streams_.erase (iter);
+        }
+
+        if (stream.segment_idx != mid)
+        {
+            stream.reader = segments_.new_reader (mid);
+            stream.segment_idx = mid;
+        }
+    }
+
     // read chunk data
-    stream_.seek (offset);
+    stream.reader.seek (offset);
+
+    mobius::core::bytearray chunk_data;
 
     if (compressed)
-        chunk_data_ =
-            mobius::core::zlib_decompress (stream_.read (chunk_size_ + 4));
+        chunk_data =
+            mobius::core::zlib_decompress (stream.reader.read (chunk_size_ + 4));
 
     else
-        chunk_data_ = stream_.read (chunk_size_);
+        chunk_data = stream.reader.read (chunk_size_);
 
-    if (chunk_data_.size () != chunk_size_ && chunk_idx != last_chunk_idx_)
+    // return segment reader to the free streams list
+    {
+        std::lock_guard<std::mutex> lock (streams_mutex_);
+        free_streams_.push_back (std::move (stream));
+    }
+
+    if (chunk_data.size () != chunk_size_ && chunk_idx != last_chunk_idx_)
         throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("invalid chunk"));
 
-    // set new current chunk index
-    chunk_idx_ = chunk_idx;
+    return chunk_data;
 }
@@ -18,9 +18,11 @@
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "chunk_cache.hpp"
 #include "imagefile_impl.hpp"
 #include <mobius/core/io/reader_impl_base.hpp>
 #include <mobius/core/vfs/segment_array.hpp>
+#include <mutex>
 #include <vector>
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -30,7 +32,20 @@
 class reader_impl : public mobius::core::io::reader_impl_base
 {
   public:
-    explicit reader_impl (const imagefile_impl &);
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constants
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    static constexpr size_type DEFAULT_CACHE_CHUNKS = 64;
+    static constexpr size_type DEFAULT_PREFETCH_CHUNKS = 16;
+    static constexpr size_type SEQUENTIAL_THRESHOLD = 2;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit reader_impl (const imagefile_impl &,
+                          size_type = DEFAULT_CACHE_CHUNKS,
+                          size_type = DEFAULT_PREFETCH_CHUNKS,
+                          unsigned int = 0);
 
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // @brief check if reader is seekable
@@ -92,13 +107,47 @@ class reader_impl : public mobius::core::io::reader_impl_base
         return chunk_size_;
     }
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get chunk cache hits
+    // @return Number of chunks read from cache
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    size_type
+    get_cache_hits () const
+    {
+        return cache_.get_hits ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get chunk cache misses
+    // @return Number of chunks decoded on the calling thread
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    size_type
+    get_cache_misses () const
+    {
+        return cache_.get_misses ();
+    }
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // virtual methods
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    mobius::core::bytearray read (size_type) override;
+    mobius::core::bytearray
+    read (size_type size) override
+    {
+        return _read_using_read_into (size);
+    }
+
+    size_type read_into (std::uint8_t *, size_type) override;
+    size_type read_at (size_type, std::uint8_t *, size_type) override;
     void seek (offset_type, whence_type) override;
 
   private:
+    // @brief Segment file reader, reused across chunk loads
+    struct stream_slot
+    {
+        int segment_idx = -1;
+        mobius::core::io::reader reader;
+    };
+
     size_type size_;
     size_type pos_ = 0;
     size_type chunk_size_ = 0;
@@ -106,13 +155,19 @@ class reader_impl : public mobius::core::io::reader_impl_base
     mobius::core::vfs::segment_array segments_;
     const std::vector<imagefile_impl::chunk_offset_table> &chunk_offset_table_;
 
-    int segment_idx_;          //!< current segment index
-    size_type chunk_idx_;      //!< current chunk index
-    size_type last_chunk_idx_; //!< last chunk index
-    mobius::core::io::reader stream_;
-    mobius::core::bytearray chunk_data_;
+    size_type chunk_idx_;           //!< current chunk index
+    size_type last_chunk_idx_;      //!< last chunk index
+    size_type prefetch_chunks_;     //!< chunks to read ahead
+    size_type sequential_count_ = 0; //!< consecutive sequential chunk reads
+    chunk_cache::chunk_type chunk_data_;
+
+    std::vector<stream_slot> free_streams_; //!< idle segment readers
+    std::mutex streams_mutex_;
+
+    chunk_cache cache_; //!< must be last member (stops workers first)
 
     void _retrieve_current_chunk ();
+    mobius::core::bytearray _load_chunk (size_type);
 };
 
 #endif
@@ -111,49 +111,58 @@ segment_writer::create ()
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Write data
-// @param arg_data data
-// @return the number of bytes written
+// @brief Encode chunk data
+// @param data Chunk data (chunk size bytes, except for the last chunk)
+// @param compression_level Compression level (0 - none, 1 - fast, 2 - best)
+// @return Encoded chunk
+//
+// This function is thread-safe, so chunks can be encoded in parallel and
+// then written in order by write_chunk.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-segment_writer::size_type
-segment_writer::write (const mobius::core::bytearray &arg_data)
+segment_writer::chunk
+segment_writer::encode_chunk (const mobius::core::bytearray &data,
+                              int compression_level)
 {
-    mobius::core::bytearray data = chunk_data_ + arg_data;
-    size_type bytes = 0;
-
-    // write data chunks
-    bool can_write = _can_write_chunk_data ();
+    chunk c;
 
-    while (data.size () >= chunk_size_ && can_write)
+    // compress data, if necessary
+    if (compression_level > 0)
     {
-        _write_chunk_data (data.slice (0, chunk_size_ - 1));
-        bytes += chunk_size_;
-        data = data.slice (chunk_size_, data.size () - 1);
-        can_write = _can_write_chunk_data ();
-    }
+        int level = (compression_level == 2) ? 9 : 1;
+        mobius::core::bytearray compressed_data =
+            mobius::core::zlib_compress (data, level);
 
-    // if there is room for one more chunk data, write the remaining bytes into
-    // chunk_data_
-    if (can_write)
-    {
-        bytes -= chunk_data_.size (); // does not count those bytes twice
-        chunk_data_ = data;
-        bytes += data.size ();
+        if (compressed_data.size () < data.size ())
+        {
+            c.data = std::move (compressed_data);
+            c.is_compressed = true;
+        }
     }
 
-    // otherwise, if it has written at least one chunk, clear chunk data
-    else if (bytes > 0)
-    {
-        bytes -= chunk_data_.size (); // does not count those bytes twice
-        chunk_data_.clear ();
-    }
+    if (!c.is_compressed)
+        c.data = data;
+
+    // evaluate ADLER-32 hash
+    mobius::core::crypt::hash_functor hash_functor ("adler32");
+    hash_functor (c.data);
+    c.adler32 = digest_to_uint32_t (hash_functor.get_digest ());
+
+    return c;
+}
 
-    // otherwise, error
-    else if (chunk_data_.size () > 0)
-        throw std::runtime_error (
-            MOBIUS_EXCEPTION_MSG ("error writing chunk data"));
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Write encoded chunk
+// @param c Encoded chunk
+// @return true if chunk was written, false if there is no room for it
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+segment_writer::write_chunk (const chunk &c)
+{
+    if (!_can_write_chunk_data ())
+        return false;
 
-    return bytes;
+    _write_chunk_data (c);
+    return true;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -171,13 +180,6 @@ segment_writer::flush ()
 void
 segment_writer::close ()
 {
-    // flush remaining chunk_data_, if any
-    if (!chunk_data_.empty ())
-    {
-        _write_chunk_data (chunk_data_);
-        chunk_data_.clear ();
-    }
-
     // write remaining bytes, if any, and close sectors, table and table2
     // sections
     if (sector_offset_ != -1)
@@ -473,11 +475,10 @@ segment_writer::_can_write_chunk_data ()
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief write chunk data
-// @param data chunk data to be written
-// @return true/false if chunk could be written
+// @param c encoded chunk to be written
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-segment_writer::_write_chunk_data (mobius::core::bytearray data)
+segment_writer::_write_chunk_data (const chunk &c)
 {
     // create new sectors section, if necessary
     if (sector_offset_ == -1)
@@ -489,29 +490,14 @@ segment_writer::_write_chunk_data (mobius::core::bytearray data)
     // evaluate chunk offset
     std::uint32_t chunk_offset = writer_.tell () - sector_offset_;
 
-    // compress data, if necessary
-    if (compression_level_ > 0)
-    {
-        int level = (compression_level_ == 2) ? 9 : 1;
-        mobius::core::bytearray compressed_data =
-            mobius::core::zlib_compress (data, level);
+    if (c.is_compressed)
+        chunk_offset |= 0x80000000; // set chunk data compressed flag
 
-        if (compressed_data.size () < data.size ())
-        {
-            data = compressed_data;
-            chunk_offset |= 0x80000000; // set chunk data compressed flag
-        }
-    }
+    // write data and ADLER-32 hash
+    writer_.write (c.data);
 
-    // write data
-    mobius::core::crypt::hash_functor hash_functor ("adler32");
-    auto writer = mobius::core::io::writer_evaluator (writer_, hash_functor);
-    writer.write (data);
-
-    // encode ADLER-32 hash
-    mobius::core::encoder::data_encoder encoder (writer);
-    std::uint32_t hash_value = digest_to_uint32_t (hash_functor.get_digest ());
-    encoder.encode_uint32_le (hash_value); // Adler-32 CRC
+    mobius::core::encoder::data_encoder encoder (writer_);
+    encoder.encode_uint32_le (c.adler32); // Adler-32 CRC
 
     // update chunk offset list
     chunk_count_++;
@@ -36,6 +36,17 @@ class segment_writer
     using size_type = std::uint64_t;
     using offset_type = std::int64_t;
 
+    // @brief Encoded chunk, ready to be written into "sectors" section
+    struct chunk
+    {
+        mobius::core::bytearray data;
+        std::uint32_t adler32 = 0;
+        bool is_compressed = false;
+    };
+
+    // static functions
+    static chunk encode_chunk (const mobius::core::bytearray &, int);
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // constructors
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -183,7 +194,7 @@ class segment_writer
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // methods
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    size_type write (const mobius::core::bytearray &);
+    bool write_chunk (const chunk &);
     void create ();
     void flush ();
     void close ();
@@ -192,7 +203,6 @@ class segment_writer
     // control attributes
     mobius::core::io::writer writer_;
     std::uint16_t segment_number_;
-    mobius::core::bytearray chunk_data_;
     std::vector<std::uint32_t> chunk_offset_list_;
     std::vector<std::pair<std::string, offset_type>> volume_info_list_;
     offset_type sector_offset_ = -1;
@@ -232,7 +242,7 @@ class segment_writer
     void _write_section_header (const std::string &, size_type);
     void _write_section_data (const mobius::core::bytearray &);
     bool _can_write_chunk_data ();
-    void _write_chunk_data (mobius::core::bytearray);
+    void _write_chunk_data (const chunk &);
     void _write_sectors_stub ();
     void _close_sectors_section ();
 };
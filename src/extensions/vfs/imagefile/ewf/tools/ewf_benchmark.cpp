@@ -0,0 +1,214 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "../imagefile_impl.hpp"
+#include "../reader_impl.hpp"
+#include <iostream>
+#include <memory>
+#include <mobius/core/application.hpp>
+#include <mobius/core/benchmark.hpp>
+#include <mobius/core/io/file.hpp>
+#include <random>
+#include <string>
+#include <unistd.h>
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief show usage text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+usage ()
+{
+    std::cerr << std::endl;
+    std::cerr << "use: ewf_benchmark [OPTIONS] <URL>" << std::endl;
+    std::cerr << "e.g: ewf_benchmark -p 32 file://disk.E01" << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "options are:" << std::endl;
+    std::cerr << "  -b block size in bytes (default: 65536)" << std::endl;
+    std::cerr << "  -c chunks kept in cache (default: "
+              << reader_impl::DEFAULT_CACHE_CHUNKS << ")" << std::endl;
+    std::cerr << "  -p chunks to read ahead (default: "
+              << reader_impl::DEFAULT_PREFETCH_CHUNKS << ", 0 = off)"
+              << std::endl;
+    std::cerr << "  -t prefetch worker threads (default: one per core)"
+              << std::endl;
+    std::cerr << "  -n number of random reads (default: 10000)" << std::endl;
+    std::cerr << std::endl;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Show cache statistics
+// @param r Reader implementation
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+show_cache_stats (const reader_impl &r)
+{
+    std::cout << "   cache hits: " << r.get_cache_hits ()
+              << ", misses: " << r.get_cache_misses () << std::endl;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief main function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main (int argc, char **argv)
+{
+    mobius::core::application app;
+    std::cerr << app.get_name () << " v" << app.get_version () << std::endl;
+    std::cerr << app.get_copyright () << std::endl;
+    std::cerr << "EWF reader benchmark v1.0" << std::endl;
+    std::cerr << "by Eduardo Aguiar" << std::endl;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // parse command line
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    int opt;
+    std::uint64_t block_size = 65536;
+    std::uint64_t cache_chunks = reader_impl::DEFAULT_CACHE_CHUNKS;
+    std::uint64_t prefetch_chunks = reader_impl::DEFAULT_PREFETCH_CHUNKS;
+    unsigned int workers = 0;
+    std::uint64_t random_reads = 10000;
+
+    while ((opt = getopt (argc, argv, "b:c:hn:p:t:")) != EOF)
+    {
+        switch (opt)
+        {
+        case 'b':
+            block_size = std::stoull (optarg);
+            break;
+
+        case 'c':
+            cache_chunks = std::stoull (optarg);
+            break;
+
+        case 'h':
+            usage ();
+            exit (EXIT_SUCCESS);
+            break;
+
+        case 'n':
+            random_reads = std::stoull (optarg);
+            break;
+
+        case 'p':
+            prefetch_chunks = std::stoull (optarg);
+            break;
+
+        case 't':
+            workers = std::stoul (optarg);
+            break;
+
+        default:
+            usage ();
+            exit (EXIT_FAILURE);
+        }
+    }
+
+    if (optind >= argc)
+    {
+        std::cerr << std::endl;
+        std::cerr << "Error: you must enter a valid URL to an imagefile"
+                  << std::endl;
+        usage ();
+        exit (EXIT_FAILURE);
+    }
+
+    if (block_size == 0)
+    {
+        std::cerr << std::endl;
+        std::cerr << "Error: block size must be greater than zero" << std::endl;
+        usage ();
+        exit (EXIT_FAILURE);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // open imagefile
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    auto f = mobius::core::io::new_file_by_url (argv[optind]);
+
+    if (!imagefile_impl::is_instance (f))
+    {
+        std::cerr << std::endl;
+        std::cerr << "Error: " << argv[optind] << " is not an EWF imagefile"
+                  << std::endl;
+        exit (EXIT_FAILURE);
+    }
+
+    imagefile_impl impl (f);
+    auto size = impl.get_size ();
+
+    std::cout << std::endl;
+    std::cout << "size: " << size << " bytes" << std::endl;
+    std::cout << "chunk size: " << impl.get_chunk_size () << " bytes"
+              << std::endl;
+    std::cout << "chunks: " << impl.get_chunk_count () << std::endl;
+    std::cout << std::endl;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // sequential read, without and with read ahead
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    for (auto prefetch : {std::uint64_t (0), prefetch_chunks})
+    {
+        reader_impl r (impl, cache_chunks, prefetch, workers);
+        std::uint64_t count = 0;
+
+        mobius::core::benchmark b ("sequential read (prefetch = " +
+                                   std::to_string (prefetch) + ")");
+
+        while (!r.eof ())
+        {
+            auto data = r.read (block_size);
+
+            if (data.empty ())
+                break;
+
+            count += data.size ();
+        }
+
+        b.end (count);
+        show_cache_stats (r);
+
+        if (prefetch_chunks == 0)
+            break;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // random read, with uniform and localized offsets
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::mt19937_64 rng (0);
+
+    for (auto window : {size, cache_chunks * impl.get_chunk_size () / 2})
+    {
+        window = std::max<std::uint64_t> (std::min (window, size), 1);
+        std::uniform_int_distribution<std::uint64_t> dist (0, window - 1);
+        reader_impl r (impl, cache_chunks, prefetch_chunks, workers);
+        std::uint64_t count = 0;
+
+        mobius::core::benchmark b ("random read (window = " +
+                                   std::to_string (window) + " bytes)");
+
+        for (std::uint64_t i = 0; i < random_reads; i++)
+        {
+            r.seek (dist (rng), reader_impl::whence_type::beginning);
+            count += r.read (block_size).size ();
+        }
+
+        b.end (count);
+        show_cache_stats (r);
+    }
+
+    return EXIT_SUCCESS;
+}
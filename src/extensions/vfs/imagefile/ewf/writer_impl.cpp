@@ -16,6 +16,9 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "writer_impl.hpp"
+#include <algorithm>
+#include <cstring>
+#include <memory>
 #include <mobius/core/exception.inc>
 #include <mobius/core/io/file.hpp>
 #include <mobius/core/io/uri.hpp>
@@ -27,6 +30,27 @@
 static constexpr int SECTOR_SIZE = 512;
 static constexpr int CHUNK_SECTORS = 64;
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Max number of chunks being compressed, per compression thread
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static constexpr int PENDING_CHUNKS_PER_THREAD = 4;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of compression threads
+// @param impl imagefile implementation object
+// @return "compression_threads" attribute, if set, or one per core
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static unsigned int
+get_compression_threads (const imagefile_impl &impl)
+{
+    auto threads = impl.get_attribute ("compression_threads");
+
+    if (threads.is_integer () && std::int64_t (threads) > 0)
+        return std::int64_t (threads);
+
+    return mobius::core::get_hardware_threads ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Constructor
 // @param imagefile_impl imagefile implementation object
@@ -39,8 +63,14 @@ writer_impl::writer_impl (const imagefile_impl &imagefile_impl)
       compression_level_ (
           std::int64_t (imagefile_impl.get_attribute ("compression_level"))),
       segments_ (imagefile_impl.get_segment_array ()),
-      hash_ ("md5")
+      hash_ ("md5"),
+      hash_pool_ (1),
+      compression_pool_ (
+          compression_level_ ? get_compression_threads (imagefile_impl) : 1)
 {
+    max_pending_chunks_ =
+        compression_pool_.get_size () * PENDING_CHUNKS_PER_THREAD;
+
     // validate segment size. The segment size must be at least large enough
     // to store a chunk of data.
     constexpr size_type SECTION_HEADER_SIZE = 76;
@@ -105,6 +135,13 @@ writer_impl::~writer_impl ()
         write (mobius::core::bytearray (pad_size));
     }
 
+    // write remaining chunks
+    if (!chunk_data_.empty ())
+        _submit_chunk (std::move (chunk_data_));
+
+    _commit_pending_chunks (0);
+    hash_pool_.wait ();
+
     // close segments
     for (auto &sw : segment_writer_list_)
     {
@@ -132,34 +169,40 @@ writer_impl::seek (offset_type, whence_type)
 // @brief Write bytes to stream
 // @param data Data
 // @return Number of bytes written
+//
+// Data is split into chunks, which are compressed by the compression pool.
+// Compressed chunks are written in order, so the output is the same as if
+// they were compressed one at a time.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 writer_impl::size_type
 writer_impl::write (const mobius::core::bytearray &data)
 {
-    mobius::core::bytearray buffer = data;
+    // update hash on its own thread
+    auto hash_data = std::make_shared<const mobius::core::bytearray> (data);
+    hash_pool_.submit ([this, hash_data] { hash_.update (*hash_data); });
 
-    while (!buffer.empty ())
-    {
-        auto &segment_writer = _get_current_segment_writer ();
+    // split data into chunks
+    size_type pos = 0;
 
-        auto bytes_written = segment_writer.write (buffer);
-        size_ += bytes_written;
+    while (pos < data.size ())
+    {
+        size_type count =
+            std::min (chunk_size_ - chunk_data_.size (), data.size () - pos);
+        size_type chunk_pos = chunk_data_.size ();
 
-        if (bytes_written == buffer.size ())
-            buffer.clear ();
+        chunk_data_.resize (chunk_pos + count);
+        std::memcpy (chunk_data_.data () + chunk_pos, data.data () + pos,
+                     count);
+        pos += count;
 
-        else
+        if (chunk_data_.size () == chunk_size_)
         {
-            // discard bytes already written
-            buffer = buffer.slice (bytes_written, buffer.size () - 1);
-
-            // create next segment file
-            auto &new_segment_writer = _new_segment_writer ();
-            new_segment_writer.create ();
+            _submit_chunk (std::move (chunk_data_));
+            chunk_data_ = {};
         }
     }
 
-    hash_.update (data);
+    size_ += data.size ();
     return data.size ();
 }
 
@@ -169,10 +212,85 @@ writer_impl::write (const mobius::core::bytearray &data)
 void
 writer_impl::flush ()
 {
+    _commit_pending_chunks (0);
+
     auto &segment_writer = _get_current_segment_writer ();
     segment_writer.flush ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Submit chunk to be compressed
+// @param data Chunk data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+writer_impl::_submit_chunk (mobius::core::bytearray &&data)
+{
+    // no compression: encode chunk on this thread
+    if (!compression_level_)
+    {
+        _commit_chunk (segment_writer::encode_chunk (data, 0));
+        return;
+    }
+
+    // compress chunk on compression pool
+    auto promise = std::make_shared<std::promise<segment_writer::chunk>> ();
+    auto chunk_data =
+        std::make_shared<const mobius::core::bytearray> (std::move (data));
+    int compression_level = compression_level_;
+
+    pending_chunks_.push_back (promise->get_future ());
+
+    compression_pool_.submit (
+        [promise, chunk_data, compression_level]
+        {
+            try
+            {
+                promise->set_value (segment_writer::encode_chunk (
+                    *chunk_data, compression_level));
+            }
+            catch (...)
+            {
+                promise->set_exception (std::current_exception ());
+            }
+        });
+
+    // keep pipeline bounded
+    _commit_pending_chunks (max_pending_chunks_);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Write pending chunks, in order, until at most max chunks remain
+// @param max Max number of pending chunks
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+writer_impl::_commit_pending_chunks (size_type max)
+{
+    while (pending_chunks_.size () > max)
+    {
+        auto c = pending_chunks_.front ().get ();
+        pending_chunks_.pop_front ();
+        _commit_chunk (c);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Write encoded chunk, creating next segment file if necessary
+// @param c Encoded chunk
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+writer_impl::_commit_chunk (const segment_writer::chunk &c)
+{
+    if (_get_current_segment_writer ().write_chunk (c))
+        return;
+
+    auto &new_segment_writer = _new_segment_writer ();
+    new_segment_writer.create ();
+
+    if (!new_segment_writer.write_chunk (c))
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG ("error writing chunk data"));
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Create new segment file
 // @return Reference to current segment writer
@@ -20,8 +20,11 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "imagefile_impl.hpp"
 #include "segment_writer.hpp"
+#include <deque>
+#include <future>
 #include <mobius/core/crypt/hash.hpp>
 #include <mobius/core/io/writer_impl_base.hpp>
+#include <mobius/core/thread_pool.hpp>
 #include <mobius/core/vfs/segment_array.hpp>
 #include <vector>
 
@@ -88,12 +91,23 @@ class writer_impl : public mobius::core::io::writer_impl_base
     mobius::core::bytearray guid_;   // imagefile GUID
     mobius::core::crypt::hash hash_; // hash function for data written
 
+    // pipeline: chunks are compressed in parallel by compression_pool_,
+    // committed in order to the current segment and hashed by hash_pool_
+    mobius::core::bytearray chunk_data_; // incomplete chunk data
+    std::deque<std::future<segment_writer::chunk>> pending_chunks_;
+    size_type max_pending_chunks_ = 0;
+    mobius::core::thread_pool hash_pool_;
+    mobius::core::thread_pool compression_pool_;
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Private prototypes
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     std::string _get_next_extension (const std::string &) const;
     segment_writer &_new_segment_writer ();
     segment_writer &_get_current_segment_writer ();
+    void _submit_chunk (mobius::core::bytearray &&);
+    void _commit_chunk (const segment_writer::chunk &);
+    void _commit_pending_chunks (size_type);
 };
 
 #endif
@@ -19,6 +19,7 @@
 #include "imagefile_impl.hpp"
 #include <mobius/core/exception.inc>
 #include <mobius/core/io/file.hpp>
+#include <cstring>
 #include <stdexcept>
 
 namespace
@@ -74,19 +75,19 @@ reader_impl_aes::seek (offset_type offset, whence_type w)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief read bytes from reader
+// @brief read bytes from reader into buffer
+// @param buffer buffer, with at least size bytes
 // @param size size in bytes
-// @return bytearray containing data
+// @return number of bytes read
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-mobius::core::bytearray
-reader_impl_aes::read (size_type size)
+reader_impl_aes::size_type
+reader_impl_aes::read_into (std::uint8_t *buffer, size_type size)
 {
-    mobius::core::bytearray data;
-
     size = std::min (size_ - pos_, size);
     constexpr int CHUNK_SIZE = 512;
+    size_type count = 0;
 
-    while (size > 0)
+    while (count < size)
     {
         size_type chunk_idx = pos_ / CHUNK_SIZE;
 
@@ -98,12 +99,17 @@ reader_impl_aes::read (size_type size)
         }
 
         size_type slice_start = pos_ % CHUNK_SIZE;
-        size_type slice_end =
-            std::min (slice_start + size - 1, chunk_data_.size () - 1);
-        data += chunk_data_.slice (slice_start, slice_end);
-        pos_ += slice_end - slice_start + 1;
-        size -= slice_end - slice_start + 1;
+
+        if (slice_start >= chunk_data_.size ())
+            break;
+
+        size_type slice_size =
+            std::min (size - count, chunk_data_.size () - slice_start);
+        std::memcpy (buffer + count, chunk_data_.data () + slice_start,
+                     slice_size);
+        pos_ += slice_size;
+        count += slice_size;
     }
 
-    return data;
+    return count;
 }
@@ -97,7 +97,13 @@ class reader_impl_aes : public mobius::core::io::reader_impl_base
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // virtual methods
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    mobius::core::bytearray read (size_type) override;
+    mobius::core::bytearray
+    read (size_type size) override
+    {
+        return _read_using_read_into (size);
+    }
+
+    size_type read_into (std::uint8_t *, size_type) override;
     void seek (offset_type, whence_type = whence_type::beginning) override;
 
   private:
@@ -17,6 +17,7 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "reader_impl.hpp"
 #include "imagefile_impl.hpp"
+#include <algorithm>
 #include <mobius/core/exception.inc>
 #include <mobius/core/string_functions.hpp>
 #include <stdexcept>
@@ -77,30 +78,70 @@ reader_impl::seek (offset_type offset, whence_type w)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Read bytes from reader
+// @brief Read bytes from reader into buffer
+// @param buffer buffer, with at least size bytes
 // @param size size in bytes
-// @return bytearray containing data
+// @return number of bytes read
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-mobius::core::bytearray
-reader_impl::read (size_type size)
+reader_impl::size_type
+reader_impl::read_into (std::uint8_t *buffer, size_type size)
 {
     if (!stream_)
         _set_stream ();
 
-    mobius::core::bytearray data = stream_.read (size);
-    pos_ += data.size ();
-    size -= data.size ();
+    size_type count = stream_.read_into (buffer, size);
+    pos_ += count;
 
-    while (size > 0 && pos_ < size_)
+    while (count < size && pos_ < size_)
     {
         _set_stream ();
-        mobius::core::bytearray tmp = stream_.read (size);
-        pos_ += tmp.size ();
-        size -= tmp.size ();
-        data += tmp;
+        size_type bytes = stream_.read_into (buffer + count, size - count);
+
+        if (bytes == 0)
+            break;
+
+        pos_ += bytes;
+        count += bytes;
+    }
+
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from a given position into buffer
+// @param offset offset in bytes from the beginning of data
+// @param buffer buffer, with at least size bytes
+// @param size size in bytes
+// @return number of bytes read
+//
+// Segment readers used by read_at are kept open and shared by all calls, so
+// this function does not change read position and is thread-safe, as long
+// as segment readers support read_at.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+reader_impl::size_type
+reader_impl::read_at (size_type offset, std::uint8_t *buffer, size_type size)
+{
+    size_type count = 0;
+
+    while (count < size && offset + count < size_)
+    {
+        size_type pos = offset + count;
+        size_type segment_idx = pos / segment_size_;
+        size_type segment_pos = pos % segment_size_;
+        size_type segment_count =
+            std::min (size - count, segment_size_ - segment_pos);
+
+        auto reader = _get_segment_reader (segment_idx);
+        size_type bytes =
+            reader.read_at (segment_pos, buffer + count, segment_count);
+
+        if (bytes == 0)
+            break;
+
+        count += bytes;
     }
 
-    return data;
+    return count;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -123,3 +164,22 @@ reader_impl::_set_stream ()
 
     stream_.seek (pos);
 }
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get segment reader, used by read_at
+// @param segment_idx Segment index
+// @return Reader
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::io::reader
+reader_impl::_get_segment_reader (size_type segment_idx)
+{
+    std::lock_guard<std::mutex> lock (readers_mutex_);
+
+    if (segment_idx >= readers_.size ())
+        readers_.resize (segment_idx + 1);
+
+    if (!readers_[segment_idx])
+        readers_[segment_idx] = segments_.new_reader (segment_idx);
+
+    return readers_[segment_idx];
+}
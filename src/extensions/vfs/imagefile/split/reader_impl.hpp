@@ -21,6 +21,8 @@
 #include <mobius/core/io/reader.hpp>
 #include <mobius/core/io/reader_impl_base.hpp>
 #include <mobius/core/vfs/segment_array.hpp>
+#include <mutex>
+#include <vector>
 
 class imagefile_impl;
 
@@ -96,7 +98,14 @@ class reader_impl : public mobius::core::io::reader_impl_base
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Virtual methods
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    mobius::core::bytearray read (size_type) override;
+    mobius::core::bytearray
+    read (size_type size) override
+    {
+        return _read_using_read_into (size);
+    }
+
+    size_type read_into (std::uint8_t *, size_type) override;
+    size_type read_at (size_type, std::uint8_t *, size_type) override;
     void seek (offset_type, whence_type = whence_type::beginning) override;
 
   private:
@@ -108,7 +117,11 @@ class reader_impl : public mobius::core::io::reader_impl_base
     mobius::core::vfs::segment_array segments_; // segment files
     mobius::core::io::reader stream_;           // current stream
 
+    std::vector<mobius::core::io::reader> readers_; // read_at segment readers
+    std::mutex readers_mutex_;
+
     void _set_stream ();
+    mobius::core::io::reader _get_segment_reader (size_type);
 };
 
 #endif
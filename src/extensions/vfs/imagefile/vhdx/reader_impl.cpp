@@ -18,6 +18,7 @@
 #include "reader_impl.hpp"
 #include "imagefile_impl.hpp"
 #include <mobius/core/exception.inc>
+#include <cstring>
 #include <stdexcept>
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -67,36 +68,41 @@ reader_impl::seek (offset_type offset, whence_type w)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Read bytes from reader
+// @brief Read bytes from reader into buffer
+// @param buffer buffer, with at least size bytes
 // @param size size in bytes
-// @return Data
+// @return number of bytes read
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-mobius::core::bytearray
-reader_impl::read (size_type size)
+reader_impl::size_type
+reader_impl::read_into (std::uint8_t *buffer, size_type size)
 {
-    mobius::core::bytearray data;
     size = std::min (size_ - pos_, size);
+    size_type count = 0;
 
-    while (size > 0)
+    while (count < size)
     {
         std::uint32_t block_idx = pos_ / block_size_;
         std::uint32_t block_pos = pos_ % block_size_; // data pos inside block
         std::uint64_t sector_offset = block_allocation_table_[block_idx];
-        std::uint64_t data_size = std::min (size, block_size_ - block_pos);
+        std::uint64_t data_size =
+            std::min (size - count, block_size_ - block_pos);
 
         if (sector_offset == 0)
-            data += mobius::core::bytearray (data_size);
+            std::memset (buffer + count, 0, data_size);
 
         else
         {
             std::uint64_t offset = sector_offset + block_pos;
             reader_.seek (offset);
-            data += reader_.read (data_size);
+            data_size = reader_.read_into (buffer + count, data_size);
+
+            if (data_size == 0)
+                break;
         }
 
-        size -= data_size;
+        count += data_size;
         pos_ += data_size;
     }
 
-    return data;
+    return count;
 }
@@ -15,6 +15,7 @@
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
 #include <iostream>
 #include <mobius/core/benchmark.hpp>
 
@@ -22,14 +23,19 @@ namespace mobius::core
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief constructor
+// @param title Benchmark title
+// @param unit Unit name
+// @param out Output stream
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-benchmark::benchmark (const std::string &title, const std::string &unit)
+benchmark::benchmark (const std::string &title, const std::string &unit,
+                      std::ostream &out)
     : title_ (title),
       unit_ (unit),
-      start_ (std::chrono::high_resolution_clock::now ())
+      start_ (std::chrono::high_resolution_clock::now ()),
+      out_ (&out)
 {
     std::size_t dots = title_.length () > 60 ? 0 : 60 - title_.length ();
-    std::cout << "\033[1;39m" << title_ << "\033[0m " << std::string (dots, '.')
+    *out_ << "\033[1;39m" << title_ << "\033[0m " << std::string (dots, '.')
               << std::flush;
 }
 
@@ -52,9 +58,9 @@ benchmark::mtime () const
 void
 benchmark::end (std::uint64_t count)
 {
-    std::uint64_t time_ms = mtime ();
+    std::uint64_t time_ms = std::max<std::uint64_t> (mtime (), 1);
 
-    double throughput = double (count) / (double (time_ms) / 100.0);
+    double throughput = double (count) / (double (time_ms) / 1000.0);
     const std::string units[] = {"", "K", "M", "G", "T"};
     int unit_idx = 0;
 
@@ -64,7 +70,7 @@ benchmark::end (std::uint64_t count)
         unit_idx++;
     }
 
-    std::cout << " \033[1;32m" << throughput << ' ' << units[unit_idx] << unit_
+    *out_ << " \033[1;32m" << throughput << ' ' << units[unit_idx] << unit_
               << "/s\033[0m" << std::endl;
 }
 
@@ -15,12 +15,264 @@
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
 #include <iconv.h>
 #include <memory>
 #include <mobius/core/charset.hpp>
 #include <mobius/core/exception_posix.inc>
 #include <mobius/core/string_functions.hpp>
+#include <cstdint>
 #include <stdexcept>
+#include <unordered_map>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Cache of iconv descriptors
+//
+// iconv_open is expensive (it may load gconv modules), so descriptors are
+// opened once per charset pair and kept until the thread exits. Each thread
+// has its own cache, as iconv descriptors cannot be shared among threads.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class iconv_cache
+{
+  public:
+    iconv_cache () = default;
+    iconv_cache (const iconv_cache &) = delete;
+    iconv_cache &operator= (const iconv_cache &) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Destructor
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    ~iconv_cache ()
+    {
+        for (const auto &[key, cd] : descriptors_)
+            iconv_close (cd);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get descriptor, in its initial state
+    // @param f_charset From charset (uppercase)
+    // @param t_charset To charset (uppercase)
+    // @return iconv descriptor
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    iconv_t
+    get (const std::string &f_charset, const std::string &t_charset)
+    {
+        const std::string key = f_charset + '\n' + t_charset;
+        auto iter = descriptors_.find (key);
+
+        if (iter != descriptors_.end ())
+        {
+            ::iconv (iter->second, nullptr, nullptr, nullptr, nullptr);
+            return iter->second;
+        }
+
+        iconv_t cd = iconv_open (t_charset.c_str (), f_charset.c_str ());
+
+        if (cd == (iconv_t) -1)
+            throw std::invalid_argument (MOBIUS_EXCEPTION_POSIX);
+
+        descriptors_.emplace (key, cd);
+        return cd;
+    }
+
+  private:
+    // @brief Descriptors, by "from\nto" charset pair
+    std::unordered_map<std::string, iconv_t> descriptors_;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get cached iconv descriptor for current thread
+// @param f_charset From charset (uppercase)
+// @param t_charset To charset (uppercase)
+// @return iconv descriptor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static iconv_t
+_get_descriptor (const std::string &f_charset, const std::string &t_charset)
+{
+    thread_local iconv_cache cache;
+    return cache.get (f_charset, t_charset);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if charset maps bytes 0x00-0x7f to ASCII characters
+// @param charset Charset (uppercase)
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_is_ascii_compatible (const std::string &charset)
+{
+    return charset == "ASCII" || charset == "US-ASCII" ||
+           charset == "LATIN1" || charset == "CP437" || charset == "CP850" ||
+           mobius::core::string::startswith (charset, "ISO-8859-") ||
+           mobius::core::string::startswith (charset, "CP125") ||
+           mobius::core::string::startswith (charset, "WINDOWS-125");
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if data has only ASCII characters
+// @param data Data
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_is_ascii (const mobius::core::bytearray &data)
+{
+    const std::uint8_t *p = data.data ();
+    const std::size_t size = data.size ();
+    std::size_t i = 0;
+
+#if defined(__SSE2__)
+    for (; i + 16 <= size; i += 16)
+    {
+        __m128i v = _mm_loadu_si128 (reinterpret_cast<const __m128i *> (p + i));
+
+        if (_mm_movemask_epi8 (v))
+            return false;
+    }
+#endif
+
+    for (; i < size; i++)
+    {
+        if (p[i] & 0x80)
+            return false;
+    }
+
+    return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert UTF-16LE data to UTF-8, without iconv
+// @param data UTF-16LE data
+// @param out Output string
+// @return true if data has been converted, false if it is not well formed
+//
+// Runs of ASCII characters are converted 16 characters at a time. Odd sizes
+// and unpaired surrogates return false, so the caller can fall back to iconv
+// and keep its behavior for malformed input.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_utf16le_to_utf8 (const mobius::core::bytearray &data, std::string &out)
+{
+    if (data.size () % 2)
+        return false;
+
+    const std::uint8_t *p = data.data ();
+    const std::size_t count = data.size () / 2;
+
+    out.resize (count * 3);
+    char *q = out.data ();
+    std::size_t i = 0;
+
+    while (i < count)
+    {
+#if defined(__SSE2__)
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // ASCII runs
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        const __m128i mask = _mm_set1_epi16 (static_cast<short> (0xff80));
+        const __m128i zero = _mm_setzero_si128 ();
+
+        while (i + 16 <= count)
+        {
+            __m128i a =
+                _mm_loadu_si128 (reinterpret_cast<const __m128i *> (p + i * 2));
+            __m128i b = _mm_loadu_si128 (
+                reinterpret_cast<const __m128i *> (p + i * 2 + 16));
+            __m128i high = _mm_and_si128 (_mm_or_si128 (a, b), mask);
+
+            if (_mm_movemask_epi8 (_mm_cmpeq_epi16 (high, zero)) != 0xffff)
+                break;
+
+            _mm_storeu_si128 (reinterpret_cast<__m128i *> (q),
+                              _mm_packus_epi16 (a, b));
+            q += 16;
+            i += 16;
+        }
+#endif
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // Other characters
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        const std::size_t end = std::min<std::size_t> (count, i + 16);
+
+        while (i < end)
+        {
+            std::uint32_t c = p[i * 2] | (std::uint32_t (p[i * 2 + 1]) << 8);
+            i++;
+
+            if (c < 0x80)
+                *q++ = char (c);
+
+            else if (c < 0x800)
+            {
+                *q++ = char (0xc0 | (c >> 6));
+                *q++ = char (0x80 | (c & 0x3f));
+            }
+
+            else if (c >= 0xd800 && c <= 0xdbff)
+            {
+                if (i >= count)
+                    return false;
+
+                std::uint32_t c2 = p[i * 2] | (std::uint32_t (p[i * 2 + 1]) << 8);
+
+                if (c2 < 0xdc00 || c2 > 0xdfff)
+                    return false;
+
+                i++;
+                c = 0x10000 + ((c - 0xd800) << 10) + (c2 - 0xdc00);
+
+                *q++ = char (0xf0 | (c >> 18));
+                *q++ = char (0x80 | ((c >> 12) & 0x3f));
+                *q++ = char (0x80 | ((c >> 6) & 0x3f));
+                *q++ = char (0x80 | (c & 0x3f));
+            }
+
+            else if (c >= 0xdc00 && c <= 0xdfff)
+                return false;
+
+            else
+            {
+                *q++ = char (0xe0 | (c >> 12));
+                *q++ = char (0x80 | ((c >> 6) & 0x3f));
+                *q++ = char (0x80 | (c & 0x3f));
+            }
+        }
+    }
+
+    out.resize (q - out.data ());
+    return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert data to UTF-8 without iconv, if possible
+// @param data Data
+// @param charset Charset (uppercase)
+// @param out Output string
+// @return true if data has been converted, false otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_fast_conv_to_utf8 (const mobius::core::bytearray &data,
+                    const std::string &charset, std::string &out)
+{
+    if (charset == "UTF-16LE")
+        return _utf16le_to_utf8 (data, out);
+
+    if (_is_ascii_compatible (charset) && _is_ascii (data))
+    {
+        out = data.to_string ();
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace
 
 namespace mobius::core
 {
@@ -39,18 +291,19 @@ conv_charset_to_utf8 (const mobius::core::bytearray &data,
     if (u_charset == "UTF-8" || u_charset == "UTF8")
         return data.to_string ();
 
-    else
-    {
-        bytearray output = conv_charset (data, u_charset, "UTF-8");
+    std::string output;
 
-        // strip trailings '\0'
-        auto size = output.size ();
-        while (size > 0 && output[size - 1] == '\0')
-            --size;
+    if (!_fast_conv_to_utf8 (data, u_charset, output))
+        output = conv_charset (data, u_charset, "UTF-8").to_string ();
 
-        return std::string (reinterpret_cast<const char *> (output.data ()),
-                            size);
-    }
+    // strip trailings '\0'
+    auto size = output.size ();
+    while (size > 0 && output[size - 1] == '\0')
+        --size;
+
+    output.resize (size);
+
+    return output;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -68,11 +321,13 @@ conv_charset_to_utf8_partial (const mobius::core::bytearray &data,
     if (u_charset == "UTF-8" || u_charset == "UTF8")
         return std::make_pair (data.to_string (), mobius::core::bytearray ());
 
-    else
-    {
-        auto p = conv_charset_partial (data, u_charset, "UTF-8");
-        return std::make_pair (p.first.to_string (), p.second);
-    }
+    std::string output;
+
+    if (_fast_conv_to_utf8 (data, u_charset, output))
+        return std::make_pair (output, mobius::core::bytearray ());
+
+    auto p = conv_charset_partial (data, u_charset, "UTF-8");
+    return std::make_pair (p.first.to_string (), p.second);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -86,13 +341,10 @@ mobius::core::bytearray
 conv_charset (const mobius::core::bytearray &data, const std::string &f_charset,
               const std::string &t_charset)
 {
-    // allocate descriptor
+    // get descriptor
     const std::string uf_charset = mobius::core::string::toupper (f_charset);
     const std::string ut_charset = mobius::core::string::toupper (t_charset);
-    iconv_t cd = iconv_open (ut_charset.c_str (), uf_charset.c_str ());
-
-    if (cd == (iconv_t) -1)
-        throw std::invalid_argument (MOBIUS_EXCEPTION_POSIX);
+    iconv_t cd = _get_descriptor (uf_charset, ut_charset);
 
     // convert data
     mobius::core::bytearray out;
@@ -113,9 +365,6 @@ conv_charset (const mobius::core::bytearray &data, const std::string &f_charset,
             p_out - outbuf.get ());
     }
 
-    // deallocate descriptor
-    iconv_close (cd);
-
     return out;
 }
 
@@ -131,13 +380,10 @@ conv_charset_partial (const mobius::core::bytearray &data,
                       const std::string &f_charset,
                       const std::string &t_charset)
 {
-    // allocate descriptor
+    // get descriptor
     const std::string uf_charset = mobius::core::string::toupper (f_charset);
     const std::string ut_charset = mobius::core::string::toupper (t_charset);
-    iconv_t cd = iconv_open (ut_charset.c_str (), uf_charset.c_str ());
-
-    if (cd == (iconv_t) -1)
-        throw std::invalid_argument (MOBIUS_EXCEPTION_POSIX);
+    iconv_t cd = _get_descriptor (uf_charset, ut_charset);
 
     // convert data
     mobius::core::bytearray out;
@@ -163,9 +409,6 @@ conv_charset_partial (const mobius::core::bytearray &data,
                 (char *) data.end () - inbuf);
     }
 
-    // deallocate descriptor
-    iconv_close (cd);
-
     return std::make_pair (out, rest);
 }
 
@@ -16,6 +16,12 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/crypt/crc32.hpp>
+#include <array>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MOBIUS_CRC32_PCLMUL 1
+#endif
 
 namespace
 {
@@ -67,6 +73,207 @@ static constexpr std::uint32_t CRCTAB[256] = {
     0x54de5729, 0x23d967bf, 0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
     0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d};
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create slicing-by-8 tables
+// @return Tables
+//
+// Table k holds the CRC-32 of byte i followed by k zero bytes, so eight
+// bytes can be processed at once with eight independent table lookups.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static constexpr std::array<std::array<std::uint32_t, 256>, 8>
+_make_slicing_tables ()
+{
+    std::array<std::array<std::uint32_t, 256>, 8> tables = {};
+
+    for (int i = 0; i < 256; i++)
+        tables[0][i] = CRCTAB[i];
+
+    for (int k = 1; k < 8; k++)
+        for (int i = 0; i < 256; i++)
+            tables[k][i] = (tables[k - 1][i] >> 8) ^
+                           CRCTAB[tables[k - 1][i] & 0xff];
+
+    return tables;
+}
+
+static constexpr auto CRCTABS = _make_slicing_tables ();
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Load 32-bit little endian value
+// @param p Pointer to data
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static inline std::uint32_t
+_load_le32 (const std::uint8_t *p) noexcept
+{
+    return std::uint32_t (p[0]) | (std::uint32_t (p[1]) << 8) |
+           (std::uint32_t (p[2]) << 16) | (std::uint32_t (p[3]) << 24);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Update CRC-32 using slicing-by-8 tables
+// @param value CRC-32 value
+// @param data Pointer to data
+// @param size Data size in bytes
+// @return New CRC-32 value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::uint32_t
+_crc32_slicing_by_8 (std::uint32_t value, const std::uint8_t *data,
+                     std::size_t size) noexcept
+{
+    while (size >= 8)
+    {
+        const std::uint32_t lo = _load_le32 (data) ^ value;
+        const std::uint32_t hi = _load_le32 (data + 4);
+
+        value = CRCTABS[7][lo & 0xff] ^ CRCTABS[6][(lo >> 8) & 0xff] ^
+                CRCTABS[5][(lo >> 16) & 0xff] ^ CRCTABS[4][lo >> 24] ^
+                CRCTABS[3][hi & 0xff] ^ CRCTABS[2][(hi >> 8) & 0xff] ^
+                CRCTABS[1][(hi >> 16) & 0xff] ^ CRCTABS[0][hi >> 24];
+
+        data += 8;
+        size -= 8;
+    }
+
+    while (size--)
+        value = (value >> 8) ^ CRCTAB[(value ^ *data++) & 0xff];
+
+    return value;
+}
+
+#ifdef MOBIUS_CRC32_PCLMUL
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Load 128-bit unaligned value
+// @param p Pointer to data
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+__attribute__ ((target ("pclmul,sse4.1"))) static inline __m128i
+_load_128 (const std::uint8_t *p) noexcept
+{
+    return _mm_loadu_si128 (reinterpret_cast<const __m128i *> (p));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Fold 128-bit value x into y
+// @param x Value being folded
+// @param y Next 128-bit value
+// @param k Folding constants
+// @return Folded value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+__attribute__ ((target ("pclmul,sse4.1"))) static inline __m128i
+_fold_128 (__m128i x, __m128i y, __m128i k) noexcept
+{
+    const __m128i lo = _mm_clmulepi64_si128 (x, k, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128 (x, k, 0x11);
+
+    return _mm_xor_si128 (_mm_xor_si128 (hi, y), lo);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Update CRC-32 using carry-less multiplication (PCLMULQDQ)
+// @param value CRC-32 value
+// @param data Pointer to data
+// @param size Data size in bytes (>= 64 and multiple of 16)
+// @return New CRC-32 value
+// @see Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+//      Instruction" (2009)
+//
+// Data is folded 4 x 128 bits at a time, then folded to 128 bits and reduced
+// to 32 bits with Barrett reduction. Constants are for the reflected
+// polynomial 0xedb88320.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+__attribute__ ((target ("pclmul,sse4.1"))) static std::uint32_t
+_crc32_pclmul (std::uint32_t value, const std::uint8_t *data,
+               std::size_t size) noexcept
+{
+    const __m128i k1k2 = _mm_set_epi64x (0x01c6e41596, 0x0154442bd4);
+    const __m128i k3k4 = _mm_set_epi64x (0x00ccaa009e, 0x01751997d0);
+    const __m128i k5k0 = _mm_set_epi64x (0, 0x0163cd6124);
+    const __m128i poly = _mm_set_epi64x (0x01f7011641, 0x01db710641);
+    const __m128i mask32 = _mm_setr_epi32 (~0, 0, ~0, 0);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // fold 64 bytes at a time
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    __m128i x1 = _mm_xor_si128 (_load_128 (data), _mm_cvtsi32_si128 (value));
+    __m128i x2 = _load_128 (data + 16);
+    __m128i x3 = _load_128 (data + 32);
+    __m128i x4 = _load_128 (data + 48);
+
+    data += 64;
+    size -= 64;
+
+    while (size >= 64)
+    {
+        __m128i x5 = _mm_clmulepi64_si128 (x1, k1k2, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128 (x2, k1k2, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128 (x3, k1k2, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128 (x4, k1k2, 0x00);
+
+        x1 = _mm_clmulepi64_si128 (x1, k1k2, 0x11);
+        x2 = _mm_clmulepi64_si128 (x2, k1k2, 0x11);
+        x3 = _mm_clmulepi64_si128 (x3, k1k2, 0x11);
+        x4 = _mm_clmulepi64_si128 (x4, k1k2, 0x11);
+
+        x1 = _mm_xor_si128 (_mm_xor_si128 (x1, x5), _load_128 (data));
+        x2 = _mm_xor_si128 (_mm_xor_si128 (x2, x6), _load_128 (data + 16));
+        x3 = _mm_xor_si128 (_mm_xor_si128 (x3, x7), _load_128 (data + 32));
+        x4 = _mm_xor_si128 (_mm_xor_si128 (x4, x8), _load_128 (data + 48));
+
+        data += 64;
+        size -= 64;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // fold into 128 bits
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    x1 = _fold_128 (x1, x2, k3k4);
+    x1 = _fold_128 (x1, x3, k3k4);
+    x1 = _fold_128 (x1, x4, k3k4);
+
+    while (size >= 16)
+    {
+        x1 = _fold_128 (x1, _load_128 (data), k3k4);
+        data += 16;
+        size -= 16;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // fold 128 bits to 64 bits
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    x2 = _mm_clmulepi64_si128 (x1, k3k4, 0x10);
+    x1 = _mm_xor_si128 (_mm_srli_si128 (x1, 8), x2);
+
+    x2 = _mm_srli_si128 (x1, 4);
+    x1 = _mm_and_si128 (x1, mask32);
+    x1 = _mm_clmulepi64_si128 (x1, k5k0, 0x00);
+    x1 = _mm_xor_si128 (x1, x2);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Barrett reduction to 32 bits
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    x2 = _mm_and_si128 (x1, mask32);
+    x2 = _mm_clmulepi64_si128 (x2, poly, 0x10);
+    x2 = _mm_and_si128 (x2, mask32);
+    x2 = _mm_clmulepi64_si128 (x2, poly, 0x00);
+    x1 = _mm_xor_si128 (x1, x2);
+
+    return std::uint32_t (_mm_extract_epi32 (x1, 1));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if CPU supports PCLMULQDQ and SSE 4.1 instructions
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_has_pclmul () noexcept
+{
+    static const bool has_pclmul = __builtin_cpu_supports ("pclmul") &&
+                                   __builtin_cpu_supports ("sse4.1");
+    return has_pclmul;
+}
+#endif
+
 } // namespace
 
 namespace mobius::core::crypt
@@ -84,4 +291,44 @@ crc32 (std::uint32_t value, std::uint8_t b) noexcept
     return (value >> 8) ^ CRCTAB[(value ^ b) & 0xff];
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief update CRC-32 by a memory block
+// @param value CRC-32 value
+// @param data Pointer to data
+// @param size Data size in bytes
+// @return new CRC-32 value
+//
+// As with the one byte version, value is the raw CRC register. Callers
+// computing standard CRC-32 must start with 0xffffffff and invert the
+// result. PCLMULQDQ is used when supported by the CPU, otherwise data is
+// processed with slicing-by-8 tables.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint32_t
+crc32 (std::uint32_t value, const std::uint8_t *data, std::size_t size) noexcept
+{
+#ifdef MOBIUS_CRC32_PCLMUL
+    if (size >= 64 && _has_pclmul ())
+    {
+        const std::size_t n = size & ~std::size_t (15);
+        value = _crc32_pclmul (value, data, n);
+        data += n;
+        size -= n;
+    }
+#endif
+
+    return _crc32_slicing_by_8 (value, data, size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief update CRC-32 by a bytearray
+// @param value CRC-32 value
+// @param data Data
+// @return new CRC-32 value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint32_t
+crc32 (std::uint32_t value, const mobius::core::bytearray &data) noexcept
+{
+    return crc32 (value, data.data (), data.size ());
+}
+
 } // namespace mobius::core::crypt
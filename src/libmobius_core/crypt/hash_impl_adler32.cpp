@@ -16,16 +16,171 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/crypt/hash_impl_adler32.hpp>
-#include <numeric>
+#include <algorithm>
+#include <cstddef>
 
-namespace mobius::core::crypt
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace
 {
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// constants
-// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-constexpr std::uint64_t BLOCK_SIZE = 0x10000000; // max block size per iteration
-constexpr std::uint32_t BASE = 65521;            // mod value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static constexpr std::uint32_t BASE = 65521; // mod value
+
+// @brief Max bytes processed before b overflows 32 bits (see zlib)
+static constexpr std::size_t NMAX = 5552;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Update Adler-32 sums, portable version
+// @param a Sum of bytes
+// @param b Sum of a values
+// @param p Pointer to data
+// @param size Data size in bytes
+//
+// Original Adler-32 is:
+//
+//   for (std::uint8_t c : data)
+//     {
+//       a = (a + c) % BASE;
+//       b = (b + a) % BASE;
+//     }
+//
+// Modulo operations are deferred until NMAX bytes have been added, which
+// is the largest count that keeps b in 32 bits. The inner loop is unrolled
+// by 16 bytes.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+_update_generic (std::uint32_t &a, std::uint32_t &b, const std::uint8_t *p,
+                 std::size_t size) noexcept
+{
+    while (size > 0)
+    {
+        std::size_t n = std::min (size, NMAX);
+        size -= n;
+
+        while (n >= 16)
+        {
+            for (int i = 0; i < 16; i++)
+            {
+                a += p[i];
+                b += a;
+            }
+
+            p += 16;
+            n -= 16;
+        }
+
+        while (n--)
+        {
+            a += *p++;
+            b += a;
+        }
+
+        a %= BASE;
+        b %= BASE;
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Horizontal sum of 32-bit lanes
+// @param v Vector
+// @return Sum
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+__attribute__ ((target ("ssse3"))) static inline std::uint32_t
+_hsum_epi32 (__m128i v) noexcept
+{
+    v = _mm_add_epi32 (v, _mm_shuffle_epi32 (v, _MM_SHUFFLE (2, 3, 0, 1)));
+    v = _mm_add_epi32 (v, _mm_shuffle_epi32 (v, _MM_SHUFFLE (1, 0, 3, 2)));
+
+    return std::uint32_t (_mm_cvtsi128_si32 (v));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Update Adler-32 sums, SSSE3 version
+// @param a Sum of bytes
+// @param b Sum of a values
+// @param p Pointer to data
+// @param size Data size in bytes
+//
+// Data is processed in 32 byte blocks. For each block, a gets the sum of the
+// bytes (PSADBW) and b gets the bytes weighted by 32..1 (PMADDUBSW), plus
+// 32 times the value a had before the block.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+__attribute__ ((target ("ssse3"))) static void
+_update_ssse3 (std::uint32_t &a, std::uint32_t &b, const std::uint8_t *p,
+               std::size_t size) noexcept
+{
+    constexpr std::size_t BLOCK_SIZE = 32;
 
+    const __m128i tap1 = _mm_setr_epi8 (32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+                                        22, 21, 20, 19, 18, 17);
+    const __m128i tap2 = _mm_setr_epi8 (16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+                                        6, 5, 4, 3, 2, 1);
+    const __m128i zero = _mm_setzero_si128 ();
+    const __m128i ones = _mm_set1_epi16 (1);
+
+    std::size_t blocks = size / BLOCK_SIZE;
+    size -= blocks * BLOCK_SIZE;
+
+    while (blocks > 0)
+    {
+        std::size_t n = std::min (blocks, NMAX / BLOCK_SIZE);
+        blocks -= n;
+
+        __m128i v_ps = _mm_set_epi32 (0, 0, 0, int (a * n));
+        __m128i v_a = _mm_setzero_si128 ();
+        __m128i v_b = _mm_set_epi32 (0, 0, 0, int (b));
+
+        do
+        {
+            const __m128i bytes1 =
+                _mm_loadu_si128 (reinterpret_cast<const __m128i *> (p));
+            const __m128i bytes2 =
+                _mm_loadu_si128 (reinterpret_cast<const __m128i *> (p + 16));
+
+            v_ps = _mm_add_epi32 (v_ps, v_a);
+
+            v_a = _mm_add_epi32 (v_a, _mm_sad_epu8 (bytes1, zero));
+            v_b = _mm_add_epi32 (
+                v_b, _mm_madd_epi16 (_mm_maddubs_epi16 (bytes1, tap1), ones));
+
+            v_a = _mm_add_epi32 (v_a, _mm_sad_epu8 (bytes2, zero));
+            v_b = _mm_add_epi32 (
+                v_b, _mm_madd_epi16 (_mm_maddubs_epi16 (bytes2, tap2), ones));
+
+            p += BLOCK_SIZE;
+        }
+        while (--n);
+
+        v_b = _mm_add_epi32 (v_b, _mm_slli_epi32 (v_ps, 5));
+
+        a = (a + _hsum_epi32 (v_a)) % BASE;
+        b = _hsum_epi32 (v_b) % BASE;
+    }
+
+    _update_generic (a, b, p, size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if CPU supports SSSE3 instructions
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_has_ssse3 () noexcept
+{
+    static const bool has_ssse3 = __builtin_cpu_supports ("ssse3");
+    return has_ssse3;
+}
+#endif
+
+} // namespace
+
+namespace mobius::core::crypt
+{
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Reset hash value
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -40,46 +195,20 @@ hash_impl_adler32::reset () noexcept
 // @brief Update hash by a given bytearray
 // @param data Data buffer
 //
-// Original Adler-32 is:
-//
-//   for (std::uint8_t c : data)
-//     {
-//       a_ = (a_ + c) % BASE;
-//       b_ = (b_ + a_) % BASE;
-//     }
-//
-// I did some improvements:
-//
-//   1. if type (a) is large enough, a is sum (bytes) % BASE
-//
-//   2. b[1] = b[0] + a[1] = b[0] + a[0] + c[0]
-//      b[2] = b[1] + a[2] = b[0] + a[0] + c[0] + a[0] + c[0] + c[1]
-//      b[n] = b[n-1] + an = b[0] + a[0] * n + c[0] * n + c[1] * n-1 ... c[n] *
-//      1
-//
-//   3. The BLOCK_SIZE value assures that 64-bit values can hold a[n] and b[n]
+// SSSE3 version is used when supported by the CPU.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
 hash_impl_adler32::update (const mobius::core::bytearray &data) noexcept
 {
-    const std::uint8_t *p = data.begin ();
-    const std::uint64_t size = data.size ();
-
-    for (std::uint64_t i = 0; i < size; i += BLOCK_SIZE)
+#if defined(__x86_64__) || defined(__i386__)
+    if (_has_ssse3 ())
     {
-        std::uint64_t n = std::min (size - i, BLOCK_SIZE);
-        std::uint64_t b1 = b_ + a_ * n;
-        a_ = std::accumulate (p, p + n, std::uint64_t (a_)) % BASE;
-
-        while (n)
-        {
-            b1 += std::uint64_t (*p) * n;
-            n--;
-            p++;
-        }
-
-        b_ = b1 % BASE;
+        _update_ssse3 (a_, b_, data.data (), data.size ());
+        return;
     }
+#endif
+
+    _update_generic (a_, b_, data.data (), data.size ());
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
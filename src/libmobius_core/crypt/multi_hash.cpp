@@ -0,0 +1,411 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/crypt/multi_hash.hpp>
+#include <mobius/core/crypt/hash.hpp>
+#include <mobius/core/exception.inc>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+// @brief Max number of blocks waiting to be hashed
+static constexpr std::size_t MAX_PENDING_BLOCKS = 8;
+
+} // namespace
+
+namespace mobius::core::crypt
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Implementation class for multi_hash
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class multi_hash::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors and destructor
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit impl (const std::vector<std::string> &);
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+    ~impl ();
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get hash types
+    // @return Hash types
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::vector<std::string>
+    get_types () const
+    {
+        return types_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void update (std::shared_ptr<const mobius::core::bytearray>);
+    void reset ();
+    mobius::core::bytearray get_digest (const std::string &);
+    digest_list_type get_digests ();
+
+  private:
+    // @brief Hash types
+    std::vector<std::string> types_;
+
+    // @brief Hash objects, one per type
+    std::vector<hash> hashes_;
+
+    // @brief Worker threads, one per hash (empty if only one hash)
+    std::vector<std::thread> threads_;
+
+    // @brief Blocks not yet hashed by every worker
+    std::deque<std::shared_ptr<const mobius::core::bytearray>> blocks_;
+
+    // @brief Sequence number of blocks_.front ()
+    std::uint64_t first_seq_ = 0;
+
+    // @brief Sequence number of next block, for each worker
+    std::vector<std::uint64_t> next_seq_;
+
+    // @brief Mutex protecting the fields above
+    std::mutex mutex_;
+
+    // @brief Signals that a new block is available
+    std::condition_variable cv_block_;
+
+    // @brief Signals that a block has been released
+    std::condition_variable cv_release_;
+
+    // @brief Stop flag
+    bool stop_ = false;
+
+    // @brief First exception thrown by a worker, if any
+    std::exception_ptr exception_;
+
+    // Helper functions
+    void _run_worker (std::size_t);
+    void _wait ();
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param types Hash types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+multi_hash::impl::impl (const std::vector<std::string> &types)
+    : types_ (types),
+      next_seq_ (types.size (), 0)
+{
+    if (types.empty ())
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("at least one hash type must be given"));
+
+    for (const auto &type : types)
+        hashes_.emplace_back (type);
+
+    if (hashes_.size () > 1)
+    {
+        for (std::size_t i = 0; i < hashes_.size (); i++)
+            threads_.emplace_back (&impl::_run_worker, this, i);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Destructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+multi_hash::impl::~impl ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        stop_ = true;
+    }
+
+    cv_block_.notify_all ();
+
+    for (auto &t : threads_)
+        t.join ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Update hashes with data block
+// @param block Data block
+//
+// Blocks until there is room in the queue for a new block.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+multi_hash::impl::update (std::shared_ptr<const mobius::core::bytearray> block)
+{
+    if (threads_.empty ())
+    {
+        hashes_[0].update (*block);
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock (mutex_);
+
+        cv_release_.wait (lock, [this] {
+            return blocks_.size () < MAX_PENDING_BLOCKS || exception_;
+        });
+
+        if (exception_)
+            std::rethrow_exception (exception_);
+
+        blocks_.push_back (std::move (block));
+    }
+
+    cv_block_.notify_all ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Reset hashes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+multi_hash::impl::reset ()
+{
+    _wait ();
+
+    for (auto &h : hashes_)
+        h.reset ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get digest for a given hash type
+// @param type Hash type
+// @return Digest
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::bytearray
+multi_hash::impl::get_digest (const std::string &type)
+{
+    _wait ();
+
+    for (std::size_t i = 0; i < types_.size (); i++)
+    {
+        if (types_[i] == type)
+            return hashes_[i].get_digest ();
+    }
+
+    throw std::invalid_argument (
+        MOBIUS_EXCEPTION_MSG ("hash type not found: " + type));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get all digests
+// @return Pairs <type, digest>, in the same order as types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+multi_hash::digest_list_type
+multi_hash::impl::get_digests ()
+{
+    _wait ();
+
+    digest_list_type digests;
+
+    for (std::size_t i = 0; i < types_.size (); i++)
+        digests.emplace_back (types_[i], hashes_[i].get_digest ());
+
+    return digests;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Worker thread function
+// @param idx Hash index
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+multi_hash::impl::_run_worker (std::size_t idx)
+{
+    while (true)
+    {
+        std::shared_ptr<const mobius::core::bytearray> block;
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // get next block
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        {
+            std::unique_lock<std::mutex> lock (mutex_);
+
+            cv_block_.wait (lock, [this, idx] {
+                return stop_ || next_seq_[idx] < first_seq_ + blocks_.size ();
+            });
+
+            if (stop_)
+                return;
+
+            block = blocks_[next_seq_[idx] - first_seq_];
+        }
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // hash block
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        std::exception_ptr e;
+
+        try
+        {
+            hashes_[idx].update (*block);
+        }
+        catch (...)
+        {
+            e = std::current_exception ();
+        }
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // release blocks already hashed by every worker
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+
+            if (e && !exception_)
+                exception_ = e;
+
+            next_seq_[idx]++;
+
+            while (!blocks_.empty ())
+            {
+                bool released = true;
+
+                for (auto seq : next_seq_)
+                    released = released && seq > first_seq_;
+
+                if (!released)
+                    break;
+
+                blocks_.pop_front ();
+                first_seq_++;
+            }
+        }
+
+        cv_release_.notify_all ();
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wait until every block has been hashed
+//
+// Rethrows the first exception thrown by a worker, if any.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+multi_hash::impl::_wait ()
+{
+    if (threads_.empty ())
+        return;
+
+    std::unique_lock<std::mutex> lock (mutex_);
+    cv_release_.wait (lock, [this] { return blocks_.empty (); });
+
+    if (exception_)
+    {
+        auto e = exception_;
+        exception_ = nullptr;
+        std::rethrow_exception (e);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param types Hash types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+multi_hash::multi_hash (const std::vector<std::string> &types)
+    : impl_ (std::make_shared<impl> (types))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Update hashes with data block
+// @param data Data block
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+multi_hash::update (const mobius::core::bytearray &data)
+{
+    impl_->update (std::make_shared<const mobius::core::bytearray> (data));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Update hashes with data read from reader, until end of data
+// @param reader Reader object
+// @param block_size Read block size in bytes
+// @return Number of bytes read
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+multi_hash::update (mobius::core::io::reader reader, std::uint64_t block_size)
+{
+    std::uint64_t count = 0;
+    auto data = reader.read (block_size);
+
+    while (data)
+    {
+        count += data.size ();
+        impl_->update (
+            std::make_shared<const mobius::core::bytearray> (std::move (data)));
+        data = reader.read (block_size);
+    }
+
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Reset hashes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+multi_hash::reset ()
+{
+    impl_->reset ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get hash types
+// @return Hash types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<std::string>
+multi_hash::get_types () const
+{
+    return impl_->get_types ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get digest for a given hash type
+// @param type Hash type
+// @return Digest
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::bytearray
+multi_hash::get_digest (const std::string &type) const
+{
+    return impl_->get_digest (type);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get all digests
+// @return Pairs <type, digest>, in the same order as types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+multi_hash::digest_list_type
+multi_hash::get_digests () const
+{
+    return impl_->get_digests ();
+}
+
+} // namespace mobius::core::crypt
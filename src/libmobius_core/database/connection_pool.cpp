@@ -54,6 +54,7 @@ class connection_pool::impl
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     database get_database ();
     void set_path (const std::string &);
+    void enable_wal ();
     void acquire ();
     void release ();
 
@@ -64,11 +65,17 @@ class connection_pool::impl
     // @brief max connections for this pool
     unsigned int max_ = 32;
 
+    // @brief WAL mode flag
+    bool is_wal_ = false;
+
     // @brief pool mutex
     std::mutex mutex_;
 
     // @brief pool of database objects
     std::unordered_map<std::thread::id, database> pool_;
+
+    // Helper functions
+    database _new_database () const;
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -96,6 +103,36 @@ connection_pool::impl::set_path (const std::string &path)
     path_ = path;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Switch database to WAL journal mode
+//
+// Connections already acquired by other threads are not touched here, as
+// they cannot be used from this thread. They follow the WAL mode anyway,
+// because it is stored in the database file.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+connection_pool::impl::enable_wal ()
+{
+    if (path_.empty ())
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG ("Database path not set"));
+
+    std::lock_guard<std::mutex> lock (mutex_);
+
+    if (is_wal_)
+        return;
+
+    auto iter = pool_.find (std::this_thread::get_id ());
+
+    if (iter != pool_.end ())
+        iter->second.enable_wal ();
+
+    else
+        database (path_).enable_wal ();
+
+    is_wal_ = true;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Get database object
 // @return Database object
@@ -145,7 +182,7 @@ connection_pool::impl::acquire ()
     if (thread_id == main_thread_id)
     {
         if (iter == pool_.end ())
-            pool_[thread_id] = database (path_);
+            pool_[thread_id] = _new_database ();
     }
 
     // secondary threads: create only one connection per thread
@@ -155,10 +192,25 @@ connection_pool::impl::acquire ()
             throw std::runtime_error (
                 MOBIUS_EXCEPTION_MSG ("Connection has already been acquired"));
 
-        pool_[thread_id] = database (path_);
+        pool_[thread_id] = _new_database ();
     }
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Open new database connection
+// @return Database object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+database
+connection_pool::impl::_new_database () const
+{
+    database db (path_);
+
+    if (is_wal_)
+        db.enable_wal ();
+
+    return db;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Release connection
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -203,6 +255,15 @@ connection_pool::set_path (const std::string &path)
     impl_->set_path (path);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Switch database to WAL journal mode
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+connection_pool::enable_wal ()
+{
+    impl_->enable_wal ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Acquire a connection
 // @return A connection object for this thread
@@ -17,16 +17,29 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/database/database.hpp>
 #include <mobius/core/database/exception.inc>
+#include <mobius/core/database/reader_vfs.hpp>
 #include <mobius/core/exception.inc>
-#include <chrono>
+#include <mobius/core/io/tempfile.hpp>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <sqlite3.h>
 #include <stdexcept>
-#include <thread>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace
 {
-static constexpr int SLEEP_TIME = 200; // microseconds
+// Time sqlite3 waits for locks held by other connections before returning
+// SQLITE_BUSY, in milliseconds. It must be longer than the longest write
+// transaction, such as a case write queue batch.
+static constexpr int BUSY_TIMEOUT = 60000;
+
+// Max size kept for the "-wal" file after a checkpoint, in bytes
+static constexpr std::int64_t WAL_SIZE_LIMIT = 64 * 1024 * 1024;
+
+// Default number of idle prepared statements kept per connection
+static constexpr std::size_t DEFAULT_STATEMENT_CACHE_SIZE = 128;
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief libsqlite3 initialization class
@@ -149,6 +162,15 @@ namespace mobius::core::database
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 struct database_impl
 {
+    // Cached prepared statement
+    struct cached_statement
+    {
+        std::string sql;
+        sqlite3_stmt *stmt = nullptr;
+    };
+
+    using cache_list_type = std::list<cached_statement>;
+
     // Database handle. This is a pointer to the sqlite3 database object.
     sqlite3 *db = nullptr;
 
@@ -161,20 +183,79 @@ struct database_impl
     // Flag to indicate if the database is null
     bool is_null = true;
 
+    // Reader VFS path, if database is opened from a reader
+    std::string vfs_path;
+
+    // Temporary copy of reader data, if reader is not seekable
+    std::unique_ptr<mobius::core::io::tempfile> tfile;
+
+    // Temporary copy of WAL reader data, if WAL reader is not seekable
+    std::unique_ptr<mobius::core::io::tempfile> wal_tfile;
+
+    // Idle prepared statements, most recently used first
+    cache_list_type cache;
+
+    // Index of idle prepared statements by SQL text
+    std::unordered_multimap<std::string, cache_list_type::iterator> cache_index;
+
+    // Maximum number of idle prepared statements
+    std::size_t cache_size = DEFAULT_STATEMENT_CACHE_SIZE;
+
+    // Cache statistics
+    std::uint64_t cache_hits = 0;
+    std::uint64_t cache_misses = 0;
+
+    // Cache mutex
+    std::mutex cache_mutex;
+
     // Destructor
     ~database_impl ();
+
+    // Helper functions
+    void evict_statements (std::size_t);
 };
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Finalize least recently used idle statements
+// @param size Maximum number of idle statements to keep
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+database_impl::evict_statements (std::size_t size)
+{
+    while (cache.size () > size)
+    {
+        auto iter = std::prev (cache.end ());
+        auto [first, last] = cache_index.equal_range (iter->sql);
+
+        for (auto p = first; p != last; ++p)
+        {
+            if (p->second == iter)
+            {
+                cache_index.erase (p);
+                break;
+            }
+        }
+
+        sqlite3_finalize (iter->stmt);
+        cache.erase (iter);
+    }
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Destroy shared implementation
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 database_impl::~database_impl ()
 {
+    evict_statements (0);
+
     if (db != nullptr)
     {
         sqlite3_close (db);
         db = nullptr;
     }
+
+    if (!vfs_path.empty ())
+        unregister_reader_vfs_file (vfs_path);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -206,6 +287,70 @@ database::database (const std::string &path)
 
     impl_->path = path;
     impl_->is_null = false;
+
+    // let sqlite3 wait for other connections' locks, instead of returning
+    // SQLITE_BUSY at once
+    sqlite3_busy_timeout (impl_->db, BUSY_TIMEOUT);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create read-only database object from reader
+// @param reader Database reader
+// @param wal_reader WAL ("-wal" file) reader (optional)
+//
+// Readers are served to sqlite3 through the reader VFS. Readers that are not
+// seekable are copied to temporary files first. Without a WAL reader, WAL
+// mode databases are read as legacy ones, so pages not yet checkpointed are
+// not seen.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+database::database (
+    const mobius::core::io::reader &reader,
+    const mobius::core::io::reader &wal_reader
+)
+    : impl_ (std::make_shared<database_impl> ())
+{
+    if (!reader)
+        throw std::invalid_argument (MOBIUS_EXCEPTION_MSG ("invalid reader"));
+
+    // copy readers that cannot be served by reader VFS
+    auto db_reader = reader;
+    auto db_wal_reader = wal_reader;
+
+    if (!reader.is_seekable () || !reader.is_sizeable ())
+    {
+        impl_->tfile = std::make_unique<mobius::core::io::tempfile> ();
+        impl_->tfile->copy_from (reader);
+        db_reader = impl_->tfile->new_reader ();
+    }
+
+    if (wal_reader && (!wal_reader.is_seekable () || !wal_reader.is_sizeable ()))
+    {
+        impl_->wal_tfile = std::make_unique<mobius::core::io::tempfile> ();
+        impl_->wal_tfile->copy_from (wal_reader);
+        db_wal_reader = impl_->wal_tfile->new_reader ();
+    }
+
+    // open database
+    impl_->vfs_path = register_reader_vfs_file (db_reader, db_wal_reader);
+
+    int flags = SQLITE_OPEN_READONLY;
+
+    if (sqlite3_threadsafe () != 0)
+        flags |= SQLITE_OPEN_NOMUTEX;
+
+    int rc = sqlite3_open_v2 (
+        impl_->vfs_path.c_str (), &(impl_->db), flags, get_reader_vfs_name ()
+    );
+
+    if (rc != SQLITE_OK)
+        throw std::runtime_error (MOBIUS_EXCEPTION_SQLITE);
+
+    impl_->path = impl_->vfs_path;
+    impl_->is_null = false;
+
+    // reader VFS has no shared memory, so WAL index must be kept in heap
+    if (wal_reader)
+        execute ("PRAGMA locking_mode = EXCLUSIVE");
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -225,19 +370,71 @@ operator bool () const
 void
 database::execute (const std::string &sql)
 {
-    int rc = SQLITE_BUSY;
+    int rc = sqlite3_exec (impl_->db, sql.c_str (), nullptr, nullptr, nullptr);
 
-    while (rc == SQLITE_BUSY)
-    {
-        rc = sqlite3_exec (impl_->db, sql.c_str (), nullptr, nullptr, nullptr);
+    if (rc != SQLITE_OK)
+        throw std::runtime_error (MOBIUS_EXCEPTION_SQLITE);
+}
 
-        if (rc == SQLITE_BUSY)
-            std::this_thread::sleep_for (
-                std::chrono::microseconds (SLEEP_TIME)
-            );
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Switch database to WAL journal mode
+// @param autocheckpoint WAL size, in pages, that triggers a checkpoint
+//
+// In WAL mode, readers do not block writers and writers do not block
+// readers. WAL mode is persistent: once set, every connection to the same
+// file uses it. The other settings are per connection, so this function must
+// be called for each connection. "synchronous = NORMAL" is safe in WAL mode
+// (a power loss may undo the last transactions, but never corrupts the
+// database). Checkpoints run less often than sqlite3 default (1000 pages),
+// and the "-wal" file is truncated after them.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+database::enable_wal (std::int64_t autocheckpoint)
+{
+    execute ("PRAGMA journal_mode = WAL");
+    execute ("PRAGMA synchronous = NORMAL");
+    execute ("PRAGMA wal_autocheckpoint = " + std::to_string (autocheckpoint));
+    execute ("PRAGMA journal_size_limit = " + std::to_string (WAL_SIZE_LIMIT));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if database is in WAL journal mode
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+database::is_wal () const
+{
+    sqlite3_stmt *stmt = nullptr;
+
+    if (sqlite3_prepare_v2 (impl_->db, "PRAGMA journal_mode", -1, &stmt,
+                            nullptr) != SQLITE_OK)
+        throw std::runtime_error (MOBIUS_EXCEPTION_SQLITE);
+
+    bool rc = false;
+
+    if (sqlite3_step (stmt) == SQLITE_ROW)
+    {
+        auto text = reinterpret_cast<const char *> (
+            sqlite3_column_text (stmt, 0));
+        rc = text && std::string (text) == "wal";
     }
 
-    if (rc != SQLITE_OK)
+    sqlite3_finalize (stmt);
+
+    return rc;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Copy WAL content back into database file, without blocking readers
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+database::checkpoint ()
+{
+    int rc = sqlite3_wal_checkpoint_v2 (impl_->db, nullptr,
+                                        SQLITE_CHECKPOINT_PASSIVE, nullptr,
+                                        nullptr);
+
+    if (rc != SQLITE_OK && rc != SQLITE_BUSY)
         throw std::runtime_error (MOBIUS_EXCEPTION_SQLITE);
 }
 
@@ -270,23 +467,107 @@ database::end_transaction ()
 statement
 database::new_statement (const std::string &sql)
 {
-    sqlite3_stmt *stmt = nullptr;
-    int rc = SQLITE_BUSY;
-
-    while (rc == SQLITE_BUSY)
+    // try to reuse an idle prepared statement
     {
-        rc = sqlite3_prepare_v2 (impl_->db, sql.c_str (), -1, &stmt, nullptr);
+        std::lock_guard<std::mutex> lock (impl_->cache_mutex);
+        auto iter = impl_->cache_index.find (sql);
+
+        if (iter != impl_->cache_index.end ())
+        {
+            sqlite3_stmt *stmt = iter->second->stmt;
+            impl_->cache.erase (iter->second);
+            impl_->cache_index.erase (iter);
+            impl_->cache_hits++;
+
+            sqlite3_clear_bindings (stmt);
+            return statement (*this, stmt, sql);
+        }
 
-        if (rc == SQLITE_BUSY)
-            std::this_thread::sleep_for (
-                std::chrono::microseconds (SLEEP_TIME)
-            );
+        impl_->cache_misses++;
     }
 
+    // prepare new statement
+    sqlite3_stmt *stmt = nullptr;
+    int rc = sqlite3_prepare_v2 (impl_->db, sql.c_str (), -1, &stmt, nullptr);
+
     if (rc != SQLITE_OK)
         throw std::runtime_error (MOBIUS_EXCEPTION_SQLITE);
 
-    return statement (*this, stmt);
+    return statement (*this, stmt, sql);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Return prepared statement to the statement cache
+// @param sql SQL command
+// @param stmt Prepared statement
+//
+// This function is called by statement objects when they are destroyed.
+// Statement is reset and kept idle, so the next new_statement call with the
+// same SQL text reuses it. Least recently used idle statements are
+// finalized when cache is full.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+database::release_statement (const std::string &sql, sqlite3_stmt *stmt)
+{
+    sqlite3_reset (stmt);
+
+    std::lock_guard<std::mutex> lock (impl_->cache_mutex);
+
+    if (impl_->cache_size == 0)
+    {
+        sqlite3_finalize (stmt);
+        return;
+    }
+
+    impl_->cache.push_front ({sql, stmt});
+    impl_->cache_index.emplace (sql, impl_->cache.begin ());
+    impl_->evict_statements (impl_->cache_size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set maximum number of idle statements kept in statement cache
+// @param size Number of statements (0 = disable cache)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+database::set_statement_cache_size (std::size_t size)
+{
+    std::lock_guard<std::mutex> lock (impl_->cache_mutex);
+
+    impl_->cache_size = size;
+    impl_->evict_statements (size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get maximum number of idle statements kept in statement cache
+// @return Number of statements
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::size_t
+database::get_statement_cache_size () const
+{
+    std::lock_guard<std::mutex> lock (impl_->cache_mutex);
+    return impl_->cache_size;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of new_statement calls served from statement cache
+// @return Number of cache hits
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+database::get_statement_cache_hits () const
+{
+    std::lock_guard<std::mutex> lock (impl_->cache_mutex);
+    return impl_->cache_hits;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of new_statement calls that prepared a new statement
+// @return Number of cache misses
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+database::get_statement_cache_misses () const
+{
+    std::lock_guard<std::mutex> lock (impl_->cache_mutex);
+    return impl_->cache_misses;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -0,0 +1,499 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/database/reader_vfs.hpp>
+#include <mobius/core/exception.inc>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <sqlite3.h>
+#include <stdexcept>
+#include <unordered_map>
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Reader VFS
+//
+// Each registered reader gets a synthetic path, under PATH_PREFIX. Opening
+// that path through this VFS serves its content from the reader. If a WAL
+// reader is registered too, it is served as the "-wal" sibling. Hot
+// "-journal" files are always reported as nonexistent, so sqlite3 never
+// tries to roll them back.
+//
+// Files outside PATH_PREFIX (temporary files, mostly) are delegated to the
+// default VFS.
+//
+// When no WAL reader is given, database file format version bytes are
+// patched to "legacy" (1), so sqlite3 reads WAL mode databases without
+// looking for a "-wal" file. Otherwise, the database must be opened in
+// exclusive locking mode, as this VFS has no shared memory support.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static constexpr const char *VFS_NAME = "mobius-reader";
+static const std::string PATH_PREFIX = "/mobius-reader/";
+static const std::string WAL_SUFFIX = "-wal";
+
+// Offset of file format write/read version bytes in database header
+static constexpr std::uint64_t FILE_FORMAT_OFFSET = 18;
+
+// Legacy (rollback journal) file format version
+static constexpr std::uint8_t FILE_FORMAT_LEGACY = 1;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Registered file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct registered_file
+{
+    mobius::core::io::reader reader;
+    bool patch_file_format = false;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Open file structure
+// @see https://www.sqlite.org/c3ref/file.html
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct vfs_file
+{
+    sqlite3_file base;
+    registered_file *file;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::mutex registry_mutex_;
+static std::unordered_map<std::string, registered_file> registry_;
+static std::uint64_t next_id_ = 0;
+static std::once_flag vfs_once_;
+static sqlite3_vfs vfs_;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get default VFS
+// @return Pointer to default VFS
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static sqlite3_vfs *
+get_default_vfs ()
+{
+    return static_cast<sqlite3_vfs *> (vfs_.pAppData);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if path belongs to this VFS
+// @param path Path
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+is_reader_path (const char *path)
+{
+    return path && std::strncmp (path, PATH_PREFIX.c_str (),
+                                 PATH_PREFIX.size ()) == 0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Close file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_close (sqlite3_file *)
+{
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read data from file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_read (sqlite3_file *f, void *buffer, int amount, sqlite3_int64 offset)
+{
+    auto file = reinterpret_cast<vfs_file *> (f)->file;
+    auto p = static_cast<std::uint8_t *> (buffer);
+    std::uint64_t count = 0;
+
+    try
+    {
+        count = file->reader.read_at (offset, p, amount);
+    }
+    catch (const std::exception &)
+    {
+        return SQLITE_IOERR_READ;
+    }
+
+    // patch file format version bytes, if necessary
+    if (file->patch_file_format)
+    {
+        for (std::uint64_t pos = FILE_FORMAT_OFFSET;
+             pos < FILE_FORMAT_OFFSET + 2; pos++)
+        {
+            if (pos >= std::uint64_t (offset) &&
+                pos < std::uint64_t (offset) + count)
+                p[pos - offset] = FILE_FORMAT_LEGACY;
+        }
+    }
+
+    // short reads must zero-fill the rest of the buffer
+    if (count < std::uint64_t (amount))
+    {
+        std::memset (p + count, 0, amount - count);
+        return SQLITE_IOERR_SHORT_READ;
+    }
+
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Write data to file (not supported)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_write (sqlite3_file *, const void *, int, sqlite3_int64)
+{
+    return SQLITE_READONLY;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Truncate file (not supported)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_truncate (sqlite3_file *, sqlite3_int64)
+{
+    return SQLITE_READONLY;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Sync file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_sync (sqlite3_file *, int)
+{
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get file size
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_file_size (sqlite3_file *f, sqlite3_int64 *size)
+{
+    auto file = reinterpret_cast<vfs_file *> (f)->file;
+
+    try
+    {
+        *size = file->reader.get_size ();
+    }
+    catch (const std::exception &)
+    {
+        return SQLITE_IOERR_FSTAT;
+    }
+
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Lock/unlock file
+//
+// Files are immutable and private to one connection, so locks always succeed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_lock (sqlite3_file *, int)
+{
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if another connection holds a reserved lock
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_check_reserved_lock (sqlite3_file *, int *result)
+{
+    *result = 0;
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief File control
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_file_control (sqlite3_file *, int, void *)
+{
+    return SQLITE_NOTFOUND;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get sector size
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_sector_size (sqlite3_file *)
+{
+    return 512;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get device characteristics
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_device_characteristics (sqlite3_file *)
+{
+    return 0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief I/O methods for reader files
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static const sqlite3_io_methods io_methods_ = {
+    1,                        // iVersion
+    x_close,                  // xClose
+    x_read,                   // xRead
+    x_write,                  // xWrite
+    x_truncate,               // xTruncate
+    x_sync,                   // xSync
+    x_file_size,              // xFileSize
+    x_lock,                   // xLock
+    x_lock,                   // xUnlock
+    x_check_reserved_lock,    // xCheckReservedLock
+    x_file_control,           // xFileControl
+    x_sector_size,            // xSectorSize
+    x_device_characteristics, // xDeviceCharacteristics
+    nullptr,                  // xShmMap
+    nullptr,                  // xShmLock
+    nullptr,                  // xShmBarrier
+    nullptr,                  // xShmUnmap
+    nullptr,                  // xFetch
+    nullptr                   // xUnfetch
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Open file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_open (sqlite3_vfs *, const char *path, sqlite3_file *f, int flags,
+        int *out_flags)
+{
+    if (!is_reader_path (path))
+        return get_default_vfs ()->xOpen (get_default_vfs (), path, f, flags,
+                                          out_flags);
+
+    auto vf = reinterpret_cast<vfs_file *> (f);
+    vf->base.pMethods = nullptr;
+
+    std::lock_guard<std::mutex> lock (registry_mutex_);
+    auto iter = registry_.find (path);
+
+    if (iter == registry_.end ())
+        return SQLITE_CANTOPEN;
+
+    vf->file = &iter->second;
+    vf->base.pMethods = &io_methods_;
+
+    if (out_flags)
+        *out_flags = SQLITE_OPEN_READONLY;
+
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Delete file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_delete (sqlite3_vfs *, const char *path, int sync_dir)
+{
+    if (is_reader_path (path))
+        return SQLITE_READONLY;
+
+    return get_default_vfs ()->xDelete (get_default_vfs (), path, sync_dir);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check file access
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_access (sqlite3_vfs *, const char *path, int flags, int *result)
+{
+    if (!is_reader_path (path))
+        return get_default_vfs ()->xAccess (get_default_vfs (), path, flags,
+                                            result);
+
+    std::lock_guard<std::mutex> lock (registry_mutex_);
+    *result = flags != SQLITE_ACCESS_READWRITE && registry_.count (path);
+
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get full path name
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static int
+x_full_pathname (sqlite3_vfs *, const char *path, int size, char *out)
+{
+    if (!is_reader_path (path))
+        return get_default_vfs ()->xFullPathname (get_default_vfs (), path,
+                                                  size, out);
+
+    sqlite3_snprintf (size, out, "%s", path);
+    return SQLITE_OK;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Delegated VFS methods
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void *
+x_dl_open (sqlite3_vfs *, const char *path)
+{
+    return get_default_vfs ()->xDlOpen (get_default_vfs (), path);
+}
+
+static void
+x_dl_error (sqlite3_vfs *, int size, char *msg)
+{
+    get_default_vfs ()->xDlError (get_default_vfs (), size, msg);
+}
+
+static void (*x_dl_sym (sqlite3_vfs *, void *handle, const char *symbol)) (void)
+{
+    return get_default_vfs ()->xDlSym (get_default_vfs (), handle, symbol);
+}
+
+static void
+x_dl_close (sqlite3_vfs *, void *handle)
+{
+    get_default_vfs ()->xDlClose (get_default_vfs (), handle);
+}
+
+static int
+x_randomness (sqlite3_vfs *, int size, char *out)
+{
+    return get_default_vfs ()->xRandomness (get_default_vfs (), size, out);
+}
+
+static int
+x_sleep (sqlite3_vfs *, int microseconds)
+{
+    return get_default_vfs ()->xSleep (get_default_vfs (), microseconds);
+}
+
+static int
+x_current_time (sqlite3_vfs *, double *t)
+{
+    return get_default_vfs ()->xCurrentTime (get_default_vfs (), t);
+}
+
+static int
+x_get_last_error (sqlite3_vfs *, int size, char *msg)
+{
+    return get_default_vfs ()->xGetLastError (get_default_vfs (), size, msg);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Register VFS with sqlite3
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+register_vfs ()
+{
+    auto default_vfs = sqlite3_vfs_find (nullptr);
+
+    if (!default_vfs)
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG ("sqlite3 default VFS not found")
+        );
+
+    vfs_.iVersion = 1;
+    vfs_.szOsFile = std::max<int> (sizeof (vfs_file), default_vfs->szOsFile);
+    vfs_.mxPathname = default_vfs->mxPathname;
+    vfs_.zName = VFS_NAME;
+    vfs_.pAppData = default_vfs;
+    vfs_.xOpen = x_open;
+    vfs_.xDelete = x_delete;
+    vfs_.xAccess = x_access;
+    vfs_.xFullPathname = x_full_pathname;
+    vfs_.xDlOpen = x_dl_open;
+    vfs_.xDlError = x_dl_error;
+    vfs_.xDlSym = x_dl_sym;
+    vfs_.xDlClose = x_dl_close;
+    vfs_.xRandomness = x_randomness;
+    vfs_.xSleep = x_sleep;
+    vfs_.xCurrentTime = x_current_time;
+    vfs_.xGetLastError = x_get_last_error;
+
+    if (sqlite3_vfs_register (&vfs_, 0) != SQLITE_OK)
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG ("unable to register sqlite3 reader VFS")
+        );
+}
+
+} // namespace
+
+namespace mobius::core::database
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get reader VFS name, registering VFS on first call
+// @return VFS name
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const char *
+get_reader_vfs_name ()
+{
+    std::call_once (vfs_once_, register_vfs);
+    return VFS_NAME;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Register reader as a VFS file
+// @param reader Database reader
+// @param wal_reader WAL file reader (optional)
+// @return Path to be opened with reader VFS
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+register_reader_vfs_file (
+    const mobius::core::io::reader &reader,
+    const mobius::core::io::reader &wal_reader
+)
+{
+    if (!reader || !reader.is_seekable () || !reader.is_sizeable ())
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("reader must be seekable and sizeable")
+        );
+
+    if (wal_reader && (!wal_reader.is_seekable () || !wal_reader.is_sizeable ()))
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("WAL reader must be seekable and sizeable")
+        );
+
+    std::lock_guard<std::mutex> lock (registry_mutex_);
+    const std::string path = PATH_PREFIX + std::to_string (++next_id_) + ".db";
+
+    registry_[path] = registered_file {reader, !wal_reader};
+
+    if (wal_reader)
+        registry_[path + WAL_SUFFIX] = registered_file {wal_reader, false};
+
+    return path;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Unregister VFS file
+// @param path Path returned by register_reader_vfs_file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+unregister_reader_vfs_file (const std::string &path)
+{
+    std::lock_guard<std::mutex> lock (registry_mutex_);
+
+    registry_.erase (path);
+    registry_.erase (path + WAL_SUFFIX);
+}
+
+} // namespace mobius::core::database
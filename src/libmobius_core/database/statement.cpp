@@ -20,11 +20,9 @@
 #include <mobius/core/database/statement.hpp>
 #include <mobius/core/datetime/conv_iso_string.hpp>
 #include <mobius/core/exception.inc>
-#include <chrono>
 #include <cstring>
 #include <sqlite3.h>
 #include <stdexcept>
-#include <thread>
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // I prefer to use SQLITE_TRANSIENT instead of SQLITE_STATIC on bind calls
@@ -43,6 +41,10 @@ struct statement::impl
     database db;
     sqlite3_stmt *stmt = nullptr;
 
+    // SQL text, for statements that return to database statement cache
+    std::string sql;
+    bool is_cached = false;
+
     ~impl ();
 };
 
@@ -52,7 +54,13 @@ struct statement::impl
 statement::impl::~impl ()
 {
     if (stmt != nullptr)
-        sqlite3_finalize (stmt);
+    {
+        if (is_cached)
+            db.release_statement (sql, stmt);
+
+        else
+            sqlite3_finalize (stmt);
+    }
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -73,6 +81,24 @@ statement::statement (database db, sqlite3_stmt *stmt)
     impl_->db = db;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief create cached statement object
+// @param db Database object
+// @param stmt Prepared statement
+// @param sql SQL command
+//
+// When the last copy of the object is destroyed, the prepared statement
+// returns to the database statement cache instead of being finalized.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+statement::statement (database db, sqlite3_stmt *stmt, const std::string &sql)
+{
+    impl_ = std::make_shared<impl> ();
+    impl_->stmt = stmt;
+    impl_->db = db;
+    impl_->sql = sql;
+    impl_->is_cached = true;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Bind bool value
 // @param idx Value index
@@ -427,24 +453,14 @@ statement::get_error_message () const
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Execute a statement step
 // @return sqlite error code
+//
+// Locks held by other connections are waited for by sqlite3 busy handler,
+// up to the database busy timeout.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 int
 statement::step ()
 {
-    constexpr int SLEEP_TIME = 100; // microseconds
-    int rc = SQLITE_BUSY;
-
-    while (rc == SQLITE_BUSY)
-    {
-        rc = sqlite3_step (impl_->stmt);
-
-        if (rc == SQLITE_BUSY)
-            std::this_thread::sleep_for (
-                std::chrono::microseconds (SLEEP_TIME)
-            );
-    }
-
-    return rc;
+    return sqlite3_step (impl_->stmt);
 }
 
 } // namespace mobius::core::database
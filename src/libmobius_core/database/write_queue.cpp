@@ -0,0 +1,379 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/database/write_queue.hpp>
+#include <mobius/core/database/connection.hpp>
+#include <mobius/core/database/transaction.hpp>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// @brief Max number of tasks committed in a single transaction
+static constexpr std::size_t MAX_BATCH_SIZE = 1024;
+
+} // namespace
+
+namespace mobius::core::database
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Implementation class for write_queue
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class write_queue::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors and destructor
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit impl (const connection_pool &);
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+    ~impl ();
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void submit (task_type);
+    void run (task_type);
+    void wait ();
+
+  private:
+    // @brief Queued task
+    struct entry
+    {
+        task_type task;
+
+        // @brief Result promise, for tasks submitted by run
+        std::shared_ptr<std::promise<void>> result;
+    };
+
+    // @brief Connection pool
+    connection_pool pool_;
+
+    // @brief Pending tasks
+    std::deque<entry> tasks_;
+
+    // @brief Whether writer thread is running a batch of tasks
+    bool is_busy_ = false;
+
+    // @brief Stop flag
+    bool stop_ = false;
+
+    // @brief First exception thrown by a submitted task, if any
+    std::exception_ptr exception_;
+
+    // @brief Mutex protecting the fields above
+    std::mutex mutex_;
+
+    // @brief Signals that a new task has been submitted
+    std::condition_variable task_cv_;
+
+    // @brief Signals that a batch of tasks has been committed
+    std::condition_variable done_cv_;
+
+    // @brief Writer thread, started on first submit
+    std::thread thread_;
+
+    // Helper functions
+    void _push (entry);
+    void _run ();
+    void _run_batch (std::vector<entry> &);
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param pool Connection pool
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+write_queue::impl::impl (const connection_pool &pool)
+    : pool_ (pool)
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Destructor
+//
+// Pending tasks are committed before writer thread ends.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+write_queue::impl::~impl ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        stop_ = true;
+    }
+
+    task_cv_.notify_all ();
+
+    if (thread_.joinable ())
+        thread_.join ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Submit write task
+// @param task Task function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::impl::submit (task_type task)
+{
+    _push ({std::move (task), nullptr});
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Submit write task and wait until it has been committed
+// @param task Task function
+//
+// If the task throws an exception, it is rethrown here, and not by wait.
+// This function must not be called from inside a task.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::impl::run (task_type task)
+{
+    auto result = std::make_shared<std::promise<void>> ();
+    auto future = result->get_future ();
+
+    _push ({std::move (task), result});
+    future.get ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wait until every submitted task has been committed
+//
+// If any task has thrown an exception, the first one is rethrown here.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::impl::wait ()
+{
+    std::unique_lock<std::mutex> lock (mutex_);
+    done_cv_.wait (lock, [this] { return tasks_.empty () && !is_busy_; });
+
+    if (exception_)
+    {
+        auto e = exception_;
+        exception_ = nullptr;
+        std::rethrow_exception (e);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add task to queue, starting writer thread if necessary
+// @param e Queue entry
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::impl::_push (entry e)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+
+        if (!thread_.joinable ())
+            thread_ = std::thread (&impl::_run, this);
+
+        tasks_.push_back (std::move (e));
+    }
+
+    task_cv_.notify_one ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Writer thread function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::impl::_run ()
+{
+    connection conn;
+    std::exception_ptr open_exception;
+
+    try
+    {
+        conn = pool_.acquire ();
+    }
+    catch (...)
+    {
+        open_exception = std::current_exception ();
+    }
+
+    std::vector<entry> batch;
+
+    while (true)
+    {
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // get pending tasks
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        {
+            std::unique_lock<std::mutex> lock (mutex_);
+            task_cv_.wait (lock, [this] { return stop_ || !tasks_.empty (); });
+
+            if (tasks_.empty ())
+                return;
+
+            while (!tasks_.empty () && batch.size () < MAX_BATCH_SIZE)
+            {
+                batch.push_back (std::move (tasks_.front ()));
+                tasks_.pop_front ();
+            }
+
+            is_busy_ = true;
+        }
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // run tasks
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        std::exception_ptr e = open_exception;
+
+        if (!e)
+        {
+            try
+            {
+                _run_batch (batch);
+            }
+            catch (...)
+            {
+                e = std::current_exception ();
+            }
+        }
+
+        // batch could not be committed: every task fails
+        if (e)
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+
+            for (auto &t : batch)
+            {
+                if (t.result)
+                    t.result->set_exception (e);
+
+                else if (!exception_)
+                    exception_ = e;
+            }
+        }
+
+        batch.clear ();
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // signal waiting threads
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            is_busy_ = false;
+        }
+
+        done_cv_.notify_all ();
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Run batch of tasks in a single transaction
+// @param batch Tasks
+//
+// Each task runs inside a savepoint. If a task throws, only its changes are
+// rolled back. Task results are reported only after commit.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::impl::_run_batch (std::vector<entry> &batch)
+{
+    auto db = pool_.get_database ();
+    auto transaction = db.new_transaction ();
+    std::vector<std::exception_ptr> exceptions (batch.size ());
+
+    for (std::size_t i = 0; i < batch.size (); i++)
+    {
+        db.execute ("SAVEPOINT write_queue_task");
+
+        try
+        {
+            batch[i].task (db);
+            db.execute ("RELEASE write_queue_task");
+        }
+        catch (...)
+        {
+            exceptions[i] = std::current_exception ();
+            db.execute ("ROLLBACK TO write_queue_task");
+            db.execute ("RELEASE write_queue_task");
+        }
+    }
+
+    transaction.commit ();
+
+    // report results
+    std::lock_guard<std::mutex> lock (mutex_);
+
+    for (std::size_t i = 0; i < batch.size (); i++)
+    {
+        auto &t = batch[i];
+
+        if (t.result)
+        {
+            if (exceptions[i])
+                t.result->set_exception (exceptions[i]);
+
+            else
+                t.result->set_value ();
+        }
+
+        else if (exceptions[i] && !exception_)
+            exception_ = exceptions[i];
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param pool Connection pool
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+write_queue::write_queue (const connection_pool &pool)
+    : impl_ (std::make_shared<impl> (pool))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Submit write task
+// @param task Task function, called with writer database object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::submit (task_type task)
+{
+    impl_->submit (std::move (task));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Submit write task and wait until it has been committed
+// @param task Task function, called with writer database object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::run (task_type task)
+{
+    impl_->run (std::move (task));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wait until every submitted task has been committed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+write_queue::wait ()
+{
+    impl_->wait ();
+}
+
+} // namespace mobius::core::database
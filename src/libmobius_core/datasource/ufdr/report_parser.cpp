@@ -0,0 +1,1468 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/datasource/ufdr/report_parser.hpp>
+#include <mobius/core/datetime/datetime.hpp>
+#include <mobius/core/datetime/timedelta.hpp>
+#include <mobius/core/decoder/data_decoder.hpp>
+#include <mobius/core/exception.inc>
+#include <mobius/core/log.hpp>
+#include <mobius/core/string_functions.hpp>
+#include <libxml/xmlreader.h>
+#include <zlib.h>
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <stdexcept>
+
+namespace mobius::core::datasource::ufdr
+{
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Zip file constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint32_t ZIP_LOCAL_HEADER_SIGNATURE = 0x04034b50;
+constexpr std::uint32_t ZIP_CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+constexpr std::uint32_t ZIP_EOCD_SIGNATURE = 0x06054b50;
+constexpr std::uint32_t ZIP64_EOCD_SIGNATURE = 0x06064b50;
+constexpr std::uint32_t ZIP64_EOCD_LOCATOR_SIGNATURE = 0x07064b50;
+constexpr std::uint16_t ZIP64_EXTRA_FIELD_ID = 0x0001;
+constexpr std::uint64_t ZIP_EOCD_SIZE = 22;
+constexpr std::uint64_t ZIP64_EOCD_LOCATOR_SIZE = 20;
+constexpr std::uint64_t ZIP_CENTRAL_HEADER_SIZE = 46;
+constexpr std::uint64_t ZIP_LOCAL_HEADER_SIZE = 30;
+constexpr std::uint64_t ZIP_MAX_COMMENT_SIZE = 65535;
+constexpr std::uint16_t ZIP_METHOD_STORED = 0;
+constexpr std::uint16_t ZIP_METHOD_DEFLATED = 8;
+
+// @brief Name of the report entry inside UFDR file
+const std::string REPORT_ENTRY_NAME = "report.xml";
+
+// @brief Compressed data read at once
+constexpr std::uint64_t INFLATE_CHUNK_SIZE = 256 * 1024;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Zip entry location
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct zip_entry
+{
+    std::uint64_t data_offset = 0;
+    std::uint64_t compressed_size = 0;
+    std::uint64_t uncompressed_size = 0;
+    std::uint16_t method = 0;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read exactly size bytes from reader
+// @param reader Reader object
+// @param offset Offset in bytes
+// @param size Size in bytes
+// @return Data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::bytearray
+read_exactly (
+    mobius::core::io::reader reader, std::uint64_t offset, std::uint64_t size
+)
+{
+    reader.seek (offset);
+    auto data = reader.read (size);
+
+    if (data.size () != size)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("truncated zip file"));
+
+    return data;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Find entry in zip file, using its central directory
+// @param reader Reader object
+// @param name Entry name
+// @return Entry location
+//
+// Both classic and zip64 central directories are handled, as UFDR files
+// are usually larger than 4 GiB.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+zip_entry
+find_zip_entry (mobius::core::io::reader reader, const std::string &name)
+{
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Search end of central directory record, from the end of file
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    const std::uint64_t size = reader.get_size ();
+
+    if (size < ZIP_EOCD_SIZE)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("invalid zip file"));
+
+    const std::uint64_t tail_size =
+        std::min (size, ZIP_EOCD_SIZE + ZIP_MAX_COMMENT_SIZE);
+    const std::uint64_t tail_offset = size - tail_size;
+    auto tail = read_exactly (reader, tail_offset, tail_size);
+
+    std::uint64_t pos = tail_size - ZIP_EOCD_SIZE + 1;
+    bool found = false;
+
+    while (pos > 0 && !found)
+    {
+        --pos;
+        found = tail[pos] == 'P' && tail[pos + 1] == 'K' &&
+                tail[pos + 2] == 5 && tail[pos + 3] == 6;
+    }
+
+    if (!found)
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG ("zip central directory not found")
+        );
+
+    const std::uint64_t eocd_offset = tail_offset + pos;
+
+    mobius::core::decoder::data_decoder decoder (
+        tail.slice (pos, tail_size - 1)
+    );
+
+    decoder.skip (10);
+    std::uint64_t entries = decoder.get_uint16_le ();
+    std::uint64_t cd_size = decoder.get_uint32_le ();
+    std::uint64_t cd_offset = decoder.get_uint32_le ();
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Use zip64 end of central directory record, if present
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    if ((entries == 0xffff || cd_size == 0xffffffff ||
+         cd_offset == 0xffffffff) &&
+        eocd_offset >= ZIP64_EOCD_LOCATOR_SIZE)
+    {
+        mobius::core::decoder::data_decoder locator (read_exactly (
+            reader, eocd_offset - ZIP64_EOCD_LOCATOR_SIZE,
+            ZIP64_EOCD_LOCATOR_SIZE
+        ));
+
+        if (locator.get_uint32_le () == ZIP64_EOCD_LOCATOR_SIGNATURE)
+        {
+            locator.skip (4);
+            auto zip64_eocd_offset = locator.get_uint64_le ();
+
+            mobius::core::decoder::data_decoder eocd64 (
+                read_exactly (reader, zip64_eocd_offset, 56)
+            );
+
+            if (eocd64.get_uint32_le () != ZIP64_EOCD_SIGNATURE)
+                throw std::runtime_error (MOBIUS_EXCEPTION_MSG (
+                    "invalid zip64 end of central directory"
+                ));
+
+            eocd64.skip (28);
+            entries = eocd64.get_uint64_le ();
+            cd_size = eocd64.get_uint64_le ();
+            cd_offset = eocd64.get_uint64_le ();
+        }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Scan central directory entries
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    const std::uint64_t cd_end = cd_offset + cd_size;
+    std::uint64_t offset = cd_offset;
+
+    while (offset + ZIP_CENTRAL_HEADER_SIZE <= cd_end)
+    {
+        mobius::core::decoder::data_decoder header (
+            read_exactly (reader, offset, ZIP_CENTRAL_HEADER_SIZE)
+        );
+
+        if (header.get_uint32_le () != ZIP_CENTRAL_HEADER_SIGNATURE)
+            throw std::runtime_error (
+                MOBIUS_EXCEPTION_MSG ("invalid zip central directory entry")
+            );
+
+        header.skip (6);
+        auto method = header.get_uint16_le ();
+        header.skip (8);
+        std::uint64_t compressed_size = header.get_uint32_le ();
+        std::uint64_t uncompressed_size = header.get_uint32_le ();
+        auto name_size = header.get_uint16_le ();
+        auto extra_size = header.get_uint16_le ();
+        auto comment_size = header.get_uint16_le ();
+        header.skip (8);
+        std::uint64_t local_offset = header.get_uint32_le ();
+
+        auto entry_name = reader.read (name_size);
+
+        if (entry_name.size () == name_size &&
+            std::equal (entry_name.begin (), entry_name.end (), name.begin (),
+                        name.end ()))
+        {
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            // Get 64-bit values from zip64 extra field
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            mobius::core::decoder::data_decoder extra (reader.read (extra_size));
+
+            while (extra.get_size () - extra.tell () >= 4)
+            {
+                auto field_id = extra.get_uint16_le ();
+                auto field_size = extra.get_uint16_le ();
+                auto field_end = extra.tell () + field_size;
+
+                if (field_id == ZIP64_EXTRA_FIELD_ID)
+                {
+                    if (uncompressed_size == 0xffffffff &&
+                        extra.tell () + 8 <= field_end)
+                        uncompressed_size = extra.get_uint64_le ();
+
+                    if (compressed_size == 0xffffffff &&
+                        extra.tell () + 8 <= field_end)
+                        compressed_size = extra.get_uint64_le ();
+
+                    if (local_offset == 0xffffffff &&
+                        extra.tell () + 8 <= field_end)
+                        local_offset = extra.get_uint64_le ();
+                }
+
+                extra.seek (std::min (field_end, extra.get_size ()));
+            }
+
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            // Get data offset from local header
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            mobius::core::decoder::data_decoder local (
+                read_exactly (reader, local_offset, ZIP_LOCAL_HEADER_SIZE)
+            );
+
+            if (local.get_uint32_le () != ZIP_LOCAL_HEADER_SIGNATURE)
+                throw std::runtime_error (
+                    MOBIUS_EXCEPTION_MSG ("invalid zip local header")
+                );
+
+            local.skip (22);
+            auto local_name_size = local.get_uint16_le ();
+            auto local_extra_size = local.get_uint16_le ();
+
+            zip_entry entry;
+            entry.data_offset = local_offset + ZIP_LOCAL_HEADER_SIZE +
+                                local_name_size + local_extra_size;
+            entry.compressed_size = compressed_size;
+            entry.uncompressed_size = uncompressed_size;
+            entry.method = method;
+
+            return entry;
+        }
+
+        offset += ZIP_CENTRAL_HEADER_SIZE + name_size + extra_size +
+                  comment_size;
+    }
+
+    throw std::runtime_error (
+        MOBIUS_EXCEPTION_MSG ("entry not found in zip file: " + name)
+    );
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Zip entry stream, inflating data on demand
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class entry_stream
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructor
+    // @param reader Zip file reader
+    // @param entry Entry location
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    entry_stream (const mobius::core::io::reader &reader, const zip_entry &entry)
+        : reader_ (reader),
+          method_ (entry.method),
+          remaining_ (entry.compressed_size)
+    {
+        if (method_ != ZIP_METHOD_STORED && method_ != ZIP_METHOD_DEFLATED)
+            throw std::runtime_error (MOBIUS_EXCEPTION_MSG (
+                "unsupported zip compression method: " +
+                std::to_string (method_)
+            ));
+
+        if (method_ == ZIP_METHOD_DEFLATED &&
+            inflateInit2 (&zs_, -MAX_WBITS) != Z_OK)
+            throw std::runtime_error (
+                MOBIUS_EXCEPTION_MSG ("could not initialize zlib")
+            );
+
+        reader_.seek (entry.data_offset);
+    }
+
+    entry_stream (const entry_stream &) = delete;
+    entry_stream (entry_stream &&) = delete;
+    entry_stream &operator= (const entry_stream &) = delete;
+    entry_stream &operator= (entry_stream &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Destructor
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    ~entry_stream ()
+    {
+        if (method_ == ZIP_METHOD_DEFLATED)
+            inflateEnd (&zs_);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Read uncompressed data
+    // @param buffer Output buffer
+    // @param size Buffer size
+    // @return Bytes read (0 at end of stream)
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    read (char *buffer, std::uint64_t size)
+    {
+        if (method_ == ZIP_METHOD_STORED)
+        {
+            auto data = reader_.read (std::min (size, remaining_));
+            std::copy (data.begin (), data.end (), buffer);
+            remaining_ -= data.size ();
+            return data.size ();
+        }
+
+        zs_.next_out = reinterpret_cast<Bytef *> (buffer);
+        zs_.avail_out = static_cast<uInt> (size);
+
+        while (zs_.avail_out > 0 && !eof_)
+        {
+            if (zs_.avail_in == 0 && remaining_ > 0)
+            {
+                in_ = reader_.read (std::min (INFLATE_CHUNK_SIZE, remaining_));
+
+                if (in_.empty ())
+                    throw std::runtime_error (
+                        MOBIUS_EXCEPTION_MSG ("truncated zip entry")
+                    );
+
+                zs_.next_in = in_.data ();
+                zs_.avail_in = static_cast<uInt> (in_.size ());
+                remaining_ -= in_.size ();
+            }
+
+            int rc = inflate (&zs_, Z_NO_FLUSH);
+
+            if (rc == Z_STREAM_END)
+                eof_ = true;
+
+            else if (rc == Z_BUF_ERROR && zs_.avail_in == 0 && remaining_ == 0)
+                throw std::runtime_error (
+                    MOBIUS_EXCEPTION_MSG ("truncated zip entry")
+                );
+
+            else if (rc != Z_OK && rc != Z_BUF_ERROR)
+                throw std::runtime_error (
+                    MOBIUS_EXCEPTION_MSG ("zlib error: " + std::to_string (rc))
+                );
+        }
+
+        return size - zs_.avail_out;
+    }
+
+  private:
+    // @brief Zip file reader
+    mobius::core::io::reader reader_;
+
+    // @brief Compression method
+    std::uint16_t method_;
+
+    // @brief Compressed bytes not read yet
+    std::uint64_t remaining_;
+
+    // @brief Compressed data buffer
+    mobius::core::bytearray in_;
+
+    // @brief Zlib stream
+    z_stream zs_ = {};
+
+    // @brief End of stream flag
+    bool eof_ = false;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert libxml2 string to std::string, releasing it
+// @param s libxml2 string
+// @return String
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+to_string (xmlChar *s)
+{
+    std::string value;
+
+    if (s)
+    {
+        value = reinterpret_cast<const char *> (s);
+        xmlFree (s);
+    }
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get node attribute
+// @param node XML node
+// @param name Attribute name
+// @return Attribute value or empty string
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+get_attribute (xmlNodePtr node, const char *name)
+{
+    return to_string (
+        xmlGetProp (node, reinterpret_cast<const xmlChar *> (name))
+    );
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get node text, stripped
+// @param node XML node
+// @return Text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+get_text (xmlNodePtr node)
+{
+    return mobius::core::string::strip (to_string (xmlNodeGetContent (node)));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check node name
+// @param node XML node
+// @param name Tag name
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+is_element (xmlNodePtr node, const char *name)
+{
+    return node->type == XML_ELEMENT_NODE &&
+           xmlStrcmp (node->name, reinterpret_cast<const xmlChar *> (name)) ==
+               0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert string to number
+// @param s String
+// @return Numeric value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T>
+T
+to_number (const std::string &s)
+{
+    T value = {};
+    auto [ptr, ec] = std::from_chars (s.data (), s.data () + s.size (), value);
+
+    if (s.empty () || ec != std::errc () || ptr != s.data () + s.size ())
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("invalid numeric value: " + s)
+        );
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert attribute string to integer
+// @param s String
+// @param default_value Value returned if s is empty
+// @return Integer value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::int64_t
+to_int (const std::string &s, std::int64_t default_value = -1)
+{
+    if (s.empty ())
+        return default_value;
+
+    return to_number<std::int64_t> (s);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert report timestamp to UTC datetime
+// @param value Timestamp string (e.g. 2021-05-04T10:20:30.000-03:00)
+// @return Datetime or null, if value is empty
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::data
+get_datetime (const std::string &value)
+{
+    if (value.empty () || value == "N/A")
+        return {};
+
+    if (value.size () < 19)
+        return value;
+
+    int y, m, d, hh, mm, ss;
+
+    if (sscanf (value.c_str (), "%4d-%2d-%2dT%2d:%2d:%2d", &y, &m, &d, &hh,
+                &mm, &ss) != 6)
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("invalid timestamp: " + value)
+        );
+
+    mobius::core::datetime::datetime dt (y, m, d, hh, mm, ss);
+
+    // skip milliseconds and apply timezone offset, if any
+    const std::string tz = value.size () > 23 ? value.substr (23) : "";
+
+    if (tz.size () >= 6 && tz != "+00:00")
+    {
+        std::int64_t seconds = to_int (tz.substr (1, 2)) * 3600 +
+                               to_int (tz.substr (4, 2)) * 60;
+
+        if (tz[0] == '+')
+            seconds = -seconds;
+
+        dt += mobius::core::datetime::timedelta (seconds);
+    }
+
+    return dt;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief libxml2 input callback
+// @param context Entry stream
+// @param buffer Output buffer
+// @param len Buffer size
+// @return Bytes read or -1 on error
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+xml_input_read (void *context, char *buffer, int len)
+{
+    try
+    {
+        return static_cast<int> (
+            static_cast<entry_stream *> (context)->read (buffer, len)
+        );
+    }
+    catch (const std::exception &e)
+    {
+        mobius::core::log log (__FILE__, __FUNCTION__);
+        log.error (__LINE__, e.what ());
+    }
+
+    return -1;
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Report parser implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class report_parser::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructor
+    // @param reader UFDR file reader
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit impl (const mobius::core::io::reader &reader)
+        : reader_ (reader)
+    {
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set element start handler
+    // @param f Handler function
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_element_start_handler (const element_handler_type &f)
+    {
+        on_element_start_ = f;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set element end handler
+    // @param f Handler function
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_element_end_handler (const element_handler_type &f)
+    {
+        on_element_end_ = f;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set tagged file handler
+    // @param f Handler function
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_tagged_file_handler (const data_handler_type &f)
+    {
+        on_tagged_file_ = f;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set model handler
+    // @param f Handler function
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_model_handler (const data_handler_type &f)
+    {
+        on_model_ = f;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get case info
+    // @return Case info
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    mobius::core::pod::map
+    get_case_info () const
+    {
+        return case_info_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get extractions
+    // @return Extractions
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::vector<extraction>
+    get_extractions () const
+    {
+        return extractions_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get model count
+    // @return Model count, as declared in <project> element
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::int64_t
+    get_model_count () const
+    {
+        return model_count_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get unknown datatypes
+    // @return Datatypes found in <value> elements not handled by parser
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::set<std::string>
+    get_unknown_datatypes () const
+    {
+        return unknown_datatypes_;
+    }
+
+    // Function prototypes
+    void run ();
+
+  private:
+    // @brief UFDR file reader
+    mobius::core::io::reader reader_;
+
+    // @brief Element start handler
+    element_handler_type on_element_start_;
+
+    // @brief Element end handler
+    element_handler_type on_element_end_;
+
+    // @brief Tagged file handler
+    data_handler_type on_tagged_file_;
+
+    // @brief Model handler
+    data_handler_type on_model_;
+
+    // @brief Current element full name (e.g. project.decodedData)
+    std::string fullname_;
+
+    // @brief Case info
+    mobius::core::pod::map case_info_;
+
+    // @brief Extractions
+    std::vector<extraction> extractions_;
+
+    // @brief Model count
+    std::int64_t model_count_ = 0;
+
+    // @brief Unknown datatypes
+    std::set<std::string> unknown_datatypes_;
+
+    // Helper functions
+    bool _end_element ();
+    void _on_case_information (xmlNodePtr);
+    void _on_source_extractions (xmlNodePtr);
+    void _on_extraction_metadata (xmlNodePtr);
+    bool _on_tagged_file (xmlNodePtr);
+    bool _on_model (xmlNodePtr);
+    mobius::core::pod::map _get_model (xmlNodePtr);
+    mobius::core::pod::data _get_value (const std::string &, const std::string &);
+    mobius::core::pod::data _get_field_value (xmlNodePtr);
+    mobius::core::pod::data _get_multifield_value (xmlNodePtr);
+    mobius::core::pod::data _get_modelfield_value (xmlNodePtr);
+    mobius::core::pod::data _get_multimodelfield_value (xmlNodePtr);
+    mobius::core::pod::data _get_datafield_value (xmlNodePtr);
+    mobius::core::pod::data _get_nodefield_value (xmlNodePtr);
+    std::vector<mobius::core::pod::data> _get_jumptargets (xmlNodePtr);
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Parse report.xml
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::impl::run ()
+{
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Open report.xml entry
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    entry_stream stream (reader_, find_zip_entry (reader_, REPORT_ENTRY_NAME));
+
+    std::unique_ptr<xmlTextReader, decltype (&xmlFreeTextReader)> xr (
+        xmlReaderForIO (xml_input_read, nullptr, &stream,
+                        REPORT_ENTRY_NAME.c_str (), nullptr,
+                        XML_PARSE_NONET | XML_PARSE_HUGE | XML_PARSE_COMPACT),
+        xmlFreeTextReader);
+
+    if (!xr)
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG ("could not create XML reader")
+        );
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Process elements
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    fullname_.clear ();
+    bool stop = false;
+    int rc = xmlTextReaderRead (xr.get ());
+
+    while (rc == 1 && !stop)
+    {
+        int node_type = xmlTextReaderNodeType (xr.get ());
+        bool consumed = false;
+
+        if (node_type == XML_READER_TYPE_ELEMENT)
+        {
+            std::string name = reinterpret_cast<const char *> (
+                xmlTextReaderConstName (xr.get ())
+            );
+
+            std::string fullname =
+                fullname_.empty () ? name : fullname_ + '.' + name;
+
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            // Elements expanded and consumed at once
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            xmlNodePtr node = nullptr;
+
+            if (fullname == "project.caseInformation" ||
+                fullname == "project.sourceExtractions" ||
+                fullname == "project.metadata" ||
+                (on_tagged_file_ && fullname == "project.taggedFiles.file") ||
+                (on_model_ && fullname == "project.decodedData.modelType.model"))
+            {
+                node = xmlTextReaderExpand (xr.get ());
+
+                if (!node)
+                    throw std::runtime_error (MOBIUS_EXCEPTION_MSG (
+                        "could not expand element: " + fullname
+                    ));
+
+                consumed = true;
+            }
+
+            if (fullname == "project.caseInformation")
+                _on_case_information (node);
+
+            else if (fullname == "project.sourceExtractions")
+                _on_source_extractions (node);
+
+            else if (fullname == "project.metadata")
+                _on_extraction_metadata (node);
+
+            else if (on_tagged_file_ && fullname == "project.taggedFiles.file")
+                stop = _on_tagged_file (node);
+
+            else if (on_model_ &&
+                     fullname == "project.decodedData.modelType.model")
+                stop = _on_model (node);
+
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            // Other elements are traversed
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            else
+            {
+                if (fullname == "project")
+                {
+                    try
+                    {
+                        model_count_ = to_int (
+                            to_string (xmlTextReaderGetAttribute (
+                                xr.get (),
+                                reinterpret_cast<const xmlChar *> (
+                                    "ModelCount"))),
+                            0);
+                    }
+                    catch (const std::exception &e)
+                    {
+                        mobius::core::log log (__FILE__, __FUNCTION__);
+                        log.warning (__LINE__, e.what ());
+                    }
+                }
+
+                else if (on_element_start_ && on_element_start_ (fullname))
+                    break;
+
+                fullname_ = fullname;
+
+                if (xmlTextReaderIsEmptyElement (xr.get ()))
+                    stop = _end_element ();
+            }
+        }
+
+        else if (node_type == XML_READER_TYPE_END_ELEMENT)
+            stop = _end_element ();
+
+        if (!stop)
+            rc = consumed ? xmlTextReaderNext (xr.get ())
+                          : xmlTextReaderRead (xr.get ());
+    }
+
+    if (rc == -1)
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG ("error parsing UFDR report.xml")
+        );
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Handle end of traversed element
+// @return true to stop parsing
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+report_parser::impl::_end_element ()
+{
+    if (on_element_end_ && on_element_end_ (fullname_))
+        return true;
+
+    auto pos = fullname_.rfind ('.');
+
+    if (pos == std::string::npos)
+        fullname_.clear ();
+
+    else
+        fullname_.erase (pos);
+
+    return false;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Handle <caseInformation> element
+// @param node XML node
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::impl::_on_case_information (xmlNodePtr node)
+{
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (is_element (child, "field"))
+            case_info_.set (
+                get_attribute (child, "fieldType"), get_text (child)
+            );
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Handle <sourceExtractions> element
+// @param node XML node
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::impl::_on_source_extractions (xmlNodePtr node)
+{
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (!is_element (child, "extractionInfo"))
+            continue;
+
+        try
+        {
+            extraction e (static_cast<int> (to_int (get_attribute (child, "id"))));
+            e.set_name (get_attribute (child, "name"));
+            e.set_device_name (get_attribute (child, "fullName"));
+            e.set_type (get_attribute (child, "type"));
+
+            extractions_.push_back (e);
+        }
+        catch (const std::exception &e)
+        {
+            mobius::core::log log (__FILE__, __FUNCTION__);
+            log.warning (__LINE__, e.what ());
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Handle <metadata> element, child of <project>
+// @param node XML node
+//
+// Only "Extraction Data" and "Device Info" sections are handled. Their
+// items are added to the extraction referenced by sourceExtraction.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::impl::_on_extraction_metadata (xmlNodePtr node)
+{
+    auto section = get_attribute (node, "section");
+
+    if (section != "Extraction Data" && section != "Device Info")
+        return;
+
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (!is_element (child, "item"))
+            continue;
+
+        try
+        {
+            auto source = to_int (get_attribute (child, "sourceExtraction"));
+
+            if (source >= 0 &&
+                source < static_cast<std::int64_t> (extractions_.size ()))
+                extractions_[source].add_metadata (get_attribute (child, "name"),
+                                                   get_text (child));
+        }
+        catch (const std::exception &e)
+        {
+            mobius::core::log log (__FILE__, __FUNCTION__);
+            log.warning (__LINE__, e.what ());
+        }
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Handle <taggedFiles><file> element
+// @param node XML node
+// @return true to stop parsing
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+report_parser::impl::_on_tagged_file (xmlNodePtr node)
+{
+    mobius::core::pod::map f;
+
+    try
+    {
+        f.set ("id", get_attribute (node, "id"));
+        f.set ("size", to_int (get_attribute (node, "size")));
+        f.set ("path", get_attribute (node, "path"));
+        f.set ("fs_id", get_attribute (node, "fsid"));
+        f.set ("fs", get_attribute (node, "fs"));
+        f.set ("extraction_id", to_int (get_attribute (node, "extractionId")));
+        f.set ("deleted", get_attribute (node, "deleted"));
+        f.set ("embedded", get_attribute (node, "embedded"));
+        f.set ("is_related", get_attribute (node, "isrelated"));
+        f.set ("decoded_by", get_attribute (node, "decodedBy"));
+        f.set ("decoded_app", get_attribute (node, "decodedApplication"));
+        f.set ("source_index", to_int (get_attribute (node, "source_index")));
+
+        mobius::core::pod::map access_info;
+        mobius::core::pod::map metadata;
+        mobius::core::pod::map file_metadata;
+
+        for (auto child = node->children; child; child = child->next)
+        {
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            // <accessInfo>
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            if (is_element (child, "accessInfo"))
+            {
+                for (auto ts = child->children; ts; ts = ts->next)
+                {
+                    if (is_element (ts, "timestamp"))
+                        access_info.set (get_attribute (ts, "name"),
+                                         get_datetime (get_text (ts)));
+                }
+            }
+
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            // <metadata>
+            // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+            else if (is_element (child, "metadata"))
+            {
+                auto section = get_attribute (child, "section");
+
+                for (auto item = child->children; item; item = item->next)
+                {
+                    if (!is_element (item, "item"))
+                        continue;
+
+                    auto name = get_attribute (item, "name");
+                    mobius::core::pod::data value;
+
+                    if (item->children)
+                        value = get_text (item);
+
+                    if (section == "File")
+                        file_metadata.set (name, value);
+
+                    else if (section == "MetaData")
+                        metadata.set (name, value);
+
+                    else
+                    {
+                        mobius::core::log log (__FILE__, __FUNCTION__);
+                        log.development (
+                            __LINE__,
+                            "unhandled file metadata section: " + section);
+                    }
+                }
+            }
+        }
+
+        f.set ("access_info", access_info);
+        f.set ("metadata", metadata);
+        f.set ("file_metadata", file_metadata);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::core::log log (__FILE__, __FUNCTION__);
+        log.warning (__LINE__, e.what ());
+        return false;
+    }
+
+    try
+    {
+        return on_tagged_file_ (f);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::core::log log (__FILE__, __FUNCTION__);
+        log.warning (__LINE__, e.what ());
+    }
+
+    return false;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Handle <decodedData><modelType><model> element
+// @param node XML node
+// @return true to stop parsing
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+report_parser::impl::_on_model (xmlNodePtr node)
+{
+    mobius::core::pod::map m;
+
+    try
+    {
+        m = _get_model (node);
+        m.set ("evidence_count", model_count_);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::core::log log (__FILE__, __FUNCTION__);
+        log.warning (__LINE__, e.what ());
+        return false;
+    }
+
+    try
+    {
+        return on_model_ (m);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::core::log log (__FILE__, __FUNCTION__);
+        log.warning (__LINE__, e.what ());
+    }
+
+    return false;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get model from <model> element
+// @param node XML node
+// @return Model data
+//
+// Model attributes are kept with their original names. Fields are stored
+// in "metadata", as a list of (name, value) pairs.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::map
+report_parser::impl::_get_model (xmlNodePtr node)
+{
+    mobius::core::pod::map m;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Attributes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    for (auto attr = node->properties; attr; attr = attr->next)
+    {
+        auto name = reinterpret_cast<const char *> (attr->name);
+        m.set (name, get_attribute (node, name));
+    }
+
+    m.set ("extraction_id", to_int (get_attribute (node, "extractionId")));
+    m.set ("is_carved", get_attribute (node, "iscarved") == "True");
+    m.set ("is_related", get_attribute (node, "isrelated") == "True");
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Children nodes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::vector<mobius::core::pod::data> metadata;
+    std::vector<mobius::core::pod::data> jump_targets;
+
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (child->type != XML_ELEMENT_NODE)
+            continue;
+
+        auto name = get_attribute (child, "name");
+
+        if (is_element (child, "jumptargets"))
+        {
+            auto targets = _get_jumptargets (child);
+            jump_targets.insert (jump_targets.end (), targets.begin (),
+                                 targets.end ());
+            continue;
+        }
+
+        mobius::core::pod::data value;
+
+        if (is_element (child, "field"))
+            value = _get_field_value (child);
+
+        else if (is_element (child, "multiField"))
+            value = _get_multifield_value (child);
+
+        else if (is_element (child, "modelField"))
+            value = _get_modelfield_value (child);
+
+        else if (is_element (child, "multiModelField"))
+            value = _get_multimodelfield_value (child);
+
+        else if (is_element (child, "dataField"))
+            value = _get_datafield_value (child);
+
+        else if (is_element (child, "nodeField"))
+            value = _get_nodefield_value (child);
+
+        else
+            value = _get_multimodelfield_value (child); // related models
+
+        metadata.push_back (mobius::core::pod::data ({name, value}));
+    }
+
+    m.set ("metadata", metadata);
+    m.set ("jump_targets", jump_targets);
+
+    return m;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert <value> text according to its type
+// @param value_type Value type attribute
+// @param value Value text
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::data
+report_parser::impl::_get_value (
+    const std::string &value_type, const std::string &value
+)
+{
+    try
+    {
+        if (value_type == "Boolean")
+            return value == "True";
+
+        else if (value_type == "UInt32" || value_type == "Int32" ||
+                 value_type == "Int64")
+            return to_number<std::int64_t> (value);
+
+        else if (value_type == "UInt64" || value_type == "Uint64")
+            return to_number<std::uint64_t> (value);
+
+        else if (value_type == "Double")
+        {
+            std::string s = value;
+            std::replace (s.begin (), s.end (), ',', '.');
+            return to_number<double> (s);
+        }
+
+        else if (value_type == "TimeStamp")
+            return get_datetime (value);
+
+        else if (value_type != "String")
+            unknown_datatypes_.insert (value_type);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::core::log log (__FILE__, __FUNCTION__);
+        log.warning (__LINE__, e.what ());
+        return {};
+    }
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get <field> value
+// @param node XML node
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::data
+report_parser::impl::_get_field_value (xmlNodePtr node)
+{
+    mobius::core::pod::data value;
+
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (is_element (child, "value"))
+            value = _get_value (get_attribute (child, "type"), get_text (child));
+    }
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get <multiField> value
+// @param node XML node
+// @return List of values
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::data
+report_parser::impl::_get_multifield_value (xmlNodePtr node)
+{
+    std::vector<mobius::core::pod::data> values;
+
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (!is_element (child, "value"))
+            continue;
+
+        if (child->children)
+            values.push_back (
+                _get_value (get_attribute (child, "type"), get_text (child)));
+
+        else
+            values.emplace_back ();
+    }
+
+    return values;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get <modelField> value
+// @param node XML node
+// @return Model or null
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::data
+report_parser::impl::_get_modelfield_value (xmlNodePtr node)
+{
+    mobius::core::pod::data value;
+
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (is_element (child, "model"))
+            value = _get_model (child);
+    }
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get <multiModelField> value
+// @param node XML node
+// @return List of models
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::data
+report_parser::impl::_get_multimodelfield_value (xmlNodePtr node)
+{
+    std::vector<mobius::core::pod::data> values;
+
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (is_element (child, "model"))
+            values.push_back (_get_model (child));
+    }
+
+    return values;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get <dataField> value
+// @param node XML node
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::data
+report_parser::impl::_get_datafield_value (xmlNodePtr node)
+{
+    mobius::core::pod::data value;
+    auto field_type = get_attribute (node, "type");
+
+    if (field_type == "MemoryRange")
+    {
+        for (auto child = node->children; child; child = child->next)
+        {
+            if (is_element (child, "source"))
+            {
+                mobius::core::pod::map range;
+                range.set ("length", to_int (get_attribute (child, "length")));
+                value = range;
+            }
+        }
+    }
+
+    else
+    {
+        mobius::core::log log (__FILE__, __FUNCTION__);
+        log.development (__LINE__, "unhandled datafield type: " + field_type);
+    }
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get <nodeField> value
+// @param node XML node
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::data
+report_parser::impl::_get_nodefield_value (xmlNodePtr node)
+{
+    mobius::core::pod::data value;
+
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (is_element (child, "id"))
+        {
+            mobius::core::pod::map id;
+            id.set ("name", get_attribute (child, "name"));
+            id.set ("id", get_text (child));
+            value = id;
+        }
+    }
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get <jumptargets> targets
+// @param node XML node
+// @return Targets
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<mobius::core::pod::data>
+report_parser::impl::_get_jumptargets (xmlNodePtr node)
+{
+    std::vector<mobius::core::pod::data> targets;
+
+    for (auto child = node->children; child; child = child->next)
+    {
+        if (is_element (child, "targetid"))
+        {
+            mobius::core::pod::map target;
+            target.set ("is_model", get_attribute (child, "ismodel") == "true");
+            target.set ("id", get_text (child));
+            targets.push_back (target);
+        }
+    }
+
+    return targets;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param reader UFDR file reader
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+report_parser::report_parser (const mobius::core::io::reader &reader)
+    : impl_ (std::make_shared<impl> (reader))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set element start handler
+// @param f Function called with element full name, for traversed elements
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::set_element_start_handler (const element_handler_type &f)
+{
+    impl_->set_element_start_handler (f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set element end handler
+// @param f Function called with element full name, for traversed elements
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::set_element_end_handler (const element_handler_type &f)
+{
+    impl_->set_element_end_handler (f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set tagged file handler
+// @param f Function called for each <taggedFiles><file> element
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::set_tagged_file_handler (const data_handler_type &f)
+{
+    impl_->set_tagged_file_handler (f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set model handler
+// @param f Function called for each <decodedData><modelType><model> element
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::set_model_handler (const data_handler_type &f)
+{
+    impl_->set_model_handler (f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Parse report.xml
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+report_parser::run ()
+{
+    impl_->run ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get case info
+// @return Case info
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::pod::map
+report_parser::get_case_info () const
+{
+    return impl_->get_case_info ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get extractions
+// @return Extractions
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<extraction>
+report_parser::get_extractions () const
+{
+    return impl_->get_extractions ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get model count
+// @return Model count
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::int64_t
+report_parser::get_model_count () const
+{
+    return impl_->get_model_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get unknown datatypes
+// @return Unknown datatypes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::set<std::string>
+report_parser::get_unknown_datatypes () const
+{
+    return impl_->get_unknown_datatypes ();
+}
+
+} // namespace mobius::core::datasource::ufdr
@@ -15,6 +15,7 @@
 // You should have received a copy of the GNU General Public License
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
 #include <cstdio>
 #include <mobius/core/charset.hpp>
 #include <mobius/core/datetime/datetime.hpp>
@@ -30,6 +31,16 @@ namespace mobius::core::decoder
 {
 namespace
 {
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read-ahead buffer sizes
+//
+// Buffer starts small, so random access to small structures (e.g. registry
+// cells) does not read too much data, and grows while data is being decoded
+// sequentially.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static constexpr std::uint64_t MIN_BUFFER_SIZE = 4096;
+static constexpr std::uint64_t MAX_BUFFER_SIZE = 65536;
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Read <i>size</i> bytes from reader
 // @param reader Reader object
@@ -48,6 +59,40 @@ read (mobius::core::io::reader &reader, std::size_t size)
     return data;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Decode little endian unsigned integer from memory
+// @param p Pointer to data
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T>
+static inline T
+load_le (const std::uint8_t *p)
+{
+    T value = 0;
+
+    for (std::size_t i = 0; i < sizeof (T); i++)
+        value |= T (p[i]) << (i * 8);
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Decode big endian unsigned integer from memory
+// @param p Pointer to data
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <typename T>
+static inline T
+load_be (const std::uint8_t *p)
+{
+    T value = 0;
+
+    for (std::size_t i = 0; i < sizeof (T); i++)
+        value = (value << 8) | T (p[i]);
+
+    return value;
+}
+
 } // namespace
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -55,7 +100,9 @@ read (mobius::core::io::reader &reader, std::size_t size)
 // @param in reader object
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 data_decoder::data_decoder (const mobius::core::io::reader &in)
-    : in_ (in)
+    : in_ (in),
+      is_buffered_ (in.is_seekable ()),
+      fill_size_ (MIN_BUFFER_SIZE)
 {
 }
 
@@ -64,7 +111,9 @@ data_decoder::data_decoder (const mobius::core::io::reader &in)
 // @param data bytearray object
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 data_decoder::data_decoder (const mobius::core::bytearray &data)
-    : in_ (mobius::core::io::new_bytearray_reader (data))
+    : in_ (mobius::core::io::new_bytearray_reader (data)),
+      is_buffered_ (true),
+      fill_size_ (MIN_BUFFER_SIZE)
 {
 }
 
@@ -191,8 +240,7 @@ data_decoder::get_int64_be ()
 uint8_t
 data_decoder::get_uint8 ()
 {
-    const bytearray data = read (in_, 1);
-    return data[0];
+    return *_read (1);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -202,10 +250,7 @@ data_decoder::get_uint8 ()
 uint16_t
 data_decoder::get_uint16_le ()
 {
-    const bytearray data = read (in_, 2);
-    const uint8_t *p = data.begin ();
-
-    return std::uint16_t (*p) | (std::uint16_t (*(p + 1)) << 8);
+    return load_le<std::uint16_t> (_read (2));
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -215,10 +260,7 @@ data_decoder::get_uint16_le ()
 uint16_t
 data_decoder::get_uint16_be ()
 {
-    const bytearray data = read (in_, 2);
-    const uint8_t *p = data.begin ();
-
-    return (std::uint16_t (*p) << 8) | std::uint16_t (*(p + 1));
+    return load_be<std::uint16_t> (_read (2));
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -228,11 +270,7 @@ data_decoder::get_uint16_be ()
 uint32_t
 data_decoder::get_uint32_le ()
 {
-    const bytearray data = read (in_, 4);
-    const uint8_t *p = data.begin ();
-
-    return std::uint32_t (*p) | (std::uint32_t (*(p + 1)) << 8) |
-           (std::uint32_t (*(p + 2)) << 16) | (std::uint32_t (*(p + 3)) << 24);
+    return load_le<std::uint32_t> (_read (4));
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -242,11 +280,7 @@ data_decoder::get_uint32_le ()
 uint32_t
 data_decoder::get_uint32_be ()
 {
-    const bytearray data = read (in_, 4);
-    const uint8_t *p = data.begin ();
-
-    return std::uint32_t (*(p + 3)) | (std::uint32_t (*(p + 2)) << 8) |
-           (std::uint32_t (*(p + 1)) << 16) | (std::uint32_t (*p) << 24);
+    return load_be<std::uint32_t> (_read (4));
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -256,13 +290,7 @@ data_decoder::get_uint32_be ()
 uint64_t
 data_decoder::get_uint64_le ()
 {
-    const bytearray data = read (in_, 8);
-    const uint8_t *p = data.begin ();
-
-    return std::uint64_t (*p) | (std::uint64_t (*(p + 1)) << 8) |
-           (std::uint64_t (*(p + 2)) << 16) | (std::uint64_t (*(p + 3)) << 24) |
-           (std::uint64_t (*(p + 4)) << 32) | (std::uint64_t (*(p + 5)) << 40) |
-           (std::uint64_t (*(p + 6)) << 48) | (std::uint64_t (*(p + 7)) << 56);
+    return load_le<std::uint64_t> (_read (8));
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -272,13 +300,73 @@ data_decoder::get_uint64_le ()
 uint64_t
 data_decoder::get_uint64_be ()
 {
-    const bytearray data = read (in_, 8);
-    const uint8_t *p = data.begin ();
+    return load_be<std::uint64_t> (_read (8));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Decode array of uint16 (le)
+// @param count Number of values
+// @return Values
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<std::uint16_t>
+data_decoder::get_uint16_le_vector (std::size_t count)
+{
+    const bytearray data = _read_bytearray (count * sizeof (std::uint16_t));
+    const std::uint8_t *p = data.data ();
+
+    std::vector<std::uint16_t> values (count);
+
+    for (auto &value : values)
+    {
+        value = load_le<std::uint16_t> (p);
+        p += sizeof (std::uint16_t);
+    }
+
+    return values;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Decode array of uint32 (le)
+// @param count Number of values
+// @return Values
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<std::uint32_t>
+data_decoder::get_uint32_le_vector (std::size_t count)
+{
+    const bytearray data = _read_bytearray (count * sizeof (std::uint32_t));
+    const std::uint8_t *p = data.data ();
+
+    std::vector<std::uint32_t> values (count);
+
+    for (auto &value : values)
+    {
+        value = load_le<std::uint32_t> (p);
+        p += sizeof (std::uint32_t);
+    }
+
+    return values;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Decode array of uint64 (le)
+// @param count Number of values
+// @return Values
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<std::uint64_t>
+data_decoder::get_uint64_le_vector (std::size_t count)
+{
+    const bytearray data = _read_bytearray (count * sizeof (std::uint64_t));
+    const std::uint8_t *p = data.data ();
+
+    std::vector<std::uint64_t> values (count);
 
-    return std::uint64_t (*(p + 7)) | (std::uint64_t (*(p + 6)) << 8) |
-           (std::uint64_t (*(p + 5)) << 16) | (std::uint64_t (*(p + 4)) << 24) |
-           (std::uint64_t (*(p + 3)) << 32) | (std::uint64_t (*(p + 2)) << 40) |
-           (std::uint64_t (*(p + 1)) << 48) | (std::uint64_t (*p) << 56);
+    for (auto &value : values)
+    {
+        value = load_le<std::uint64_t> (p);
+        p += sizeof (std::uint64_t);
+    }
+
+    return values;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -322,7 +410,7 @@ data_decoder::get_hfs_datetime ()
 mobius::core::datetime::datetime
 data_decoder::get_iso9660_datetime ()
 {
-    auto data = read (in_, 17);
+    auto data = _read_bytearray (17);
 
     // parse date/time from string
     int y, m, d;
@@ -400,7 +488,7 @@ data_decoder::get_fat_datetime ()
 mobius::core::bytearray
 data_decoder::get_bytearray_by_size (std::size_t size)
 {
-    return read (in_, size);
+    return _read_bytearray (size);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -411,7 +499,7 @@ data_decoder::get_bytearray_by_size (std::size_t size)
 std::string
 data_decoder::get_hex_string_by_size (std::size_t size)
 {
-    return read (in_, size).to_hexstring ();
+    return _read_bytearray (size).to_hexstring ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -422,7 +510,7 @@ data_decoder::get_hex_string_by_size (std::size_t size)
 std::string
 data_decoder::get_string_by_size (std::size_t size, const std::string &encoding)
 {
-    bytearray data = read (in_, size);
+    bytearray data = _read_bytearray (size);
     std::string result;
 
     if (encoding == "ASCII" || encoding == "UTF-8")
@@ -466,12 +554,13 @@ data_decoder::get_c_string (const std::string &encoding)
     }
 
     // read data until ending is found
-    bytearray tmp = read (in_, read_size);
+    const std::uint8_t *p = _read (read_size);
 
-    while (tmp != ending)
+    while (!std::equal (p, p + read_size, ending.begin ()))
     {
-        data += tmp;
-        tmp = read (in_, read_size);
+        data.resize (data.size () + read_size);
+        std::copy (p, p + read_size, data.end () - read_size);
+        p = _read (read_size);
     }
 
     // convert charset, if necessary
@@ -567,7 +656,7 @@ data_decoder::get_ipv4 ()
 std::string
 data_decoder::get_ipv4_be ()
 {
-    bytearray data = read (in_, 4);
+    const std::uint8_t *data = _read (4);
 
     return std::to_string (data[0]) + '.' + std::to_string (data[1]) + '.' +
            std::to_string (data[2]) + '.' + std::to_string (data[3]);
@@ -580,7 +669,7 @@ data_decoder::get_ipv4_be ()
 std::string
 data_decoder::get_ipv4_le ()
 {
-    bytearray data = read (in_, 4);
+    const std::uint8_t *data = _read (4);
 
     return std::to_string (data[3]) + '.' + std::to_string (data[2]) + '.' +
            std::to_string (data[1]) + '.' + std::to_string (data[0]);
@@ -719,4 +808,74 @@ data_decoder::get_ipv4_mapped_ipv6 ()
     return stream.str ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read <i>size</i> bytes
+// @param size Size in bytes (up to MIN_BUFFER_SIZE)
+// @return Pointer to data, valid until next read
+//
+// Current position is always taken from reader, so any seek made directly
+// on reader invalidates the buffered data.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+const std::uint8_t *
+data_decoder::_read (size_type size)
+{
+    if (!is_buffered_)
+    {
+        buffer_ = read (in_, size);
+        return buffer_.data ();
+    }
+
+    size_type pos = in_.tell ();
+
+    if (pos < buffer_pos_ || pos + size > buffer_pos_ + buffer_size_)
+        _fill_buffer (pos, size);
+
+    in_.seek (pos + size);
+
+    return buffer_.data () + (pos - buffer_pos_);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read <i>size</i> bytes into a new bytearray
+// @param size Size in bytes
+// @return Data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::bytearray
+data_decoder::_read_bytearray (size_type size)
+{
+    if (!is_buffered_ || size > MIN_BUFFER_SIZE)
+        return read (in_, size);
+
+    const std::uint8_t *p = _read (size);
+    return bytearray (p, size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Fill read-ahead buffer
+// @param pos Position from the start of data
+// @param size Minimum number of bytes required
+//
+// If data is being read sequentially, buffer size is doubled (up to
+// MAX_BUFFER_SIZE). Otherwise, it is reset to MIN_BUFFER_SIZE.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+data_decoder::_fill_buffer (size_type pos, size_type size)
+{
+    if (buffer_size_ && pos >= buffer_pos_ && pos <= buffer_pos_ + buffer_size_)
+        fill_size_ = std::min (fill_size_ * 2, MAX_BUFFER_SIZE);
+
+    else
+        fill_size_ = MIN_BUFFER_SIZE;
+
+    if (buffer_.size () < fill_size_)
+        buffer_.resize (fill_size_);
+
+    buffer_pos_ = pos;
+    buffer_size_ = in_.read_at (pos, buffer_.data (), fill_size_);
+
+    if (buffer_size_ < size)
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG ("cannot read enough bytes"));
+}
+
 } // namespace mobius::core::decoder
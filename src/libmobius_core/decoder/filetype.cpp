@@ -16,35 +16,23 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/decoder/filetype.hpp>
+#include <mobius/core/decoder/filetype_engine.hpp>
 
 namespace mobius::core::decoder
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Get filetype according to file content
 // @param reader Reader object
-// @return Filetype
+// @return Filetype, "empty" or empty string if filetype is unknown
+//
+// Uses a shared filetype_engine loaded with the default signatures.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 std::string
 get_filetype (mobius::core::io::reader reader)
 {
-    std::string filetype;
-
-    // Read bytes from the beginning of the stream
-    auto head = reader.read (512);
-
-    // Check empty stream
-    if (!head)
-        filetype = "empty";
-
-    // Check datatypes
-    else if (head.startswith ("\x89\x50\x4e\x47\x0d\x0a\x1a\x0a"))
-        filetype = "image.png";
-
-    else if (head.startswith ("\x4C\x00\x00\x00\x01\x14\x02\x00\x00\x00\x00\x00"
-                              "\xC0\x00\x00\x00\x00\x00\x00\x46"))
-        filetype = "data.ms.shllink";
+    static const filetype_engine engine (1);
 
-    return filetype;
+    return engine.classify (reader);
 }
 
 } // namespace mobius::core::decoder
@@ -18,7 +18,9 @@
 #include <mobius/core/exception.inc>
 #include <mobius/core/exception_posix.inc>
 #include <mobius/core/io/local/reader_impl.hpp>
+#include <cerrno>
 #include <stdexcept>
+#include <unistd.h>
 
 namespace mobius::core::io::local
 {
@@ -52,21 +54,25 @@ reader_impl::reader_impl (const std::string &path)
 void
 reader_impl::seek (offset_type offset, whence_type w)
 {
-    int whence = 0;
+    offset_type abs_offset;
 
     if (w == whence_type::beginning)
-        whence = SEEK_SET;
+        abs_offset = offset;
 
     else if (w == whence_type::current)
-        whence = SEEK_CUR;
+        abs_offset = pos_ + offset;
 
     else if (w == whence_type::end)
-        whence = SEEK_END;
+        abs_offset = size_ + offset;
 
-    if (fseek (fp_.get (), offset, whence) == -1)
-        throw std::runtime_error (MOBIUS_EXCEPTION_POSIX);
+    else
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("invalid whence_type"));
+
+    if (abs_offset < 0)
+        throw std::invalid_argument (MOBIUS_EXCEPTION_MSG ("invalid offset"));
 
-    clearerr (fp_.get ()); // clear eof status
+    pos_ = abs_offset;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -76,23 +82,27 @@ reader_impl::seek (offset_type offset, whence_type w)
 reader_impl::offset_type
 reader_impl::tell () const
 {
-    long rc = ftell (fp_.get ());
-    if (rc == -1)
-        throw std::runtime_error (MOBIUS_EXCEPTION_POSIX);
-
-    return rc;
+    return pos_;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief read bytes from reader
+// @brief read bytes from reader into buffer
+// @param buffer buffer, with at least size bytes
 // @param size size in bytes
-// @return bytearray containing data
+// @return number of bytes read
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-mobius::core::bytearray
-reader_impl::read (size_type size)
+reader_impl::size_type
+reader_impl::read_into (std::uint8_t *buffer, size_type size)
 {
-    mobius::core::bytearray buffer (size);
-    size_t count = fread (buffer.data (), 1, size, fp_.get ());
+    if (file_pos_ != pos_)
+    {
+        if (fseeko (fp_.get (), pos_, SEEK_SET) == -1)
+            throw std::runtime_error (MOBIUS_EXCEPTION_POSIX);
+
+        file_pos_ = pos_;
+    }
+
+    size_t count = fread (buffer, 1, size, fp_.get ());
 
     if (count == 0 && ferror (fp_.get ()))
     {
@@ -100,8 +110,47 @@ reader_impl::read (size_type size)
         throw std::runtime_error (MOBIUS_EXCEPTION_POSIX);
     }
 
-    buffer.resize (count);
-    return buffer;
+    pos_ += count;
+    file_pos_ = pos_;
+
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief read bytes from a given position into buffer
+// @param offset offset in bytes from the beginning of file
+// @param buffer buffer, with at least size bytes
+// @param size size in bytes
+// @return number of bytes read
+//
+// Data is read with pread, so neither the read position nor the stdio
+// buffer are changed, and many threads can share the same reader.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+reader_impl::size_type
+reader_impl::read_at (size_type offset, std::uint8_t *buffer, size_type size)
+{
+    int fd = fileno (fp_.get ());
+    size_type count = 0;
+
+    while (count < size)
+    {
+        ssize_t rc = ::pread (fd, buffer + count, size - count, offset + count);
+
+        if (rc == -1)
+        {
+            if (errno == EINTR)
+                continue;
+
+            throw std::runtime_error (MOBIUS_EXCEPTION_POSIX);
+        }
+
+        if (rc == 0)
+            break;
+
+        count += rc;
+    }
+
+    return count;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -111,7 +160,7 @@ reader_impl::read (size_type size)
 bool
 reader_impl::eof () const
 {
-    return static_cast<size_type> (tell ()) >= size_;
+    return pos_ >= size_;
 }
 
 } // namespace mobius::core::io::local
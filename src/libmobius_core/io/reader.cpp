@@ -18,6 +18,7 @@
 #include <mobius/core/io/reader.hpp>
 #include <mobius/core/io/reader_impl_null.hpp>
 #include <mobius/core/io/reader_impl_slice.hpp>
+#include <algorithm>
 
 namespace mobius::core::io
 {
@@ -39,6 +40,32 @@ reader::reader (const std::shared_ptr<reader_impl_base> &ptr)
 {
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from a given position
+// @param offset Offset in bytes from the beginning of data
+// @param size Size in bytes
+// @return Data
+//
+// If reader implements read_at natively, read position is not changed and
+// this function can be called from many threads on the same reader.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::bytearray
+reader::read_at (size_type offset, size_type size)
+{
+    if (impl_->is_sizeable ())
+    {
+        size_type data_size = impl_->get_size ();
+        size = std::min (size, offset < data_size ? data_size - offset : 0);
+    }
+
+    mobius::core::bytearray data (size);
+
+    if (size > 0)
+        data.resize (impl_->read_at (offset, data.data (), size));
+
+    return data;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Create slice reader from reader
 // @param reader Reader object
@@ -17,6 +17,8 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/exception.inc>
 #include <mobius/core/io/reader_impl_base.hpp>
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 namespace mobius::core::io
@@ -55,4 +57,69 @@ reader_impl_base::get_size () const
         MOBIUS_EXCEPTION_MSG ("reader does not support get_size"));
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from reader, using <b>read_into</b>
+// @param size Size in bytes
+// @return Data
+//
+// Helper for readers that override <b>read_into</b>. If reader size is
+// known, buffer is allocated only for the bytes remaining to be read.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::bytearray
+reader_impl_base::_read_using_read_into (size_type size)
+{
+    if (is_sizeable () && is_seekable ())
+    {
+        size_type data_size = get_size ();
+        size_type pos = tell ();
+        size = std::min (size, pos < data_size ? data_size - pos : 0);
+    }
+
+    mobius::core::bytearray data (size);
+
+    if (size > 0)
+        data.resize (read_into (data.data (), size));
+
+    return data;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from reader into buffer
+// @param buffer Buffer, with at least size bytes
+// @param size Size in bytes
+// @return Number of bytes read
+//
+// Default implementation, built on top of <b>read</b>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+reader_impl_base::size_type
+reader_impl_base::read_into (std::uint8_t *buffer, size_type size)
+{
+    auto data = read (size);
+
+    if (!data.empty ())
+        std::memcpy (buffer, data.data (), data.size ());
+
+    return data.size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from a given position into buffer
+// @param offset Offset in bytes from the beginning of data
+// @param buffer Buffer, with at least size bytes
+// @param size Size in bytes
+// @return Number of bytes read
+//
+// Default implementation, built on top of <b>seek</b> and <b>read_into</b>.
+// Calls to read_at are serialized, but read position is changed.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+reader_impl_base::size_type
+reader_impl_base::read_at (size_type offset, std::uint8_t *buffer,
+                           size_type size)
+{
+    std::lock_guard<std::mutex> lock (read_at_mutex_);
+
+    seek (offset);
+    return read_into (buffer, size);
+}
+
 } // namespace mobius::core::io
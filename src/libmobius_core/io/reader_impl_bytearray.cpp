@@ -17,6 +17,8 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/exception.inc>
 #include <mobius/core/io/reader_impl_bytearray.hpp>
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
 namespace mobius::core::io
@@ -64,23 +66,42 @@ reader_impl_bytearray::seek (offset_type offset, whence_type w)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Read bytes from reader
+// @brief Read bytes from reader into buffer
+// @param buffer Buffer, with at least size bytes
 // @param size Size in bytes
-// @return Data
+// @return Number of bytes read
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-mobius::core::bytearray
-reader_impl_bytearray::read (size_type size)
+reader_impl_bytearray::size_type
+reader_impl_bytearray::read_into (std::uint8_t *buffer, size_type size)
 {
-    offset_type end = std::min (data_.size (), pos_ + size) - 1;
-    mobius::core::bytearray data;
+    if (pos_ >= data_.size ())
+        return 0;
 
-    if (offset_type (pos_) <= end)
-    {
-        data = data_.slice (pos_, end);
-        pos_ = end + 1;
-    }
+    size_type count = std::min (size, data_.size () - pos_);
+    std::memcpy (buffer, data_.data () + pos_, count);
+    pos_ += count;
 
-    return data;
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from a given position into buffer
+// @param offset Offset in bytes from the beginning of data
+// @param buffer Buffer, with at least size bytes
+// @param size Size in bytes
+// @return Number of bytes read
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+reader_impl_bytearray::size_type
+reader_impl_bytearray::read_at (size_type offset, std::uint8_t *buffer,
+                                size_type size)
+{
+    if (offset >= data_.size ())
+        return 0;
+
+    size_type count = std::min (size, data_.size () - offset);
+    std::memcpy (buffer, data_.data () + offset, count);
+
+    return count;
 }
 
 } // namespace mobius::core::io
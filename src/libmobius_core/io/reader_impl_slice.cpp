@@ -86,20 +86,45 @@ reader_impl_slice::seek (offset_type offset, whence_type w)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Read bytes from reader
+// @brief Read bytes from reader into buffer
+// @param buffer Buffer, with at least size bytes
 // @param size Size in bytes
-// @return Data
+// @return Number of bytes read
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-mobius::core::bytearray
-reader_impl_slice::read (size_type size)
+reader_impl_slice::size_type
+reader_impl_slice::read_into (std::uint8_t *buffer, size_type size)
 {
-    if (reader_.tell () > end_ || reader_.tell () < start_)
-        return {};
+    size_type pos = reader_.tell ();
 
-    if (size + reader_.tell () > end_)
-        size = end_ - reader_.tell () + 1;
+    if (pos > end_ || pos < start_)
+        return 0;
 
-    return reader_.read (size);
+    if (size + pos > end_)
+        size = end_ - pos + 1;
+
+    return reader_.read_into (buffer, size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from a given position into buffer
+// @param offset Offset in bytes from the beginning of slice
+// @param buffer Buffer, with at least size bytes
+// @param size Size in bytes
+// @return Number of bytes read
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+reader_impl_slice::size_type
+reader_impl_slice::read_at (size_type offset, std::uint8_t *buffer,
+                            size_type size)
+{
+    size_type slice_size = get_size ();
+
+    if (offset >= slice_size)
+        return 0;
+
+    if (size > slice_size - offset)
+        size = slice_size - offset;
+
+    return reader_.read_at (start_ + offset, buffer, size);
 }
 
 } // namespace mobius::core::io
@@ -0,0 +1,602 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/exception.inc>
+#include <mobius/core/kff/hash_index.hpp>
+#include <mobius/core/string_functions.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <stdexcept>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace mobius::core::kff
+{
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Minimum number of bloom filter bits per digest
+static constexpr std::uint64_t BLOOM_BITS_PER_DIGEST = 12;
+
+// @brief Number of bloom filter probes per digest
+static constexpr int BLOOM_PROBES = 4;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Digest table (one per hash type)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct digest_table
+{
+    // @brief Digest size in bytes
+    std::size_t digest_size = 0;
+
+    // @brief Digests, stored back to back (sorted after build)
+    std::vector<std::uint8_t> digests;
+
+    // @brief Bloom filter bits
+    std::vector<std::uint64_t> bloom;
+
+    // @brief Bloom filter bit mask (number of bits - 1)
+    std::uint64_t bloom_mask = 0;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of digests
+    // @return Number of digests
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_count () const
+    {
+        return digest_size ? digests.size () / digest_size : 0;
+    }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Decode hexadecimal string
+// @param s Hex string
+// @param data Decoded data
+// @return <b>true</b> if s is a valid hex string, <b>false</b> otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_decode_hex (const std::string &s, mobius::core::bytearray &data)
+{
+    auto nibble = [] (char c) -> int
+    {
+        if (c >= '0' && c <= '9')
+            return c - '0';
+
+        if (c >= 'a' && c <= 'f')
+            return c - 'a' + 10;
+
+        if (c >= 'A' && c <= 'F')
+            return c - 'A' + 10;
+
+        return -1;
+    };
+
+    if (s.empty () || s.size () % 2)
+        return false;
+
+    data.resize (s.size () / 2);
+
+    for (std::size_t i = 0; i < data.size (); i++)
+    {
+        int hi = nibble (s[i * 2]);
+        int lo = nibble (s[i * 2 + 1]);
+
+        if (hi < 0 || lo < 0)
+            return false;
+
+        data[i] = (hi << 4) | lo;
+    }
+
+    return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get bloom filter hashes for digest
+// @param p Digest
+// @param size Digest size
+// @return Pair of 64-bit hashes
+//
+// Digests are already uniformly distributed, so their own bytes are used as
+// hash values. Short digests are mixed with FNV-1a.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::pair<std::uint64_t, std::uint64_t>
+_bloom_hashes (const std::uint8_t *p, std::size_t size)
+{
+    std::uint64_t h1;
+    std::uint64_t h2;
+
+    if (size >= 8)
+    {
+        std::memcpy (&h1, p, 8);
+        std::memcpy (&h2, p + size - 8, 8);
+    }
+
+    else
+    {
+        h1 = 0xcbf29ce484222325ULL;
+
+        for (std::size_t i = 0; i < size; i++)
+            h1 = (h1 ^ p[i]) * 0x100000001b3ULL;
+
+        h2 = std::rotl (h1, 31);
+    }
+
+    return {h1, h2 | 1};
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Sort fixed size records and remove duplicates
+// @param data Records, stored back to back
+//
+// Records are handled as std::array objects, so std::sort can move them
+// directly. Used for the common digest sizes.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+template <std::size_t N>
+static void
+_sort_records (std::vector<std::uint8_t> &data)
+{
+    using record_type = std::array<std::uint8_t, N>;
+    static_assert (sizeof (record_type) == N);
+
+    auto first = reinterpret_cast<record_type *> (data.data ());
+    auto last = first + data.size () / N;
+
+    std::sort (first, last);
+    last = std::unique (first, last);
+
+    data.resize ((last - first) * N);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Sort records of any size and remove duplicates
+// @param data Records, stored back to back
+// @param size Record size
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+_sort_records (std::vector<std::uint8_t> &data, std::size_t size)
+{
+    switch (size)
+    {
+    case 16:
+        _sort_records<16> (data);
+        return; // MD5
+
+    case 20:
+        _sort_records<20> (data);
+        return; // SHA-1
+
+    case 28:
+        _sort_records<28> (data);
+        return; // SHA2-224
+
+    case 32:
+        _sort_records<32> (data);
+        return; // SHA2-256
+
+    case 48:
+        _sort_records<48> (data);
+        return; // SHA2-384
+
+    case 64:
+        _sort_records<64> (data);
+        return; // SHA2-512
+
+    default:
+        break;
+    }
+
+    // generic case: sort record offsets, then copy records
+    std::vector<std::size_t> offsets (data.size () / size);
+
+    for (std::size_t i = 0; i < offsets.size (); i++)
+        offsets[i] = i * size;
+
+    auto less = [&data, size] (std::size_t a, std::size_t b)
+    { return std::memcmp (data.data () + a, data.data () + b, size) < 0; };
+
+    auto equal = [&data, size] (std::size_t a, std::size_t b)
+    { return std::memcmp (data.data () + a, data.data () + b, size) == 0; };
+
+    std::sort (offsets.begin (), offsets.end (), less);
+    offsets.erase (std::unique (offsets.begin (), offsets.end (), equal),
+                   offsets.end ());
+
+    std::vector<std::uint8_t> sorted_data (offsets.size () * size);
+    auto p = sorted_data.data ();
+
+    for (auto offset : offsets)
+    {
+        std::memcpy (p, data.data () + offset, size);
+        p += size;
+    }
+
+    data.swap (sorted_data);
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief hash_index implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class hash_index::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl () = default;
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void add (const std::string &, const std::string &);
+    void add (const std::string &, const mobius::core::bytearray &);
+    void build ();
+    void clear ();
+    std::uint64_t get_size () const;
+    bool contains (const std::string &, const std::string &) const;
+    bool contains (const std::string &, const mobius::core::bytearray &) const;
+
+  private:
+    // @brief Digest tables, by hash type
+    std::unordered_map<std::string, digest_table> tables_;
+
+    // @brief Values that are not valid digests ("type:value")
+    std::unordered_set<std::string> other_values_;
+
+    // @brief Index built flag
+    bool is_built_ = true;
+
+    // Helper functions
+    bool _contains (const digest_table &, const std::uint8_t *) const;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add hash
+// @param type Hash type
+// @param value Hash value, as hex string
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hash_index::impl::add (const std::string &type, const std::string &value)
+{
+    mobius::core::bytearray digest;
+
+    if (_decode_hex (value, digest))
+        add (type, digest);
+
+    else
+    {
+        other_values_.insert (type + ':' + mobius::core::string::tolower (value));
+        is_built_ = false;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add hash
+// @param type Hash type
+// @param digest Hash digest
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hash_index::impl::add (
+    const std::string &type, const mobius::core::bytearray &digest
+)
+{
+    auto &table = tables_[type];
+
+    if (table.digest_size == 0)
+        table.digest_size = digest.size ();
+
+    if (digest.size () == table.digest_size && !digest.empty ())
+        table.digests.insert (table.digests.end (), digest.begin (),
+                              digest.end ());
+
+    else
+        other_values_.insert (type + ':' + digest.to_hexstring ());
+
+    is_built_ = false;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Build index
+//
+// Sort digests, remove duplicates and fill bloom filters.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hash_index::impl::build ()
+{
+    if (is_built_)
+        return;
+
+    for (auto &[type, table] : tables_)
+    {
+        if (!table.digest_size)
+            continue;
+
+        _sort_records (table.digests, table.digest_size);
+        table.digests.shrink_to_fit ();
+
+        // fill bloom filter
+        auto count = table.get_count ();
+        auto bits = std::bit_ceil (
+            std::max<std::uint64_t> (count * BLOOM_BITS_PER_DIGEST, 64));
+
+        table.bloom.assign (bits / 64, 0);
+        table.bloom_mask = bits - 1;
+
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            auto [h1, h2] = _bloom_hashes (
+                table.digests.data () + i * table.digest_size,
+                table.digest_size);
+
+            for (int j = 0; j < BLOOM_PROBES; j++)
+            {
+                auto bit = (h1 + j * h2) & table.bloom_mask;
+                table.bloom[bit >> 6] |= std::uint64_t (1) << (bit & 63);
+            }
+        }
+    }
+
+    is_built_ = true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Remove all hashes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hash_index::impl::clear ()
+{
+    tables_.clear ();
+    other_values_.clear ();
+    is_built_ = true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of hashes
+// @return Number of hashes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+hash_index::impl::get_size () const
+{
+    std::uint64_t size = other_values_.size ();
+
+    for (const auto &[type, table] : tables_)
+        size += table.get_count ();
+
+    return size;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if index contains hash
+// @param type Hash type
+// @param value Hash value, as hex string
+// @return <b>true</b> if hash is found, <b>false</b> otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+hash_index::impl::contains (
+    const std::string &type, const std::string &value
+) const
+{
+    mobius::core::bytearray digest;
+
+    if (_decode_hex (value, digest))
+        return contains (type, digest);
+
+    if (!is_built_)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("index not built"));
+
+    return other_values_.find (
+               type + ':' + mobius::core::string::tolower (value)) !=
+           other_values_.end ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if index contains hash
+// @param type Hash type
+// @param digest Hash digest
+// @return <b>true</b> if hash is found, <b>false</b> otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+hash_index::impl::contains (
+    const std::string &type, const mobius::core::bytearray &digest
+) const
+{
+    if (!is_built_)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("index not built"));
+
+    auto iter = tables_.find (type);
+
+    if (iter != tables_.end () && iter->second.digest_size == digest.size ())
+        return _contains (iter->second, digest.data ());
+
+    if (other_values_.empty ())
+        return false;
+
+    return other_values_.find (type + ':' + digest.to_hexstring ()) !=
+           other_values_.end ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if digest table contains digest
+// @param table Digest table
+// @param digest Digest, with table.digest_size bytes
+// @return <b>true</b> if digest is found, <b>false</b> otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+hash_index::impl::_contains (
+    const digest_table &table, const std::uint8_t *digest
+) const
+{
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // check bloom filter
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    if (table.bloom.empty ())
+        return false;
+
+    auto [h1, h2] = _bloom_hashes (digest, table.digest_size);
+
+    for (int j = 0; j < BLOOM_PROBES; j++)
+    {
+        auto bit = (h1 + j * h2) & table.bloom_mask;
+
+        if (!(table.bloom[bit >> 6] & (std::uint64_t (1) << (bit & 63))))
+            return false;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // binary search sorted digests
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    const auto size = table.digest_size;
+    const auto data = table.digests.data ();
+    std::uint64_t lo = 0;
+    std::uint64_t hi = table.get_count ();
+
+    while (lo < hi)
+    {
+        auto mid = lo + (hi - lo) / 2;
+        int rc = std::memcmp (data + mid * size, digest, size);
+
+        if (rc == 0)
+            return true;
+
+        else if (rc < 0)
+            lo = mid + 1;
+
+        else
+            hi = mid;
+    }
+
+    return false;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+hash_index::hash_index ()
+    : impl_ (std::make_shared<impl> ())
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add hash
+// @param type Hash type
+// @param value Hash value, as hex string
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hash_index::add (const std::string &type, const std::string &value)
+{
+    impl_->add (type, value);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add hash
+// @param type Hash type
+// @param digest Hash digest
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hash_index::add (const std::string &type, const mobius::core::bytearray &digest)
+{
+    impl_->add (type, digest);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Build index
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hash_index::build ()
+{
+    impl_->build ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Remove all hashes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hash_index::clear ()
+{
+    impl_->clear ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of hashes
+// @return Number of hashes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+hash_index::get_size () const
+{
+    return impl_->get_size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if index contains hash
+// @param type Hash type
+// @param value Hash value, as hex string
+// @return <b>true</b> if hash is found, <b>false</b> otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+hash_index::contains (const std::string &type, const std::string &value) const
+{
+    return impl_->contains (type, value);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if index contains hash
+// @param type Hash type
+// @param digest Hash digest
+// @return <b>true</b> if hash is found, <b>false</b> otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+hash_index::contains (
+    const std::string &type, const mobius::core::bytearray &digest
+) const
+{
+    return impl_->contains (type, digest);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if index contains hashes (batch lookup)
+// @param type Hash type
+// @param digests Hash digests
+// @return Vector of flags, one for each digest
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<bool>
+hash_index::contains (
+    const std::string &type, std::span<const mobius::core::bytearray> digests
+) const
+{
+    std::vector<bool> flags (digests.size ());
+
+    for (std::size_t i = 0; i < digests.size (); i++)
+        flags[i] = impl_->contains (type, digests[i]);
+
+    return flags;
+}
+
+} // namespace mobius::core::kff
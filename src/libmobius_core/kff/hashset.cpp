@@ -19,8 +19,13 @@
 #include <mobius/core/database/connection_pool.hpp>
 #include <mobius/core/database/database.hpp>
 #include <mobius/core/database/meta_table.hpp>
+#include <mobius/core/exception.inc>
 #include <mobius/core/kff/hashset.hpp>
 #include <mobius/core/string_functions.hpp>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
 
 namespace mobius::core::kff
 {
@@ -33,6 +38,193 @@ namespace
 static constexpr int SCHEMA_VERSION = 1;
 using hash_type = std::pair<std::string, std::string>;
 
+// @brief Block size for reading import files
+static constexpr std::uint64_t IMPORT_BLOCK_SIZE = 1024 * 1024;
+
+// @brief Number of lines between progress callbacks
+static constexpr std::uint64_t IMPORT_PROGRESS_LINES = 65536;
+
+// @brief SQLite page cache size during import (negative = size in KiB)
+static constexpr int IMPORT_CACHE_SIZE = -262144;
+
+// @brief Buffer size for writing export files
+static constexpr std::size_t EXPORT_BUFFER_SIZE = 1024 * 1024;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Remove blanks and quotes around string
+// @param s String
+// @return Trimmed string
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::string_view
+_trim (std::string_view s)
+{
+    while (!s.empty () && (s.front () == ' ' || s.front () == '\t'))
+        s.remove_prefix (1);
+
+    while (!s.empty () && (s.back () == ' ' || s.back () == '\t'))
+        s.remove_suffix (1);
+
+    if (s.size () >= 2 && s.front () == '"' && s.back () == '"')
+        s = s.substr (1, s.size () - 2);
+
+    return s;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get hash type and value from the first two fields of a line
+// @param line Line
+// @param sep Field separator
+// @param type Hash type (first field)
+// @param value Hash value (second field)
+// @return <b>true</b> if line has at least two fields, <b>false</b> otherwise
+//
+// Any field after the second one is ignored.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_get_type_and_value (
+    std::string_view line,
+    char sep,
+    std::string_view &type,
+    std::string_view &value
+)
+{
+    auto pos = line.find (sep);
+
+    if (pos == std::string_view::npos)
+        return false;
+
+    type = line.substr (0, pos);
+    value = line.substr (pos + 1);
+    value = value.substr (0, value.find (sep));
+
+    return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Split CSV line into fields
+// @param line CSV line
+// @param max_fields Max number of fields to split
+// @return Fields
+//
+// Quoted fields may contain commas and escaped quotes ("").
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::vector<std::string>
+_split_csv_line (std::string_view line, std::size_t max_fields)
+{
+    std::vector<std::string> fields;
+    std::string field;
+    bool in_quotes = false;
+
+    for (std::size_t i = 0; i < line.size () && fields.size () < max_fields;
+         i++)
+    {
+        char c = line[i];
+
+        if (in_quotes)
+        {
+            if (c != '"')
+                field += c;
+
+            else if (i + 1 < line.size () && line[i + 1] == '"')
+            {
+                field += '"';
+                i++;
+            }
+
+            else
+                in_quotes = false;
+        }
+
+        else if (c == '"')
+            in_quotes = true;
+
+        else if (c == ',')
+        {
+            fields.push_back (field);
+            field.clear ();
+        }
+
+        else
+            field += c;
+    }
+
+    if (fields.size () < max_fields)
+        fields.push_back (field);
+
+    return fields;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get hash type from NSRL RDS column name
+// @param name Column name (e.g. "SHA-1")
+// @return Hash type or empty string, if column is not a hash value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::string
+_get_nsrl_hash_type (const std::string &name)
+{
+    std::string s;
+
+    for (auto c : mobius::core::string::toupper (name))
+        if (c != '-' && c != '_' && c != ' ')
+            s += c;
+
+    if (s == "MD5")
+        return "md5";
+
+    if (s == "SHA1")
+        return "sha1";
+
+    if (s == "SHA256")
+        return "sha2-256";
+
+    return {};
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set SQLite page cache size, restoring previous value on destruction
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class cache_size_guard
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructor
+    // @param db Database object
+    // @param size Cache size, as in "PRAGMA cache_size"
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    cache_size_guard (mobius::core::database::database db, int size)
+        : db_ (db)
+    {
+        auto stmt = db_.new_statement ("PRAGMA cache_size");
+
+        if (stmt.fetch_row ())
+            old_size_ = stmt.get_column_int (0);
+
+        stmt.reset ();
+        db_.execute ("PRAGMA cache_size = " + std::to_string (size));
+    }
+
+    cache_size_guard (const cache_size_guard &) = delete;
+    cache_size_guard &operator= (const cache_size_guard &) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Destructor
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    ~cache_size_guard ()
+    {
+        try
+        {
+            db_.execute ("PRAGMA cache_size = " + std::to_string (old_size_));
+        }
+        catch (...)
+        {
+        }
+    }
+
+  private:
+    mobius::core::database::database db_;
+    int old_size_ = -2000;
+};
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Hash collection
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -142,6 +334,16 @@ class hashset::impl
         return connection_pool_.acquire ();
     }
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get revision number
+    // @return Revision number, incremented whenever hashes are modified
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_revision () const
+    {
+        return revision_;
+    }
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // @brief Create new database transaction
     // @return new transaction object
@@ -163,6 +365,12 @@ class hashset::impl
     void remove (const std::string &, const std::string &);
     bool lookup (const std::string &, const std::string &) const;
     mobius::core::collection<hash_type> get_hashes () const;
+    std::uint64_t import_hashes (mobius::core::io::reader,
+                                 const std::string &,
+                                 const std::string &,
+                                 const progress_callback_type &);
+    std::uint64_t export_hashes (mobius::core::io::writer,
+                                 const std::string &) const;
 
   private:
     // @brief Database connection pool
@@ -183,6 +391,9 @@ class hashset::impl
     // @brief Size loaded flag
     mutable bool size_loaded_ = false;
 
+    // @brief Revision number
+    std::atomic<std::uint64_t> revision_ = 0;
+
     // Helper functions
     void _load_data () const;
     void _load_size () const;
@@ -294,6 +505,7 @@ hashset::impl::create (bool flag)
     stmt.execute ();
 
     transaction.commit ();
+    revision_++;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -310,6 +522,7 @@ hashset::impl::clear ()
 
     size_ = 0;
     size_loaded_ = true;
+    revision_++;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -339,8 +552,10 @@ hashset::impl::add (const std::string &type, const std::string &value)
 
     if (changes)
     {
-        _load_size ();
-        size_ += changes;
+        if (size_loaded_)
+            size_ += changes;
+
+        revision_++;
     }
 }
 
@@ -372,8 +587,10 @@ hashset::impl::remove (const std::string &type, const std::string &value)
 
     if (changes)
     {
-        _load_size ();
-        size_ += changes;
+        if (size_loaded_)
+            size_ -= changes;
+
+        revision_++;
     }
 }
 
@@ -415,6 +632,268 @@ hashset::impl::get_hashes () const
         std::make_shared<collection_impl> (stmt));
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Import hashes from hash list
+// @param reader Reader object
+// @param format Hash list format
+// @param hash_type Hash type, for "text" format
+// @param progress_callback Called with (bytes read, hashes read) periodically
+// @return Number of hashes added
+//
+// Formats are:
+//   text: one hash value per line
+//   tab: hash type and value, separated by tab
+//   csv: header line, then hash type and value, separated by comma
+//   nsrl: NSRL RDS file (NSRLFile.txt), with MD5, SHA-1 and SHA-256 columns
+//
+// Hashes are first staged into a temporary table without indexes, then
+// copied into hash table in primary key order, which is much faster than
+// inserting them one by one in random order.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+hashset::impl::import_hashes (
+    mobius::core::io::reader reader,
+    const std::string &format,
+    const std::string &hash_type,
+    const progress_callback_type &progress_callback
+)
+{
+    if (format != "text" && format != "tab" && format != "csv" &&
+        format != "nsrl")
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("unknown hash list format: " + format));
+
+    if (format == "text" && hash_type.empty ())
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("hash type must be set for text format"));
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // create staging table
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    auto db = connection_pool_.get_database ();
+    auto transaction = db.new_transaction ();
+    cache_size_guard cache_guard (db, IMPORT_CACHE_SIZE);
+
+    db.execute ("CREATE TEMP TABLE IF NOT EXISTS hash_import ("
+                "type TEXT NOT NULL,"
+                "value TEXT NOT NULL);");
+
+    db.execute ("DELETE FROM temp.hash_import");
+
+    auto stmt = db.new_statement ("INSERT INTO temp.hash_import "
+                                  "VALUES (?, ?)");
+
+    std::uint64_t hashes_read = 0;
+
+    auto add_hash = [&stmt, &hashes_read] (const std::string &type,
+                                           std::string_view value)
+    {
+        if (type.empty () || value.empty ())
+            return;
+
+        stmt.bind (1, type);
+        stmt.bind (2, mobius::core::string::tolower (std::string (value)));
+        stmt.execute ();
+        hashes_read++;
+    };
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // line parser
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t line_count = 0;
+    std::vector<std::pair<std::size_t, std::string>> nsrl_columns;
+    std::size_t nsrl_fields = 0;
+
+    auto parse_line = [&] (std::string_view line)
+    {
+        line_count++;
+
+        if (!line.empty () && line.back () == '\r')
+            line.remove_suffix (1);
+
+        if (format == "text")
+        {
+            line = _trim (line);
+
+            if (!line.empty () && line[0] != '#')
+                add_hash (hash_type, line);
+        }
+
+        else if (format == "tab")
+        {
+            std::string_view type, value;
+
+            if (_get_type_and_value (line, '\t', type, value))
+                add_hash (std::string (_trim (type)), _trim (value));
+        }
+
+        else if (format == "csv")
+        {
+            std::string_view type, value;
+
+            if (line_count > 1 && _get_type_and_value (line, ',', type, value))
+                add_hash (std::string (_trim (type)), _trim (value));
+        }
+
+        else if (line_count == 1) // nsrl header
+        {
+            auto fields = _split_csv_line (line, std::string_view::npos);
+
+            for (std::size_t i = 0; i < fields.size (); i++)
+            {
+                auto type = _get_nsrl_hash_type (fields[i]);
+
+                if (!type.empty ())
+                {
+                    nsrl_columns.emplace_back (i, type);
+                    nsrl_fields = i + 1;
+                }
+            }
+
+            if (nsrl_columns.empty ())
+                throw std::runtime_error (
+                    MOBIUS_EXCEPTION_MSG ("invalid NSRL RDS header"));
+        }
+
+        else // nsrl data
+        {
+            auto fields = _split_csv_line (line, nsrl_fields);
+
+            for (const auto &[idx, type] : nsrl_columns)
+                if (idx < fields.size ())
+                    add_hash (type, _trim (fields[idx]));
+        }
+    };
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // read data, line by line
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t bytes_read = 0;
+    std::string pending;
+    auto data = reader.read (IMPORT_BLOCK_SIZE);
+
+    while (!data.empty ())
+    {
+        bytes_read += data.size ();
+
+        auto p = reinterpret_cast<const char *> (data.data ());
+        auto end = p + data.size ();
+
+        while (p < end)
+        {
+            auto nl = static_cast<const char *> (std::memchr (p, '\n', end - p));
+
+            if (!nl)
+            {
+                pending.append (p, end);
+                break;
+            }
+
+            if (pending.empty ())
+                parse_line (std::string_view (p, nl - p));
+
+            else
+            {
+                pending.append (p, nl);
+                parse_line (pending);
+                pending.clear ();
+            }
+
+            p = nl + 1;
+
+            if (progress_callback && line_count % IMPORT_PROGRESS_LINES == 0)
+                progress_callback (bytes_read, hashes_read);
+        }
+
+        data = reader.read (IMPORT_BLOCK_SIZE);
+    }
+
+    if (!pending.empty ())
+        parse_line (pending);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // copy staged hashes into hash table
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    db.execute ("INSERT OR IGNORE INTO hash "
+                "SELECT type, value "
+                "FROM temp.hash_import "
+                "ORDER BY type, value");
+
+    auto changes = db.get_changes ();
+
+    db.execute ("DROP TABLE temp.hash_import");
+    transaction.commit ();
+
+    if (progress_callback)
+        progress_callback (bytes_read, hashes_read);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // update size_
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    if (changes)
+    {
+        size_loaded_ = false;
+        revision_++;
+    }
+
+    return changes;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Export hashes to hash list
+// @param writer Writer object
+// @param format Hash list format ("tab" or "csv")
+// @return Number of hashes written
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+hashset::impl::export_hashes (
+    mobius::core::io::writer writer, const std::string &format
+) const
+{
+    if (format != "tab" && format != "csv")
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("unknown hash list format: " + format));
+
+    const char separator = (format == "csv") ? ',' : '\t';
+    const char *eol = (format == "csv") ? "\r\n" : "\n";
+
+    auto db = connection_pool_.get_database ();
+
+    auto stmt = db.new_statement ("SELECT type, value "
+                                  "FROM hash "
+                                  "ORDER BY type, value");
+
+    std::string buffer;
+    buffer.reserve (EXPORT_BUFFER_SIZE + 256);
+
+    if (format == "csv")
+        buffer = "type,value\r\n";
+
+    std::uint64_t count = 0;
+
+    while (stmt.fetch_row ())
+    {
+        buffer += stmt.get_column_string (0);
+        buffer += separator;
+        buffer += stmt.get_column_string (1);
+        buffer += eol;
+        count++;
+
+        if (buffer.size () >= EXPORT_BUFFER_SIZE)
+        {
+            writer.write (mobius::core::bytearray (buffer));
+            buffer.clear ();
+        }
+    }
+
+    if (!buffer.empty ())
+        writer.write (mobius::core::bytearray (buffer));
+
+    writer.flush ();
+
+    return count;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Constructor
 // @param Path Database path
@@ -484,6 +963,16 @@ hashset::get_size () const
     return impl_->get_size ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get revision number
+// @return Revision number, incremented whenever hashes are modified
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+hashset::get_revision () const
+{
+    return impl_->get_revision ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Create hashset
 // @param flag Is alert flag
@@ -547,4 +1036,37 @@ hashset::get_hashes () const
     return impl_->get_hashes ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Import hashes from hash list
+// @param reader Reader object
+// @param format Hash list format ("text", "tab", "csv" or "nsrl")
+// @param hash_type Hash type, for "text" format
+// @param progress_callback Called with (bytes read, hashes read) periodically
+// @return Number of hashes added
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+hashset::import_hashes (
+    mobius::core::io::reader reader,
+    const std::string &format,
+    const std::string &hash_type,
+    const progress_callback_type &progress_callback
+)
+{
+    return impl_->import_hashes (reader, format, hash_type, progress_callback);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Export hashes to hash list
+// @param writer Writer object
+// @param format Hash list format ("tab" or "csv")
+// @return Number of hashes written
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+hashset::export_hashes (
+    mobius::core::io::writer writer, const std::string &format
+) const
+{
+    return impl_->export_hashes (writer, format);
+}
+
 } // namespace mobius::core::kff
@@ -20,11 +20,13 @@
 #include <mobius/core/io/file.hpp>
 #include <mobius/core/io/folder.hpp>
 #include <mobius/core/io/path.hpp>
+#include <mobius/core/kff/hash_index.hpp>
 #include <mobius/core/kff/kff.hpp>
 #include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 namespace mobius::core::kff
 {
@@ -46,6 +48,18 @@ static std::once_flag is_loaded_;
 // @brief Database schema version
 static constexpr int SCHEMA_VERSION = 1;
 
+// @brief Hashes from alert hashsets
+static hash_index alert_index_;
+
+// @brief Hashes from non-alert hashsets
+static hash_index ignore_index_;
+
+// @brief Hashset revisions, when indexes were built
+static std::unordered_map<std::string, std::uint64_t> index_revisions_;
+
+// @brief Are indexes valid
+static bool index_valid_ = false;
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Initialize kff data
 // Read .sqlite files from kff config dir
@@ -74,6 +88,68 @@ _init ()
     }
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if hash indexes are up to date (mutex_ must be locked)
+// @return <b>true</b> if indexes are valid, <b>false</b> otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+_is_index_valid ()
+{
+    if (!index_valid_ || index_revisions_.size () != hashsets_.size ())
+        return false;
+
+    for (const auto &[id, h] : hashsets_)
+    {
+        auto iter = index_revisions_.find (id);
+
+        if (iter == index_revisions_.end () ||
+            iter->second != h.get_revision ())
+            return false;
+    }
+
+    return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get hash indexes, building them if necessary
+// @return Alert and non-alert indexes
+//
+// Indexes are rebuilt from hashset databases whenever a hashset is created,
+// removed or modified. Index objects are replaced, never modified, so the
+// returned copies can be used without locking.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::pair<hash_index, hash_index>
+_get_indexes ()
+{
+    const std::lock_guard<std::mutex> lock (mutex_);
+
+    if (!_is_index_valid ())
+    {
+        hash_index alert_index;
+        hash_index ignore_index;
+
+        index_revisions_.clear ();
+
+        for (const auto &[id, h] : hashsets_)
+        {
+            index_revisions_[id] = h.get_revision ();
+            auto &idx = h.is_alert () ? alert_index : ignore_index;
+
+            for (const auto &[type, value] : h.get_hashes ())
+                idx.add (type, value);
+        }
+
+        alert_index.build ();
+        ignore_index.build ();
+
+        alert_index_ = alert_index;
+        ignore_index_ = ignore_index;
+        index_valid_ = true;
+    }
+
+    return {alert_index_, ignore_index_};
+}
+
 } // namespace
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -129,6 +205,7 @@ kff::new_hashset (const std::string &id, bool is_alert)
     {
         const std::lock_guard<std::mutex> lock (mutex_);
         hashsets_.emplace (id, h);
+        index_valid_ = false;
     }
 
     return h;
@@ -147,6 +224,7 @@ kff::remove_hashset (const std::string &id)
     {
         const std::lock_guard<std::mutex> lock (mutex_);
         hashsets_.erase (id);
+        index_valid_ = false;
     }
 
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -182,6 +260,12 @@ kff::alert_lookup (const std::string &type, const std::string &value) const
 {
     std::vector<std::string> hashset_ids;
 
+    // check alert index first, so unknown hashes never hit the databases
+    auto [alert_index, ignore_index] = _get_indexes ();
+
+    if (!alert_index.contains (type, value))
+        return hashset_ids;
+
     for (const auto &p : get_hashsets ())
     {
         auto id = p.first;
@@ -203,33 +287,45 @@ kff::alert_lookup (const std::string &type, const std::string &value) const
 char
 kff::lookup (const std::string &type, const std::string &value) const
 {
-    auto hashsets = get_hashsets ();
+    auto [alert_index, ignore_index] = _get_indexes ();
 
-    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    // search first into is_alert hashsets
-    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    for (const auto &p : get_hashsets ())
-    {
-        auto id = p.first;
-        auto hashset = p.second;
+    if (alert_index.contains (type, value))
+        return 'A';
 
-        if (hashset.is_alert () && hashset.lookup (type, value))
-            return 'A';
-    }
+    if (ignore_index.contains (type, value))
+        return 'I';
 
-    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    // then, search into non is_alert hashsets
-    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    for (const auto &p : get_hashsets ())
+    return 'N';
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Lookup many hashes in all hash sets
+// @param type Hash type
+// @param digests Hash digests
+// @return Vector of 'A' alert, 'I' ignored, 'N' not found, one per digest
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<char>
+kff::lookup (
+    const std::string &type, std::span<const mobius::core::bytearray> digests
+) const
+{
+    auto [alert_index, ignore_index] = _get_indexes ();
+    std::vector<char> results;
+    results.reserve (digests.size ());
+
+    for (const auto &digest : digests)
     {
-        auto id = p.first;
-        auto hashset = p.second;
+        if (alert_index.contains (type, digest))
+            results.push_back ('A');
+
+        else if (ignore_index.contains (type, digest))
+            results.push_back ('I');
 
-        if (!hashset.is_alert () && hashset.lookup (type, value))
-            return 'I';
+        else
+            results.push_back ('N');
     }
 
-    return 'N';
+    return results;
 }
 
 } // namespace mobius::core::kff
@@ -17,9 +17,11 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <fstream>
 #include <mobius/core/log.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
 #include <mutex>
 #include <thread>
-#include <unordered_map>
 
 namespace mobius::core
 {
@@ -100,38 +102,431 @@ class log_impl
 namespace
 {
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// Control variables
+// @brief Log record, formatted by the writer thread
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Log file full path
-static std::string log_path_;
+struct log_record
+{
+    mobius::core::datetime::datetime timestamp;
+    const char *type = nullptr;
+    std::string filename;
+    std::string funcname;
+    std::size_t line_number = 0;
+    std::string text;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Asynchronous log file writer
+//
+// Records are pushed by any thread into a bounded lock-free ring buffer
+// (multiple producers, single consumer) and written by a background thread
+// that keeps the log file open. When the ring is full, producers yield
+// until the writer frees some slots, so no record is lost. The file is
+// flushed after each batch of records. Error records are waited for, so
+// they are on disk before the caller goes on.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class log_writer
+{
+  public:
+    log_writer ();
+    log_writer (const log_writer &) = delete;
+    log_writer &operator= (const log_writer &) = delete;
+
+    void set_path (const std::string &);
+    void set_level (event::type);
+    bool is_enabled (event::type) const;
+    void write (event::type, const char *, const std::string &,
+                const std::string &, std::size_t, const std::string &);
+    void flush ();
+    void stop ();
+
+  private:
+    // @brief Ring buffer slot
+    struct slot
+    {
+        std::atomic<std::uint64_t> seq;
+        log_record record;
+    };
+
+    // @brief Ring buffer capacity (power of two)
+    static constexpr std::uint64_t CAPACITY = 4096;
+
+    // @brief Ring buffer
+    std::unique_ptr<slot[]> slots_;
+
+    // @brief Next position to be written by producers
+    std::atomic<std::uint64_t> enqueue_pos_ = 0;
+
+    // @brief Next position to be read by writer thread
+    std::uint64_t dequeue_pos_ = 0;
+
+    // @brief Number of records already written to file
+    std::atomic<std::uint64_t> written_ = 0;
+
+    // @brief Signal counter, used to wake up writer thread
+    std::atomic<std::uint64_t> signal_ = 0;
+
+    // @brief Stop flag
+    std::atomic<bool> stop_ = false;
+
+    // @brief Whether writer thread is running
+    std::atomic<bool> is_running_ = false;
+
+    // @brief Max event type written to file
+    std::atomic<event::type> level_ = event::type::debug;
+
+    // @brief Log file path and its generation number
+    std::mutex path_mutex_;
+    std::string path_;
+    std::uint64_t path_generation_ = 0;
+
+    // @brief Mutex serializing direct writes, after writer thread stops
+    std::mutex write_mutex_;
+
+    // @brief Writer thread
+    std::thread thread_;
+
+    // Helper functions
+    std::uint64_t _push (log_record &&);
+    bool _pop (log_record &);
+    void _wake ();
+    void _wait_written (std::uint64_t);
+    void _run ();
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Format log record
+// @param out Output stream
+// @param r Log record
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+_format_record (std::ostream &out, const log_record &r)
+{
+    out << r.timestamp << ' ' << r.type << " " << r.funcname << '@'
+        << r.filename << ':' << r.line_number << " " << r.text << '\n';
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+log_writer::log_writer ()
+    : slots_ (std::make_unique<slot[]> (CAPACITY))
+{
+    for (std::uint64_t i = 0; i < CAPACITY; i++)
+        slots_[i].seq.store (i, std::memory_order_relaxed);
+
+    is_running_ = true;
+    thread_ = std::thread (&log_writer::_run, this);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set log file path
+// @param path Log file path
+//
+// Records already pushed are written to the previous file.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+log_writer::set_path (const std::string &path)
+{
+    flush ();
 
-// @brief Write mutex
-static std::mutex log_mutex_;
+    std::lock_guard<std::mutex> lock (path_mutex_);
+    path_ = path;
+    path_generation_++;
+}
 
-// @brief Log implementation map per thread
-static std::unordered_map<std::thread::id, std::shared_ptr<log_impl>> impl_map_;
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set max event type written to file
+// @param level Event type
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+log_writer::set_level (event::type level)
+{
+    level_.store (level, std::memory_order_relaxed);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if event type is written to file
+// @param type Event type
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+log_writer::is_enabled (event::type type) const
+{
+    return type <= level_.load (std::memory_order_relaxed);
+}
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Write event to log file
 // @param type Event type
+// @param type_name Event type name
 // @param filename Source file name
 // @param funcname Source function name
 // @param line_number Source file line number
 // @param text Text
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-_write_log (const std::string &type, const std::string &filename,
-            const std::string &funcname, std::size_t line_number,
-            const std::string &text)
+log_writer::write (event::type type, const char *type_name,
+                   const std::string &filename, const std::string &funcname,
+                   std::size_t line_number, const std::string &text)
+{
+    if (!is_enabled (type))
+        return;
+
+    log_record r {mobius::core::datetime::now (), type_name, filename,
+                  funcname, line_number, text};
+
+    // writer thread already stopped (process exit): write directly
+    if (!is_running_.load (std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> lock (write_mutex_);
+        std::lock_guard<std::mutex> path_lock (path_mutex_);
+        std::ofstream out (path_, std::ios_base::app);
+        _format_record (out, r);
+        return;
+    }
+
+    auto pos = _push (std::move (r));
+    _wake ();
+
+    if (type == event::type::error)
+        _wait_written (pos);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wait until every record pushed so far is written to file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+log_writer::flush ()
+{
+    auto pos = enqueue_pos_.load (std::memory_order_acquire);
+
+    if (pos > 0 && is_running_.load (std::memory_order_acquire))
+    {
+        _wake ();
+        _wait_written (pos - 1);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Write pending records and stop writer thread
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+log_writer::stop ()
+{
+    if (!thread_.joinable ())
+        return;
+
+    stop_.store (true, std::memory_order_release);
+    _wake ();
+    thread_.join ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Push record into ring buffer
+// @param r Log record
+// @return Record position
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+log_writer::_push (log_record &&r)
+{
+    auto pos = enqueue_pos_.load (std::memory_order_relaxed);
+    slot *s = nullptr;
+
+    while (true)
+    {
+        s = &slots_[pos & (CAPACITY - 1)];
+        auto seq = s->seq.load (std::memory_order_acquire);
+        auto diff = std::int64_t (seq) - std::int64_t (pos);
+
+        if (diff == 0)
+        {
+            if (enqueue_pos_.compare_exchange_weak (pos, pos + 1,
+                                                    std::memory_order_relaxed))
+                break;
+        }
+
+        else if (diff < 0) // ring is full
+        {
+            _wake ();
+            std::this_thread::yield ();
+            pos = enqueue_pos_.load (std::memory_order_relaxed);
+        }
+
+        else
+            pos = enqueue_pos_.load (std::memory_order_relaxed);
+    }
+
+    s->record = std::move (r);
+    s->seq.store (pos + 1, std::memory_order_release);
+
+    return pos;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Pop record from ring buffer (writer thread only)
+// @param r Log record
+// @return true if a record was popped, false if ring is empty
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+log_writer::_pop (log_record &r)
+{
+    slot &s = slots_[dequeue_pos_ & (CAPACITY - 1)];
+
+    if (s.seq.load (std::memory_order_acquire) != dequeue_pos_ + 1)
+        return false;
+
+    r = std::move (s.record);
+    s.record = log_record ();
+    s.seq.store (dequeue_pos_ + CAPACITY, std::memory_order_release);
+    dequeue_pos_++;
+
+    return true;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wake up writer thread
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+log_writer::_wake ()
+{
+    signal_.fetch_add (1, std::memory_order_release);
+    signal_.notify_one ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wait until record at a given position is written to file
+// @param pos Record position
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+log_writer::_wait_written (std::uint64_t pos)
+{
+    auto written = written_.load (std::memory_order_acquire);
+
+    while (written <= pos)
+    {
+        written_.wait (written, std::memory_order_acquire);
+        written = written_.load (std::memory_order_acquire);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Writer thread function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+log_writer::_run ()
+{
+    std::ofstream out;
+    std::uint64_t generation = 0;
+    log_record r;
+
+    while (true)
+    {
+        auto signal = signal_.load (std::memory_order_acquire);
+        bool stop = stop_.load (std::memory_order_acquire);
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // write pending records
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        if (_pop (r))
+        {
+            {
+                std::lock_guard<std::mutex> lock (path_mutex_);
+
+                if (generation != path_generation_)
+                {
+                    out.close ();
+                    out.clear ();
+
+                    if (!path_.empty ())
+                        out.open (path_, std::ios_base::app);
+
+                    generation = path_generation_;
+                }
+            }
+
+            do
+            {
+                if (out.is_open ())
+                    _format_record (out, r);
+            }
+            while (_pop (r));
+
+            out.flush ();
+            written_.store (dequeue_pos_, std::memory_order_release);
+            written_.notify_all ();
+        }
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // wait for new records
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        else if (stop)
+            break;
+
+        else
+            signal_.wait (signal, std::memory_order_acquire);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // from now on, records are written directly. Write records pushed while
+    // stopping and release any thread waiting for them
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    is_running_.store (false, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock (write_mutex_);
+
+        while (_pop (r))
+        {
+            if (out.is_open ())
+                _format_record (out, r);
+        }
+
+        out.flush ();
+    }
+
+    written_.store (UINT64_MAX, std::memory_order_release);
+    written_.notify_all ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get log writer
+// @return Log writer
+//
+// Writer is never deleted, as objects may log during static destruction. Its
+// thread is stopped at exit, after writing every pending record. Then, the
+// records are written directly to file.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static log_writer &
+_get_writer ()
 {
-    auto now = mobius::core::datetime::now ();
+    static log_writer *writer = [] {
+        auto w = new log_writer ();
+        std::atexit ([] { _get_writer ().stop (); });
+        return w;
+    }();
 
-    std::lock_guard<std::mutex> lock (log_mutex_);
+    return *writer;
+}
 
-    std::ofstream out (log_path_, std::ios_base::app);
+// @brief Log implementation for current thread
+thread_local std::weak_ptr<log_impl> thread_impl_;
 
-    out << now << ' ' << type << " " << funcname << '@' << filename << ':'
-        << line_number << " " << text << std::endl;
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Write event to log file
+// @param type Event type
+// @param type_name Event type name
+// @param filename Source file name
+// @param funcname Source function name
+// @param line_number Source file line number
+// @param text Text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+_write_log (event::type type, const char *type_name,
+            const std::string &filename, const std::string &funcname,
+            std::size_t line_number, const std::string &text)
+{
+    _get_writer ().write (type, type_name, filename, funcname, line_number,
+                          text);
 }
 
 } // namespace
@@ -143,8 +538,26 @@ _write_log (const std::string &type, const std::string &filename,
 void
 set_logfile_path (const std::string &path)
 {
-    std::lock_guard<std::mutex> lock (log_mutex_);
-    log_path_ = path;
+    _get_writer ().set_path (path);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set max event type written to log file
+// @param level Event type (e.g. event::type::warning writes errors and warnings)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+set_logfile_level (event::type level)
+{
+    _get_writer ().set_level (level);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wait until every pending event is written to log file
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+flush_log ()
+{
+    _get_writer ().flush ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -180,7 +593,8 @@ log_impl::error (const std::string &filename, const std::string &funcname,
 {
     events_.emplace_back (event::type::error, filename, funcname, line_number,
                           text);
-    _write_log ("ERR", filename, funcname, line_number, text);
+    _write_log (event::type::error, "ERR", filename, funcname, line_number,
+                text);
 
     has_errors_ = true;
 }
@@ -198,7 +612,8 @@ log_impl::warning (const std::string &filename, const std::string &funcname,
 {
     events_.emplace_back (event::type::warning, filename, funcname, line_number,
                           text);
-    _write_log ("WRN", filename, funcname, line_number, text);
+    _write_log (event::type::warning, "WRN", filename, funcname, line_number,
+                text);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -214,7 +629,8 @@ log_impl::info (const std::string &filename, const std::string &funcname,
 {
     events_.emplace_back (event::type::info, filename, funcname, line_number,
                           text);
-    _write_log ("INF", filename, funcname, line_number, text);
+    _write_log (event::type::info, "INF", filename, funcname, line_number,
+                text);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -231,7 +647,8 @@ log_impl::development (const std::string &filename, const std::string &funcname,
     events_.emplace_back (event::type::development, filename, funcname,
                           line_number, text);
 
-    _write_log ("DEV", filename, funcname, line_number, text);
+    _write_log (event::type::development, "DEV", filename, funcname, line_number,
+                text);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -249,7 +666,8 @@ log_impl::debug (const std::string &filename, const std::string &funcname,
         events_.emplace_back (event::type::debug, filename, funcname,
                               line_number, text);
 
-    _write_log ("DBG", filename, funcname, line_number, text);
+    _write_log (event::type::debug, "DBG", filename, funcname, line_number,
+                text);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -259,37 +677,20 @@ log_impl::debug (const std::string &filename, const std::string &funcname,
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 log::log (const std::string &filename, const std::string &funcname)
     : filename_ (filename),
-      funcname_ (funcname)
+      funcname_ (funcname),
+      impl_ (thread_impl_.lock ())
 {
-    auto thread_id = std::this_thread::get_id ();
-
-    std::lock_guard<std::mutex> lock (log_mutex_);
-
-    auto iter = impl_map_.find (thread_id);
-
-    if (iter == impl_map_.end ())
+    if (!impl_)
     {
         impl_ = std::make_shared<log_impl> ();
-        impl_map_[thread_id] = impl_;
+        thread_impl_ = impl_;
     }
-
-    else
-        impl_ = iter->second;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Destructor
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-log::~log ()
-{
-    // Remove impl from implementation map, as it is the last
-    if (impl_.use_count () <= 2)
-    {
-        auto thread_id = std::this_thread::get_id ();
-        std::lock_guard<std::mutex> lock (log_mutex_);
-        impl_map_.erase (thread_id);
-    }
-}
+log::~log () = default;
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Add error event
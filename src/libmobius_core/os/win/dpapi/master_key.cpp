@@ -65,6 +65,8 @@ class master_key::impl
     bool decrypt_with_password_hash (const std::string &,
                                      const mobius::core::bytearray &);
     bool decrypt_with_password (const std::string &, const std::string &);
+    bool test_password_hash (const std::string &,
+                             const mobius::core::bytearray &) const;
 
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // @brief Get revision
@@ -271,6 +273,9 @@ class master_key::impl
 
     // @brief True/false if object is valid
     std::uint32_t is_valid_ = false;
+
+    // Helper functions
+    mobius::core::bytearray _decrypt (const mobius::core::bytearray &) const;
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -310,13 +315,13 @@ master_key::impl::impl (mobius::core::io::reader reader, std::uint32_t flags)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Decrypt master key using key
+// @brief Decrypt cipher text using key
 // @param key Key
-// @return true if successful, false if not
+// @return Plain text, or empty bytearray if key is not valid
 // @see dpapick v0.3
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-bool
-master_key::impl::decrypt_with_key (const mobius::core::bytearray &key)
+mobius::core::bytearray
+master_key::impl::_decrypt (const mobius::core::bytearray &key) const
 {
     // generate prekey
     auto hash_id = mobius::core::os::win::dpapi::get_hash_id (hash_id_);
@@ -348,15 +353,27 @@ master_key::impl::decrypt_with_key (const mobius::core::bytearray &key)
     hmac_2.update (cleartxt);
 
     // check if decryption is successful
-    bool flag_decrypted = false;
+    if (hmac_2.get_digest () != hmac_value)
+        cleartxt.clear ();
 
-    if (hmac_2.get_digest () == hmac_value)
-    {
-        plain_text_ = cleartxt;
-        flag_decrypted = true;
-    }
+    return cleartxt;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Decrypt master key using key
+// @param key Key
+// @return true if successful, false if not
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+master_key::impl::decrypt_with_key (const mobius::core::bytearray &key)
+{
+    auto cleartxt = _decrypt (key);
 
-    return flag_decrypted;
+    if (cleartxt.empty ())
+        return false;
+
+    plain_text_ = cleartxt;
+    return true;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -375,6 +392,22 @@ master_key::impl::decrypt_with_password_hash (const std::string &sid,
     return decrypt_with_key (hmac.get_digest ());
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test password hash, without changing master key state
+// @param sid User SID as string
+// @param h Password hash
+// @return true if master key can be decrypted with password hash
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+master_key::impl::test_password_hash (const std::string &sid,
+                                      const mobius::core::bytearray &h) const
+{
+    mobius::core::crypt::hmac hmac ("sha1", h);
+    hmac.update (mobius::core::conv_charset (bytearray (sid) + bytearray ({0}),
+                                             "ASCII", "UTF-16LE"));
+    return !_decrypt (hmac.get_digest ()).empty ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Decrypt entry with password
 // @param sid User SID as string
@@ -441,6 +474,22 @@ master_key::decrypt_with_password (const std::string &sid,
     return impl_->decrypt_with_password (sid, password);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test password hash, without decrypting master key
+// @param sid User SID as string
+// @param password_hash Password hash
+// @return True if password hash decrypts master key, false otherwise
+//
+// This function does not modify the object, so it can be called from
+// several threads at once.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+master_key::test_password_hash (
+    const std::string &sid, const mobius::core::bytearray &password_hash) const
+{
+    return impl_->test_password_hash (sid, password_hash);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Get revision
 // @return Revision
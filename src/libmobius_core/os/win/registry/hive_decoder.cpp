@@ -163,11 +163,26 @@ std::vector<hive_decoder::offset_type>
 hive_decoder::decode_subkeys_list (offset_type offset)
 {
     std::vector<offset_type> offsets;
-    _retrieve_subkeys (offsets, offset);
+
+    for (const auto &entry : decode_subkeys_entries (offset))
+        offsets.push_back (entry.offset);
 
     return offsets;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief decode subkeys list, with name hints
+// @return vector of subkey entries
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<subkey_entry>
+hive_decoder::decode_subkeys_entries (offset_type offset)
+{
+    std::vector<subkey_entry> entries;
+    _retrieve_subkeys (entries, offset);
+
+    return entries;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief decode values list
 // @return vector of offsets
@@ -205,11 +220,11 @@ hive_decoder::decode_values_list (offset_type offset, std::uint32_t count)
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief retrieve subkeys from list, recursively
-// @param offsets offset vector
+// @param entries subkey entries vector
 // @param offset list offset
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-hive_decoder::_retrieve_subkeys (std::vector<offset_type> &offsets,
+hive_decoder::_retrieve_subkeys (std::vector<subkey_entry> &entries,
                                  offset_type offset)
 {
     // check offset
@@ -238,20 +253,23 @@ hive_decoder::_retrieve_subkeys (std::vector<offset_type> &offsets,
             std::uint32_t nk_offset = get_offset (decoder);
 
             if (nk_offset != INVALID_OFFSET)
-                offsets.push_back (nk_offset);
+                entries.push_back ({nk_offset});
         }
     }
 
     // fast leaf or hash leaf
     else if (signature == "lf" || signature == "lh")
     {
+        auto type = (signature == "lf") ? subkey_entry::hint_type::name
+                                        : subkey_entry::hint_type::hash;
+
         for (auto i = 0; i < count; i++)
         {
             std::uint32_t nk_offset = get_offset (decoder);
-            decoder.skip (4); // name or hash
+            std::uint32_t hint = decoder.get_uint32_le (); // name or hash
 
             if (nk_offset != INVALID_OFFSET)
-                offsets.push_back (nk_offset);
+                entries.push_back ({nk_offset, type, hint});
         }
     }
 
@@ -269,7 +287,7 @@ hive_decoder::_retrieve_subkeys (std::vector<offset_type> &offsets,
 
         // generate subkeys
         for (auto l_offset : ri_offsets)
-            _retrieve_subkeys (offsets, l_offset);
+            _retrieve_subkeys (entries, l_offset);
     }
 
     else
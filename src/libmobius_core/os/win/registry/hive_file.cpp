@@ -16,12 +16,19 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/decoder/data_decoder.hpp>
+#include <mobius/core/io/bytearray_io.hpp>
 #include <mobius/core/os/win/registry/hive_decoder.hpp>
 #include <mobius/core/os/win/registry/hive_file.hpp>
 #include <mobius/core/string_functions.hpp>
 
 namespace mobius::core::os::win::registry
 {
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Hive files up to this size are loaded into memory at once
+static constexpr std::uint64_t MEMORY_HIVE_MAX_SIZE = 512 * 1024 * 1024;
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief implementation class
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -312,7 +319,14 @@ class hive_file::impl
 hive_file::impl::impl (const mobius::core::io::reader &reader)
     : reader_ (reader)
 {
-    hive_decoder decoder (reader);
+    // load whole hive into memory, so cells are decoded from memory
+    if (reader_.is_seekable () && reader_.is_sizeable () &&
+        reader_.get_size () <= MEMORY_HIVE_MAX_SIZE)
+        reader_ = mobius::core::io::new_bytearray_reader (
+            reader_.read_at (0, reader_.get_size ())
+        );
+
+    hive_decoder decoder (reader_);
     auto data = decoder.decode_header ();
 
     // retrieve header metadata
@@ -351,8 +365,8 @@ hive_file::impl::eval_header_checksum () const
     mobius::core::decoder::data_decoder decoder (reader_);
 
     std::uint32_t checksum = 0;
-    for (auto i = 0; i < 127; i++)
-        checksum ^= decoder.get_uint32_le ();
+    for (auto value : decoder.get_uint32_le_vector (127))
+        checksum ^= value;
 
     return checksum;
 }
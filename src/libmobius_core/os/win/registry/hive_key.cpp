@@ -19,6 +19,8 @@
 #include <mobius/core/os/win/registry/hive_decoder.hpp>
 #include <mobius/core/os/win/registry/hive_key.hpp>
 #include <mobius/core/string_functions.hpp>
+#include <cctype>
+#include <unordered_map>
 
 namespace mobius::core::os::win::registry
 {
@@ -31,6 +33,9 @@ static constexpr std::uint16_t KEY_SYM_LINK = 0x0010;
 static constexpr std::uint32_t INVALID_OFFSET = 0xffffffff;
 static constexpr std::uint32_t HIVE_BASE_OFFSET = 4096;
 
+// Number of hint lookups on a key before its name index is built
+static constexpr std::uint32_t NAME_INDEX_THRESHOLD = 4;
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief get absolute offset
 // @param offset relative offset
@@ -47,6 +52,104 @@ decode_offset (mobius::core::decoder::data_decoder &decoder)
     return offset;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Name hints, as stored in lf and lh subkeys lists
+// @see
+// https://github.com/msuhanov/regf/blob/master/Windows%20registry%20file%20format%20specification.md#hash-leaf
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct name_hints
+{
+    // @brief Set if hints can be used (ASCII names only)
+    bool is_valid = true;
+
+    // @brief First 4 name chars, uppercased (lf)
+    std::uint32_t name = 0;
+
+    // @brief Name hash (lh)
+    std::uint32_t hash = 0;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Uppercase each byte of a lf name hint
+// @param hint Name hint
+// @return Uppercased name hint
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::uint32_t
+toupper_name_hint (std::uint32_t hint)
+{
+    std::uint32_t value = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        std::uint32_t c = (hint >> (i * 8)) & 0xff;
+
+        if (c >= 'a' && c <= 'z')
+            c -= 'a' - 'A';
+
+        value |= c << (i * 8);
+    }
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Evaluate name hints for a key name
+// @param name Key name (UTF-8)
+// @return Name hints
+//
+// Windows uppercases names with its own Unicode table before hashing, so
+// hints are only evaluated for ASCII names.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static name_hints
+get_name_hints (const std::string &name)
+{
+    name_hints hints;
+
+    for (std::string::size_type i = 0; i < name.size (); i++)
+    {
+        auto c = static_cast<std::uint8_t> (name[i]);
+
+        if (c > 0x7f)
+        {
+            hints.is_valid = false;
+            return hints;
+        }
+
+        c = std::toupper (c);
+        hints.hash = hints.hash * 37 + c;
+
+        if (i < 4)
+            hints.name |= std::uint32_t (c) << (i * 8);
+    }
+
+    return hints;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if subkey entry can match name
+// @param entry Subkey entry
+// @param hints Name hints
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static bool
+can_match (const subkey_entry &entry, const name_hints &hints)
+{
+    if (!hints.is_valid)
+        return true;
+
+    switch (entry.type)
+    {
+    case subkey_entry::hint_type::name:
+        return toupper_name_hint (entry.hint) == hints.name;
+
+    case subkey_entry::hint_type::hash:
+        return entry.hint == hints.hash;
+
+    default:
+        return true;
+    }
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief implementation class
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -309,6 +412,9 @@ class hive_key::impl
         return values_;
     }
 
+    // function prototypes
+    hive_key get_key_by_name (const std::string &) const;
+
   private:
     // @brief generic reader
     mobius::core::io::reader reader_;
@@ -367,24 +473,41 @@ class hive_key::impl
     // @brief offset to the values list
     mutable std::uint32_t values_offset_;
 
+    // @brief subkeys list entries
+    mutable std::vector<subkey_entry> entries_;
+
     // @brief subkeys
     mutable std::vector<hive_key> subkeys_;
 
+    // @brief subkeys index by lowercase name
+    mutable std::unordered_map<std::string, std::size_t> name_index_;
+
+    // @brief number of lookups by name hints
+    mutable std::uint32_t hint_lookups_ = 0;
+
     // @brief values
     mutable std::vector<hive_value> values_;
 
     // @brief metadata loaded flag
     mutable bool metadata_loaded_ = false;
 
+    // @brief subkeys list entries loaded flag
+    mutable bool entries_loaded_ = false;
+
     // @brief subkeys loaded flag
     mutable bool subkeys_loaded_ = false;
 
+    // @brief name index loaded flag
+    mutable bool name_index_loaded_ = false;
+
     // @brief values loaded flag
     mutable bool values_loaded_ = false;
 
     // helper functions
     void _load_metadata () const;
+    void _load_entries () const;
     void _load_subkeys () const;
+    void _load_name_index () const;
     void _load_values () const;
 };
 
@@ -476,33 +599,118 @@ hive_key::impl::_load_metadata () const
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief load subkeys on demand
+// @brief load subkeys list entries on demand
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-hive_key::impl::_load_subkeys () const
+hive_key::impl::_load_entries () const
 {
-    // check if subkeys are already loaded
-    if (subkeys_loaded_)
+    // check if entries are already loaded
+    if (entries_loaded_)
         return;
 
     _load_metadata ();
 
-    // set subkeys loaded
-    subkeys_loaded_ = true;
+    // set entries loaded
+    entries_loaded_ = true;
 
     // check if it can retrieve data
     if (offset_ == INVALID_OFFSET || subkeys_offset_ == INVALID_OFFSET ||
         subkeys_offset_ >= reader_.get_size ())
         return;
 
-    // create decoder
+    // decode subkeys list
     hive_decoder decoder (reader_);
-    auto offsets = decoder.decode_subkeys_list (subkeys_offset_);
+    entries_ = decoder.decode_subkeys_entries (subkeys_offset_);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief load subkeys on demand
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hive_key::impl::_load_subkeys () const
+{
+    // check if subkeys are already loaded
+    if (subkeys_loaded_)
+        return;
+
+    _load_entries ();
+
+    // set subkeys loaded
+    subkeys_loaded_ = true;
 
     // build subkeys_
-    subkeys_.reserve (offsets.size ());
-    for (auto offset : offsets)
-        subkeys_.push_back (hive_key (reader_, offset));
+    subkeys_.reserve (entries_.size ());
+    for (const auto &entry : entries_)
+        subkeys_.push_back (hive_key (reader_, entry.offset));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief load subkeys index by name on demand
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+hive_key::impl::_load_name_index () const
+{
+    // check if name index is already loaded
+    if (name_index_loaded_)
+        return;
+
+    _load_subkeys ();
+
+    // set name index loaded
+    name_index_loaded_ = true;
+
+    // build name_index_, keeping the first key with a given name
+    name_index_.reserve (subkeys_.size ());
+
+    for (std::size_t i = 0; i < subkeys_.size (); i++)
+        name_index_.emplace (
+            mobius::core::string::tolower (subkeys_[i].get_name ()), i
+        );
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get subkey by name
+// @param name subkey name
+// @return subkey or empty key, if not found
+//
+// While subkeys are not loaded, the name hints stored in lf and lh lists are
+// used to decode only the candidate subkeys. After subkeys are loaded, or
+// after a few lookups on the same key, an index by name is built.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+hive_key
+hive_key::impl::get_key_by_name (const std::string &name) const
+{
+    const std::string lname = mobius::core::string::tolower (name);
+
+    // lookup by index
+    if (subkeys_loaded_ || ++hint_lookups_ > NAME_INDEX_THRESHOLD)
+    {
+        _load_name_index ();
+
+        auto iter = name_index_.find (lname);
+
+        if (iter != name_index_.end ())
+            return subkeys_[iter->second];
+
+        return hive_key ();
+    }
+
+    // lookup by name hints
+    _load_entries ();
+    const auto hints = get_name_hints (name);
+
+    for (const auto &entry : entries_)
+    {
+        if (can_match (entry, hints))
+        {
+            hive_key sk (reader_, entry.offset);
+
+            if (mobius::core::string::tolower (sk.get_name ()) == lname)
+                return sk;
+        }
+    }
+
+    return hive_key ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -801,13 +1009,7 @@ hive_key::has_subkeys () const
 hive_key
 hive_key::get_key_by_name (const std::string &name) const
 {
-    const std::string lname = mobius::core::string::tolower (name);
-
-    for (const auto &sk : *this)
-        if (mobius::core::string::tolower (sk.get_name ()) == lname)
-            return sk;
-
-    return hive_key ();
+    return impl_->get_key_by_name (name);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -852,14 +1054,25 @@ hive_key::get_keys_by_mask (const std::string &a_mask) const
 
         for (auto key : subkeys)
         {
-            for (auto sk : key)
+            if (!mobius::core::string::has_wildcards (submask))
             {
-                const std::string name =
-                    mobius::core::string::tolower (sk.get_name ());
+                auto sk = key.get_key_by_name (submask);
 
-                if (mobius::core::string::fnmatch (submask, name))
+                if (sk)
                     tmp_keys.push_back (sk);
             }
+
+            else
+            {
+                for (auto sk : key)
+                {
+                    const std::string name =
+                        mobius::core::string::tolower (sk.get_name ());
+
+                    if (mobius::core::string::fnmatch (submask, name))
+                        tmp_keys.push_back (sk);
+                }
+            }
         }
 
         // overwrite the candidate vector
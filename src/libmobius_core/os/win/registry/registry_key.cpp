@@ -21,6 +21,23 @@
 
 namespace mobius::core::os::win::registry
 {
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief get subkey by name (default implementation: linear search)
+// @param name subkey name
+// @return subkey or empty key, if not found
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+registry_key
+registry_key_impl_base::get_key_by_name (const std::string &name) const
+{
+    const std::string lname = mobius::core::string::tolower (name);
+
+    for (auto iter = begin (); iter != end (); ++iter)
+        if (mobius::core::string::tolower (iter->get_name ()) == lname)
+            return *iter;
+
+    return registry_key ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief default constructor
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -46,13 +63,7 @@ registry_key::registry_key (std::shared_ptr<registry_key_impl_base> impl)
 registry_key
 registry_key::get_key_by_name (const std::string &name) const
 {
-    const std::string lname = mobius::core::string::tolower (name);
-
-    for (const auto &sk : *this)
-        if (mobius::core::string::tolower (sk.get_name ()) == lname)
-            return sk;
-
-    return registry_key ();
+    return impl_->get_key_by_name (name);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -139,14 +150,25 @@ registry_key::get_key_by_mask (const std::string &a_mask) const
 
         for (auto key : subkeys)
         {
-            for (auto sk : key)
+            if (!mobius::core::string::has_wildcards (submask))
             {
-                const std::string name =
-                    mobius::core::string::tolower (sk.get_name ());
+                auto sk = key.get_key_by_name (submask);
 
-                if (mobius::core::string::fnmatch (submask, name))
+                if (sk)
                     tmp_keys.push_back (sk);
             }
+
+            else
+            {
+                for (auto sk : key)
+                {
+                    const std::string name =
+                        mobius::core::string::tolower (sk.get_name ());
+
+                    if (mobius::core::string::fnmatch (submask, name))
+                        tmp_keys.push_back (sk);
+                }
+            }
         }
 
         // overwrite the candidate vector
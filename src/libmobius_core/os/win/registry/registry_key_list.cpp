@@ -36,6 +36,7 @@ registry_key_list::add (registry_key key)
 
     keys_.insert (std::upper_bound (keys_.begin (), keys_.end (), key, lambda),
                   key);
+    _reset_index ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -52,6 +53,7 @@ registry_key_list::remove (const std::string &name)
 
     keys_.erase (std::remove_if (keys_.begin (), keys_.end (), lambda),
                  keys_.end ());
+    _reset_index ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -62,17 +64,35 @@ registry_key_list::remove (const std::string &name)
 registry_key
 registry_key_list::get (const std::string &name) const
 {
-    const std::string lname = mobius::core::string::tolower (name);
-
-    auto lambda = [lname] (registry_key sk)
-    { return mobius::core::string::tolower (sk.get_name ()) == lname; };
+    _load_index ();
 
-    auto iter = std::find_if (keys_.begin (), keys_.end (), lambda);
+    auto iter = index_.find (mobius::core::string::tolower (name));
 
-    if (iter != keys_.end ())
-        return *iter;
+    if (iter != index_.end ())
+        return keys_[iter->second];
 
     return registry_key ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief load index by name on demand
+//
+// Keys keep their names while in the container (add relies on it to keep
+// keys sorted), so index is only rebuilt when keys are added or removed.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+registry_key_list::_load_index () const
+{
+    if (index_loaded_)
+        return;
+
+    index_.reserve (keys_.size ());
+
+    for (std::size_t i = 0; i < keys_.size (); i++)
+        index_.emplace (mobius::core::string::tolower (keys_[i].get_name ()),
+                        i);
+
+    index_loaded_ = true;
+}
+
 } // namespace mobius::core::os::win::registry
@@ -0,0 +1,711 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/exception.inc>
+#include <mobius/core/pod/data_view.hpp>
+#include <mobius/core/pod/map.hpp>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string_view>
+
+namespace mobius::core::pod
+{
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+// @brief Last serialization version supported
+static constexpr std::uint32_t VERSION = 2;
+
+// @brief Datetime epoch for v2 ticks (100ns intervals, as NT timestamps)
+static constexpr mobius::core::datetime::datetime EPOCH (1601, 1, 1, 0, 0, 0);
+
+// @brief Ticks per second
+static constexpr std::int64_t TICKS_PER_SECOND = 10000000;
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief data_view implementation class
+//
+// Holds the serialized buffer, its version and, for v2, the key dictionary.
+// Functions receive a buffer position and advance it past what was read.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class data_view::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit impl (const mobius::core::bytearray &);
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get serialization version
+    // @return Version
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint32_t
+    get_version () const
+    {
+        return version_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get root value position
+    // @return Position
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_root_pos () const
+    {
+        return root_pos_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Read value tag
+    // @param pos Position
+    // @return Tag
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint8_t
+    get_tag (std::uint64_t &pos) const
+    {
+        return _get_uint8 (pos);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Read length (string size or number of items)
+    // @param pos Position
+    // @return Length
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_length (std::uint64_t &pos) const
+    {
+        return version_ == 1 ? _get_uint_le (pos, 8) : _get_varint (pos);
+    }
+
+    std::string_view get_key (std::uint64_t &, std::uint8_t) const;
+    data get_data (std::uint64_t &) const;
+    void skip (std::uint64_t &) const;
+
+  private:
+    // @brief Serialized data
+    const mobius::core::bytearray buffer_;
+
+    // @brief Serialization version
+    std::uint32_t version_ = 0;
+
+    // @brief Key dictionary (v2)
+    std::vector<std::string_view> dict_;
+
+    // @brief Root value position
+    std::uint64_t root_pos_ = 0;
+
+    // Helper functions
+    void _check (std::uint64_t, std::uint64_t) const;
+    std::uint8_t _get_uint8 (std::uint64_t &) const;
+    std::uint64_t _get_uint_le (std::uint64_t &, int) const;
+    std::uint64_t _get_varint (std::uint64_t &) const;
+    std::string_view _get_string (std::uint64_t &, std::uint64_t) const;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param buffer Serialized data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data_view::impl::impl (const mobius::core::bytearray &buffer)
+    : buffer_ (buffer)
+{
+    std::uint64_t pos = 0;
+    version_ = static_cast<std::uint32_t> (_get_uint_le (pos, 4));
+
+    if (version_ < 1 || version_ > VERSION)
+        throw std::out_of_range (MOBIUS_EXCEPTION_MSG ("version out of range"));
+
+    if (version_ == 2)
+    {
+        auto size = _get_uint_le (pos, 8);
+        _check (pos, size);
+
+        auto count = _get_varint (pos);
+
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            auto siz = _get_varint (pos);
+            dict_.push_back (_get_string (pos, siz));
+        }
+    }
+
+    root_pos_ = pos;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read map key
+// @param pos Position
+// @param tag Map tag ('M' or 'K')
+// @return Key, pointing into buffer
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string_view
+data_view::impl::get_key (std::uint64_t &pos, std::uint8_t tag) const
+{
+    if (tag == 'K')
+    {
+        auto idx = _get_varint (pos);
+
+        if (idx >= dict_.size ())
+            throw std::out_of_range (
+                MOBIUS_EXCEPTION_MSG ("key index out of range")
+            );
+
+        return dict_[idx];
+    }
+
+    auto siz = version_ == 1 ? _get_uint_le (pos, 4) : _get_varint (pos);
+    return _get_string (pos, siz);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Skip value
+// @param pos Position
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+data_view::impl::skip (std::uint64_t &pos) const
+{
+    auto tag = get_tag (pos);
+
+    switch (tag)
+    {
+    case 'N':
+    case 't':
+    case 'f':
+    case 'd':
+        break;
+
+    case 'I':
+        if (version_ == 1)
+            pos += 8;
+        else
+            _get_varint (pos);
+        break;
+
+    case 'F':
+    case 'D':
+        if (version_ == 1)
+            pos += _get_uint_le (pos, 2);
+        else
+            pos += 8;
+        break;
+
+    case 'S':
+    case 'B':
+        pos += get_length (pos);
+        break;
+
+    case 'L':
+    {
+        auto count = get_length (pos);
+
+        for (std::uint64_t i = 0; i < count; i++)
+            skip (pos);
+    }
+    break;
+
+    case 'M':
+    case 'K':
+    {
+        auto count = get_length (pos);
+
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            get_key (pos, tag);
+            skip (pos);
+        }
+    }
+    break;
+
+    default:
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("unknown data type")
+        );
+    }
+
+    _check (pos, 0);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Build data object from value
+// @param pos Position
+// @return Data object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data
+data_view::impl::get_data (std::uint64_t &pos) const
+{
+    data d;
+    auto tag = get_tag (pos);
+
+    switch (tag)
+    {
+    case 'N':
+        break;
+
+    case 't':
+        d = true;
+        break;
+
+    case 'f':
+        d = false;
+        break;
+
+    case 'I':
+        if (version_ == 1)
+            d = static_cast<std::int64_t> (_get_uint_le (pos, 8));
+
+        else
+        {
+            auto value = _get_varint (pos);
+            d = static_cast<std::int64_t> ((value >> 1) ^ (0 - (value & 1)));
+        }
+        break;
+
+    case 'F':
+        if (version_ == 1)
+        {
+            auto siz = _get_uint_le (pos, 2);
+            auto text = std::string (_get_string (pos, siz));
+            d = strtold (text.c_str (), nullptr);
+        }
+
+        else
+        {
+            auto bits = _get_uint_le (pos, 8);
+            double value;
+            std::memcpy (&value, &bits, sizeof (value));
+            d = value;
+        }
+        break;
+
+    case 'D':
+        if (version_ == 1)
+        {
+            auto siz = _get_uint_le (pos, 2);
+            auto text = std::string (_get_string (pos, siz));
+
+            if (text.empty ())
+                d = mobius::core::datetime::datetime ();
+            else
+                d = mobius::core::datetime::new_datetime_from_iso_string (text);
+        }
+
+        else
+        {
+            auto ticks = static_cast<std::int64_t> (_get_uint_le (pos, 8));
+            auto seconds = ticks / TICKS_PER_SECOND;
+
+            if (ticks % TICKS_PER_SECOND < 0)
+                seconds--;
+
+            d = EPOCH + mobius::core::datetime::timedelta (seconds);
+        }
+        break;
+
+    case 'd':
+        d = mobius::core::datetime::datetime ();
+        break;
+
+    case 'S':
+    {
+        auto siz = get_length (pos);
+        d = std::string (_get_string (pos, siz));
+    }
+    break;
+
+    case 'B':
+    {
+        auto siz = get_length (pos);
+        auto s = _get_string (pos, siz);
+        d = mobius::core::bytearray (
+            reinterpret_cast<const std::uint8_t *> (s.data ()), s.size ()
+        );
+    }
+    break;
+
+    case 'L':
+    {
+        auto count = get_length (pos);
+        std::vector<data> v;
+
+        for (std::uint64_t i = 0; i < count; i++)
+            v.push_back (get_data (pos));
+
+        d = v;
+    }
+    break;
+
+    case 'M':
+    case 'K':
+    {
+        auto count = get_length (pos);
+        mobius::core::pod::map map;
+
+        for (std::uint64_t i = 0; i < count; i++)
+        {
+            auto key = std::string (get_key (pos, tag));
+            map.set (key, get_data (pos));
+        }
+
+        d = map;
+    }
+    break;
+
+    default:
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("unknown data type")
+        );
+    }
+
+    return d;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if buffer has enough data
+// @param pos Position
+// @param size Number of bytes to be read
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+data_view::impl::_check (std::uint64_t pos, std::uint64_t size) const
+{
+    if (pos > buffer_.size () || size > buffer_.size () - pos)
+        throw std::out_of_range (MOBIUS_EXCEPTION_MSG ("truncated data"));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read byte
+// @param pos Position
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint8_t
+data_view::impl::_get_uint8 (std::uint64_t &pos) const
+{
+    _check (pos, 1);
+    return buffer_.data ()[pos++];
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read little endian unsigned integer
+// @param pos Position
+// @param size Size in bytes (1-8)
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+data_view::impl::_get_uint_le (std::uint64_t &pos, int size) const
+{
+    _check (pos, size);
+
+    const std::uint8_t *p = buffer_.data () + pos;
+    std::uint64_t value = 0;
+
+    for (int i = size - 1; i >= 0; i--)
+        value = (value << 8) | p[i];
+
+    pos += size;
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read unsigned varint (LEB128)
+// @param pos Position
+// @return Value
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+data_view::impl::_get_varint (std::uint64_t &pos) const
+{
+    std::uint64_t value = 0;
+    int shift = 0;
+    std::uint8_t c;
+
+    do
+    {
+        if (shift > 63)
+            throw std::out_of_range (MOBIUS_EXCEPTION_MSG ("invalid varint"));
+
+        c = _get_uint8 (pos);
+        value |= static_cast<std::uint64_t> (c & 0x7f) << shift;
+        shift += 7;
+    }
+    while (c & 0x80);
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes, without copying them
+// @param pos Position
+// @param size Size in bytes
+// @return View into buffer
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string_view
+data_view::impl::_get_string (std::uint64_t &pos, std::uint64_t size) const
+{
+    _check (pos, size);
+
+    std::string_view s (
+        reinterpret_cast<const char *> (buffer_.data ()) + pos, size
+    );
+
+    pos += size;
+    return s;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param buffer Serialized data, as returned by serialize function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data_view::data_view (const mobius::core::bytearray &buffer)
+    : impl_ (std::make_shared<const impl> (buffer))
+{
+    pos_ = impl_->get_root_pos ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor for child views
+// @param impl Implementation pointer
+// @param pos Value position
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data_view::data_view (const std::shared_ptr<const impl> &impl, std::uint64_t pos)
+    : impl_ (impl),
+      pos_ (pos)
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get serialization version
+// @return Version
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint32_t
+data_view::get_version () const
+{
+    if (!impl_)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("invalid data view"));
+
+    return impl_->get_version ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get value type
+// @return Data type
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data::type
+data_view::get_type () const
+{
+    if (!impl_)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("invalid data view"));
+
+    auto pos = pos_;
+
+    switch (impl_->get_tag (pos))
+    {
+    case 'N':
+        return data::type::null;
+
+    case 't':
+    case 'f':
+        return data::type::boolean;
+
+    case 'I':
+        return data::type::integer;
+
+    case 'F':
+        return data::type::floatn;
+
+    case 'D':
+    case 'd':
+        return data::type::datetime;
+
+    case 'S':
+        return data::type::string;
+
+    case 'B':
+        return data::type::bytearray;
+
+    case 'L':
+        return data::type::list;
+
+    case 'M':
+    case 'K':
+        return data::type::map;
+
+    default:
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("unknown data type")
+        );
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get value size
+// @return Number of items for lists and maps, size in bytes for strings and
+// bytearrays, 0 for other types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+data_view::get_size () const
+{
+    if (!impl_)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("invalid data view"));
+
+    auto pos = pos_;
+
+    switch (impl_->get_tag (pos))
+    {
+    case 'S':
+    case 'B':
+    case 'L':
+    case 'M':
+    case 'K':
+        return impl_->get_length (pos);
+
+    default:
+        return 0;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if map has a given key
+// @param key Key
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+data_view::has_key (const std::string &key) const
+{
+    return bool (get_view (key));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get map keys
+// @return Keys, in serialization order
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<std::string>
+data_view::get_keys () const
+{
+    if (get_type () != data::type::map)
+        throw std::invalid_argument (MOBIUS_EXCEPTION_MSG ("data is not a map"));
+
+    auto pos = pos_;
+    auto tag = impl_->get_tag (pos);
+    auto count = impl_->get_length (pos);
+    std::vector<std::string> keys;
+
+    for (std::uint64_t i = 0; i < count; i++)
+    {
+        keys.emplace_back (impl_->get_key (pos, tag));
+        impl_->skip (pos);
+    }
+
+    return keys;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get view of map value
+// @param key Key
+// @return View, or invalid view if key is not found
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data_view
+data_view::get_view (const std::string &key) const
+{
+    if (get_type () != data::type::map)
+        throw std::invalid_argument (MOBIUS_EXCEPTION_MSG ("data is not a map"));
+
+    auto pos = pos_;
+    auto tag = impl_->get_tag (pos);
+    auto count = impl_->get_length (pos);
+
+    for (std::uint64_t i = 0; i < count; i++)
+    {
+        if (impl_->get_key (pos, tag) == key)
+            return data_view (impl_, pos);
+
+        impl_->skip (pos);
+    }
+
+    return {};
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get view of list item
+// @param idx Item index
+// @return View
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data_view
+data_view::get_view (std::uint64_t idx) const
+{
+    if (get_type () != data::type::list)
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("data is not a list")
+        );
+
+    auto pos = pos_;
+    impl_->get_tag (pos);
+    auto count = impl_->get_length (pos);
+
+    if (idx >= count)
+        throw std::out_of_range (MOBIUS_EXCEPTION_MSG ("index out of range"));
+
+    for (std::uint64_t i = 0; i < idx; i++)
+        impl_->skip (pos);
+
+    return data_view (impl_, pos);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get map value
+// @param key Key
+// @param value Default value
+// @return Value, or default value if key is not found
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data
+data_view::get (const std::string &key, const data &value) const
+{
+    auto view = get_view (key);
+
+    if (view)
+        return view.get_data ();
+
+    return value;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Build data object from view
+// @return Data object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+data
+data_view::get_data () const
+{
+    if (!impl_)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("invalid data view"));
+
+    auto pos = pos_;
+    return impl_->get_data (pos);
+}
+
+} // namespace mobius::core::pod
@@ -20,7 +20,10 @@
 #include <mobius/core/pod/data.hpp>
 #include <mobius/core/pod/map.hpp>
 #include <cstdint>
+#include <cstring>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace mobius::core::pod
@@ -31,11 +34,273 @@ namespace
 // Constants
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 
-// @brief Serialization version
-static constexpr std::uint32_t VERSION = 1;
+// @brief Datetime epoch for v2 ticks (100ns intervals, as NT timestamps)
+static constexpr mobius::core::datetime::datetime EPOCH (1601, 1, 1, 0, 0, 0);
+
+// @brief Ticks per second
+static constexpr std::int64_t TICKS_PER_SECOND = 10000000;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Serialization v2 encoder
+//
+// v2 format:
+//   uint32_le version (2)
+//   uint64_le size (number of bytes following this field)
+//   varint dict_size, followed by dict_size keys (varint size + bytes)
+//   value
+//
+// Values:
+//   'N', 't', 'f'     null, true, false
+//   'I' zvarint       integer (zigzag varint)
+//   'F' double_le     float (IEEE 754 binary64)
+//   'D' int64_le      datetime (ticks since 1601-01-01)
+//   'd'               null datetime
+//   'S' varint bytes  string
+//   'B' varint bytes  bytearray
+//   'L' varint values list
+//   'M' varint (varint key_size, key, value)...  map, inline keys
+//   'K' varint (varint key_idx, value)...        map, keys from dict
+//
+// Key dictionary is written only when some map key repeats in data.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class encoder_v2
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructor
+    // @param out Output buffer
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit encoder_v2 (std::string &out)
+        : out_ (out)
+    {
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Encode data object, with version and key dictionary
+    // @param d Data object
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    encode (const data &d)
+    {
+        out_.append ("\x02\x00\x00\x00", 4); // version 2 (uint32_le)
+
+        auto size_pos = out_.size ();
+        out_.append (8, '\0'); // size (uint64_le), set below
+
+        // build key dictionary
+        std::vector<std::string> keys;
+        bool has_repeated_keys = false;
+        _collect_keys (d, keys, has_repeated_keys);
+
+        if (!has_repeated_keys)
+        {
+            keys.clear ();
+            dict_.clear ();
+        }
+
+        _encode_varint (keys.size ());
+
+        for (const auto &key : keys)
+            _encode_string (key);
+
+        // encode value
+        _encode_data (d);
+
+        // set size
+        std::uint64_t size = out_.size () - size_pos - 8;
+
+        for (int i = 0; i < 8; i++)
+            out_[size_pos + i] = static_cast<char> ((size >> (i * 8)) & 0xff);
+    }
+
+  private:
+    // @brief Output buffer
+    std::string &out_;
+
+    // @brief Key dictionary (key -> index)
+    std::unordered_map<std::string, std::uint64_t> dict_;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Collect map keys, in order of first occurrence
+    // @param d Data object
+    // @param keys Keys vector
+    // @param has_repeated_keys Set to true if any key occurs more than once
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    _collect_keys (
+        const data &d,
+        std::vector<std::string> &keys,
+        bool &has_repeated_keys
+    )
+    {
+        if (d.get_type () == data::type::list)
+        {
+            for (const auto &i : std::vector<data> (d))
+                _collect_keys (i, keys, has_repeated_keys);
+        }
+
+        else if (d.get_type () == data::type::map)
+        {
+            mobius::core::pod::map map (d);
+
+            for (const auto &p : map)
+            {
+                auto [iter, inserted] = dict_.try_emplace (p.first, keys.size ());
+
+                if (inserted)
+                    keys.push_back (p.first);
+                else
+                    has_repeated_keys = true;
+
+                _collect_keys (p.second, keys, has_repeated_keys);
+            }
+        }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Encode unsigned varint (LEB128)
+    // @param value Value
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    _encode_varint (std::uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out_.push_back (static_cast<char> ((value & 0x7f) | 0x80));
+            value >>= 7;
+        }
+
+        out_.push_back (static_cast<char> (value));
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Encode 64-bit value, little endian
+    // @param value Value
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    _encode_uint64_le (std::uint64_t value)
+    {
+        for (int i = 0; i < 8; i++)
+            out_.push_back (static_cast<char> (value >> (i * 8)));
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Encode size prefixed string
+    // @param value String
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    _encode_string (const std::string &value)
+    {
+        _encode_varint (value.size ());
+        out_.append (value);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Encode data item
+    // @param d Data object
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    _encode_data (const data &d)
+    {
+        switch (d.get_type ())
+        {
+        case data::type::null:
+            out_.push_back ('N');
+            break;
+
+        case data::type::boolean:
+            out_.push_back (bool (d) ? 't' : 'f');
+            break;
+
+        case data::type::integer:
+        {
+            auto value = static_cast<std::uint64_t> (std::int64_t (d));
+            out_.push_back ('I');
+            _encode_varint ((value << 1) ^ (0 - (value >> 63)));
+        }
+        break;
+
+        case data::type::floatn:
+        {
+            double value = static_cast<double> (static_cast<long double> (d));
+            std::uint64_t bits;
+            std::memcpy (&bits, &value, sizeof (bits));
+
+            out_.push_back ('F');
+            _encode_uint64_le (bits);
+        }
+        break;
+
+        case data::type::datetime:
+        {
+            auto dt = mobius::core::datetime::datetime (d);
+
+            if (dt)
+            {
+                auto ticks = (dt - EPOCH).to_seconds () * TICKS_PER_SECOND;
+                out_.push_back ('D');
+                _encode_uint64_le (static_cast<std::uint64_t> (ticks));
+            }
+            else
+                out_.push_back ('d');
+        }
+        break;
+
+        case data::type::string:
+            out_.push_back ('S');
+            _encode_string (std::string (d));
+            break;
+
+        case data::type::bytearray:
+        {
+            auto b = mobius::core::bytearray (d);
+            out_.push_back ('B');
+            _encode_varint (b.size ());
+            out_.append (reinterpret_cast<const char *> (b.data ()), b.size ());
+        }
+        break;
+
+        case data::type::list:
+        {
+            auto v = std::vector<mobius::core::pod::data> (d);
+
+            out_.push_back ('L');
+            _encode_varint (v.size ());
+
+            for (const auto &i : v)
+                _encode_data (i);
+        }
+        break;
+
+        case data::type::map:
+        {
+            mobius::core::pod::map map (d);
+
+            out_.push_back (dict_.empty () ? 'M' : 'K');
+            _encode_varint (map.get_size ());
+
+            for (const auto &p : map)
+            {
+                if (dict_.empty ())
+                    _encode_string (p.first);
+                else
+                    _encode_varint (dict_.at (p.first));
+
+                _encode_data (p.second);
+            }
+        }
+        break;
+
+        default:
+            throw std::invalid_argument (
+                MOBIUS_EXCEPTION_MSG ("unknown data type")
+            );
+        }
+    }
+};
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Serialize data item
+// @brief Serialize data item (v1)
 // @param encoder Encoder object
 // @param d Data object
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -131,13 +396,37 @@ _serialize_data (mobius::core::encoder::data_encoder &encoder, const data &data)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Serialize data object
 // @param data Data object
+// @param version Serialization version
 // @return Encoded data
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-static void
-_serialize (mobius::core::encoder::data_encoder &encoder, const data &data)
+static mobius::core::bytearray
+_serialize (const data &data, std::uint32_t version)
 {
-    encoder.encode_uint32_le (VERSION);
-    _serialize_data (encoder, data);
+    if (version == 1)
+    {
+        mobius::core::bytearray out;
+        mobius::core::encoder::data_encoder encoder (out);
+
+        encoder.encode_uint32_le (1);
+        _serialize_data (encoder, data);
+
+        return out;
+    }
+
+    else if (version == 2)
+    {
+        std::string out;
+        encoder_v2 encoder (out);
+        encoder.encode (data);
+
+        return mobius::core::bytearray (
+            reinterpret_cast<const std::uint8_t *> (out.data ()), out.size ()
+        );
+    }
+
+    throw std::invalid_argument (
+        MOBIUS_EXCEPTION_MSG ("unsupported serialization version")
+    );
 }
 
 } // namespace
@@ -145,30 +434,31 @@ _serialize (mobius::core::encoder::data_encoder &encoder, const data &data)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Serialize data object
 // @param data Data object
+// @param version Serialization version (1 or 2)
 // @return Encoded data
+//
+// Version 1 is the default, as it is the only one read by previous
+// releases. Version 2 is more compact and can be read in place by
+// data_view, but only by 2.28 and later.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 mobius::core::bytearray
-serialize (const data &data)
+serialize (const data &data, std::uint32_t version)
 {
-    mobius::core::bytearray out;
-    mobius::core::encoder::data_encoder encoder (out);
-
-    encoder.encode_uint32_le (VERSION);
-    _serialize_data (encoder, data);
-
-    return out;
+    return _serialize (data, version);
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Serialize data object
+// @param writer Writer object
 // @param data Data object
-// @return Encoded data
+// @param version Serialization version (1 or 2)
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-serialize (mobius::core::io::writer writer, const data &data)
+serialize (
+    mobius::core::io::writer writer, const data &data, std::uint32_t version
+)
 {
-    mobius::core::encoder::data_encoder encoder (writer);
-    _serialize (encoder, data);
+    writer.write (_serialize (data, version));
 }
 
 } // namespace mobius::core::pod
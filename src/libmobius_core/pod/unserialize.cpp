@@ -18,7 +18,9 @@
 #include <cstdint>
 #include <mobius/core/bytearray.hpp>
 #include <mobius/core/decoder/data_decoder.hpp>
+#include <mobius/core/encoder/data_encoder.hpp>
 #include <mobius/core/pod/data.hpp>
+#include <mobius/core/pod/data_view.hpp>
 #include <mobius/core/pod/map.hpp>
 #include <stdexcept>
 #include <vector>
@@ -31,8 +33,8 @@ namespace
 // Constants
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 
-// @brief Serialization version
-static constexpr std::uint32_t VERSION = 1;
+// @brief Last serialization version supported
+static constexpr std::uint32_t VERSION = 2;
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Unserialize data item
@@ -138,6 +140,9 @@ _unserialize_data (mobius::core::decoder::data_decoder &decoder)
 // @brief Unserialize data object
 // @param decoder Decoder object
 // @return Data object
+//
+// Version 1 data is decoded item by item. Version 2 data is read as a
+// whole, using its encoded size, and decoded from memory, by data_view.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 data
 _unserialize (mobius::core::decoder::data_decoder &decoder)
@@ -149,7 +154,18 @@ _unserialize (mobius::core::decoder::data_decoder &decoder)
         throw std::out_of_range (MOBIUS_EXCEPTION_MSG ("version out of range"));
 
     // decode data
-    return _unserialize_data (decoder);
+    if (version == 1)
+        return _unserialize_data (decoder);
+
+    auto size = decoder.get_uint64_le ();
+
+    mobius::core::bytearray b;
+    mobius::core::encoder::data_encoder encoder (b);
+    encoder.encode_uint32_le (2);
+    encoder.encode_uint64_le (size);
+    encoder.encode_bytearray (decoder.get_bytearray_by_size (size));
+
+    return data_view (b).get_data ();
 }
 
 } // namespace
@@ -162,8 +178,7 @@ _unserialize (mobius::core::decoder::data_decoder &decoder)
 data
 unserialize (const mobius::core::bytearray &b)
 {
-    mobius::core::decoder::data_decoder decoder (b);
-    return _unserialize (decoder);
+    return data_view (b).get_data ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
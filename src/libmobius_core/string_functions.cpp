@@ -762,6 +762,17 @@ case_insensitive_fnmatch (const std::string &pattern, const std::string &str)
     return ::fnmatch (i_pattern.c_str (), i_str.c_str (), FNM_NOESCAPE) == 0;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if a fnmatch pattern has wildcard characters
+// @param pattern fnmatch pattern
+// @return true if pattern has wildcards, false if it matches one string only
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+has_wildcards (const std::string &pattern)
+{
+    return pattern.find_first_of ("*?[") != std::string::npos;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Check if two strings are equal, case insensitive
 // @param a First string
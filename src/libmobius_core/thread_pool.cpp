@@ -0,0 +1,263 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/thread_pool.hpp>
+#include <mobius/core/thread_guard.hpp>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mobius::core
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Implementation class for thread_pool
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class thread_pool::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors and destructor
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit impl (unsigned int);
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+    ~impl ();
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of worker threads
+    // @return Number of threads
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    unsigned int
+    get_size () const
+    {
+        return threads_.size ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void submit (task_type);
+    void wait ();
+
+  private:
+    // @brief Worker threads
+    std::vector<std::thread> threads_;
+
+    // @brief Pending tasks
+    std::deque<task_type> tasks_;
+
+    // @brief Number of tasks being run
+    std::size_t running_ = 0;
+
+    // @brief Stop flag
+    bool stop_ = false;
+
+    // @brief First exception thrown by a task, if any
+    std::exception_ptr exception_;
+
+    // @brief Queue mutex
+    std::mutex mutex_;
+
+    // @brief Signaled when a new task is queued
+    std::condition_variable task_cv_;
+
+    // @brief Signaled when a task finishes
+    std::condition_variable done_cv_;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Helper functions
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void _run ();
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param size Number of worker threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+thread_pool::impl::impl (unsigned int size)
+{
+    threads_.reserve (size);
+
+    for (unsigned int i = 0; i < size; i++)
+        threads_.emplace_back (&impl::_run, this);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Destructor
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+thread_pool::impl::~impl ()
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        stop_ = true;
+        tasks_.clear ();
+    }
+
+    task_cv_.notify_all ();
+
+    auto thread_id = std::this_thread::get_id ();
+
+    for (auto &t : threads_)
+    {
+        if (t.get_id () == thread_id)
+            t.detach ();
+
+        else if (t.joinable ())
+            t.join ();
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Submit task
+// @param task Task function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+thread_pool::impl::submit (task_type task)
+{
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        tasks_.push_back (std::move (task));
+    }
+
+    task_cv_.notify_one ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wait until all submitted tasks are done
+//
+// If any task has thrown an exception, the first one is rethrown here.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+thread_pool::impl::wait ()
+{
+    std::unique_lock<std::mutex> lock (mutex_);
+    done_cv_.wait (lock, [this] { return tasks_.empty () && running_ == 0; });
+
+    if (exception_)
+    {
+        auto e = exception_;
+        exception_ = nullptr;
+        std::rethrow_exception (e);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Worker thread loop
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+thread_pool::impl::_run ()
+{
+    mobius::core::thread_guard guard;
+
+    while (true)
+    {
+        task_type task;
+
+        {
+            std::unique_lock<std::mutex> lock (mutex_);
+            task_cv_.wait (lock, [this] { return stop_ || !tasks_.empty (); });
+
+            if (stop_)
+                return;
+
+            task = std::move (tasks_.front ());
+            tasks_.pop_front ();
+            running_++;
+        }
+
+        std::exception_ptr e;
+
+        try
+        {
+            task ();
+        }
+        catch (...)
+        {
+            e = std::current_exception ();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock (mutex_);
+            running_--;
+
+            if (e && !exception_)
+                exception_ = e;
+        }
+
+        done_cv_.notify_all ();
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param size Number of worker threads (0 = one per hardware thread)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+thread_pool::thread_pool (unsigned int size)
+    : impl_ (std::make_shared<impl> (size ? size : get_hardware_threads ()))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of worker threads
+// @return Number of threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+unsigned int
+thread_pool::get_size () const
+{
+    return impl_->get_size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Submit task to be run by a worker thread
+// @param task Task function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+thread_pool::submit (task_type task)
+{
+    impl_->submit (std::move (task));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Wait until all submitted tasks are done
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+thread_pool::wait ()
+{
+    impl_->wait ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of hardware threads
+// @return Number of concurrent threads supported (at least 1)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+unsigned int
+get_hardware_threads ()
+{
+    unsigned int n = std::thread::hardware_concurrency ();
+    return n ? n : 1;
+}
+
+} // namespace mobius::core
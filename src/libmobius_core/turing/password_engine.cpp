@@ -0,0 +1,789 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/turing/password_engine.hpp>
+#include <mobius/core/charset.hpp>
+#include <mobius/core/crypt/hash.hpp>
+#include <mobius/core/exception.inc>
+#include <mobius/core/io/line_reader.hpp>
+#include <mobius/core/os/win/hash_lm.hpp>
+#include <mobius/core/os/win/hash_msdcc1.hpp>
+#include <mobius/core/os/win/hash_msdcc2.hpp>
+#include <mobius/core/thread_pool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace mobius::core::turing
+{
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Constants
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint32_t DEFAULT_BATCH_SIZE = 1024;
+constexpr std::uint32_t DPAPI_MASTER_KEY_SHA1 = 0x00000004;
+constexpr std::size_t LM_MAX_PASSWORD_LENGTH = 14;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Target (password hash or DPAPI master key)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct target
+{
+    std::string id;
+    std::string type;
+    mobius::core::bytearray value;
+    std::string username;
+    std::uint32_t iterations = 0;
+    mobius::core::os::win::dpapi::master_key mk;
+    std::string sid;
+    std::atomic<bool> found = false;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Salted hash group (targets sharing type, username and iterations)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct salted_group
+{
+    std::string type;
+    std::string username;
+    std::uint32_t iterations = 0;
+    std::vector<target *> targets;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test plan, built from pending targets before each round
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct plan
+{
+    std::unordered_multimap<std::string, target *> nt;
+    std::unordered_multimap<std::string, target *> lm;
+    std::unordered_multimap<std::string, target *> sha1;
+    std::vector<salted_group> salted;
+    std::vector<target *> master_keys;
+    bool need_nt = false;
+    bool need_sha1 = false;
+
+    bool
+    empty () const
+    {
+        return nt.empty () && lm.empty () && sha1.empty () &&
+               salted.empty () && master_keys.empty ();
+    }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Hit found by a worker
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct worker_hit
+{
+    target *t;
+    std::string password;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert digest to lookup key
+// @param digest Digest
+// @return Lookup key
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+_to_key (const mobius::core::bytearray &digest)
+{
+    return std::string (reinterpret_cast<const char *> (digest.data ()),
+                        digest.size ());
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Generate digest
+// @param hash_type Hash type
+// @param data Data
+// @return Digest
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::bytearray
+_digest (const std::string &hash_type, const mobius::core::bytearray &data)
+{
+    mobius::core::crypt::hash h (hash_type);
+    h.update (data);
+    return h.get_digest ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check digest against lookup table
+// @param table Lookup table
+// @param digest Digest
+// @param password Password
+// @param hits Hits vector
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+_check (const std::unordered_multimap<std::string, target *> &table,
+        const mobius::core::bytearray &digest, const std::string &password,
+        std::vector<worker_hit> &hits)
+{
+    auto range = table.equal_range (_to_key (digest));
+
+    for (auto iter = range.first; iter != range.second; ++iter)
+    {
+        if (!iter->second->found.exchange (true))
+            hits.push_back ({iter->second, password});
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test batch of candidate passwords
+// @param p Test plan
+// @param first First candidate
+// @param last Past-the-end candidate
+// @param hits Hits vector
+//
+// This function runs on worker threads. It only reads the plan, and
+// targets are marked as found atomically, so each hit is reported once.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+_test_batch (const plan &p, std::vector<std::string>::const_iterator first,
+             std::vector<std::string>::const_iterator last,
+             std::vector<worker_hit> &hits)
+{
+    for (auto iter = first; iter != last; ++iter)
+    {
+        const std::string &password = *iter;
+
+        // common hashes, computed once per candidate
+        mobius::core::bytearray nt;
+        mobius::core::bytearray sha1;
+
+        if (p.need_nt || p.need_sha1)
+        {
+            auto utf16 =
+                mobius::core::conv_charset (password, "UTF-8", "UTF-16LE");
+
+            if (p.need_nt)
+                nt = _digest ("md4", utf16);
+
+            if (p.need_sha1)
+                sha1 = _digest ("sha1", utf16);
+        }
+
+        // unsalted hashes
+        if (!p.nt.empty ())
+            _check (p.nt, nt, password, hits);
+
+        if (!p.sha1.empty ())
+            _check (p.sha1, sha1, password, hits);
+
+        if (!p.lm.empty () && password.size () <= LM_MAX_PASSWORD_LENGTH)
+            _check (p.lm, mobius::core::os::win::hash_lm (password), password,
+                    hits);
+
+        // salted hashes
+        for (const auto &g : p.salted)
+        {
+            mobius::core::bytearray value;
+
+            if (g.type == "msdcc1")
+                value = mobius::core::os::win::hash_msdcc1 (password,
+                                                            g.username);
+
+            else
+                value = mobius::core::os::win::hash_msdcc2 (
+                    password, g.username, g.iterations);
+
+            for (auto t : g.targets)
+            {
+                if (!t->found && t->value == value && !t->found.exchange (true))
+                    hits.push_back ({t, password});
+            }
+        }
+
+        // DPAPI master keys
+        for (auto t : p.master_keys)
+        {
+            const auto &h =
+                (t->mk.get_flags () & DPAPI_MASTER_KEY_SHA1) ? sha1 : nt;
+
+            if (!t->found && t->mk.test_password_hash (t->sid, h) &&
+                !t->found.exchange (true))
+                hits.push_back ({t, password});
+        }
+    }
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Password engine implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class password_engine::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    explicit impl (unsigned int);
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set hit callback
+    // @param f Callback function
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_hit_callback (const hit_callback_type &f)
+    {
+        hit_callback_ = f;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set batch size
+    // @param size Number of candidates per batch
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_batch_size (std::uint32_t size)
+    {
+        batch_size_ = size ? size : DEFAULT_BATCH_SIZE;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of worker threads
+    // @return Number of threads
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    unsigned int
+    get_threads () const
+    {
+        return pool_.get_size ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of targets
+    // @return Number of targets
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_target_count () const
+    {
+        return targets_.size ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of candidates tested
+    // @return Number of candidates
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_word_count () const
+    {
+        return word_count_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get average number of candidates tested per second
+    // @return Words per second
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    double
+    get_words_per_second () const
+    {
+        auto seconds = std::chrono::duration<double> (elapsed_).count ();
+        return seconds > 0 ? double (word_count_) / seconds : 0.0;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void add_hash (const std::string &, const std::string &,
+                   const mobius::core::bytearray &, const std::string &,
+                   std::uint32_t);
+    void add_master_key (const std::string &,
+                         const mobius::core::os::win::dpapi::master_key &,
+                         const std::string &);
+    std::uint64_t test (const std::vector<std::string> &);
+    std::uint64_t test (const mobius::core::io::reader &, const std::string &);
+    double benchmark (std::uint64_t);
+    std::uint64_t get_pending_count () const;
+
+  private:
+    // @brief Thread pool
+    mobius::core::thread_pool pool_;
+
+    // @brief Targets
+    std::vector<std::unique_ptr<target>> targets_;
+
+    // @brief Hit callback
+    hit_callback_type hit_callback_;
+
+    // @brief Number of candidates per batch
+    std::uint32_t batch_size_ = DEFAULT_BATCH_SIZE;
+
+    // @brief Number of candidates tested
+    std::uint64_t word_count_ = 0;
+
+    // @brief Time spent testing candidates
+    std::chrono::steady_clock::duration elapsed_ {};
+
+    // Helper functions
+    plan _build_plan () const;
+    std::uint64_t _run_round (const std::vector<std::string> &);
+    std::uint64_t _run (const std::vector<std::string> &);
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param threads Number of worker threads (0 = one per hardware thread)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+password_engine::impl::impl (unsigned int threads)
+    : pool_ (threads)
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add password hash
+// @param id Target ID
+// @param type Hash type
+// @param value Hash value
+// @param username User name (msdcc1 and msdcc2 only)
+// @param iterations Number of iterations (msdcc2 only)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+password_engine::impl::add_hash (const std::string &id,
+                                 const std::string &type,
+                                 const mobius::core::bytearray &value,
+                                 const std::string &username,
+                                 std::uint32_t iterations)
+{
+    if (type != "nt" && type != "lm" && type != "msdcc1" &&
+        type != "msdcc2" && type != "sha1.utf16")
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("unsupported hash type: " + type));
+
+    auto t = std::make_unique<target> ();
+    t->id = id;
+    t->type = type;
+    t->value = value;
+    t->username = username;
+    t->iterations = iterations;
+
+    targets_.push_back (std::move (t));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add DPAPI master key
+// @param id Target ID
+// @param mk Master key
+// @param sid User SID
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+password_engine::impl::add_master_key (
+    const std::string &id, const mobius::core::os::win::dpapi::master_key &mk,
+    const std::string &sid)
+{
+    auto t = std::make_unique<target> ();
+    t->id = id;
+    t->type = "dpapi.mk";
+    t->mk = mk;
+    t->sid = sid;
+    t->found = mk.is_decrypted ();
+
+    targets_.push_back (std::move (t));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of targets whose password has not been found yet
+// @return Number of pending targets
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::impl::get_pending_count () const
+{
+    return std::count_if (targets_.begin (), targets_.end (),
+                          [] (const auto &t) { return !t->found; });
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Build test plan from pending targets
+// @return Test plan
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+plan
+password_engine::impl::_build_plan () const
+{
+    plan p;
+
+    for (const auto &t : targets_)
+    {
+        // master keys may have been decrypted elsewhere (e.g. using a hash)
+        if (t->type == "dpapi.mk" && t->mk.is_decrypted ())
+            t->found = true;
+
+        if (t->found)
+            continue;
+
+        if (t->type == "nt")
+        {
+            p.nt.emplace (_to_key (t->value), t.get ());
+            p.need_nt = true;
+        }
+
+        else if (t->type == "sha1.utf16")
+        {
+            p.sha1.emplace (_to_key (t->value), t.get ());
+            p.need_sha1 = true;
+        }
+
+        else if (t->type == "lm")
+            p.lm.emplace (_to_key (t->value), t.get ());
+
+        else if (t->type == "dpapi.mk")
+        {
+            p.master_keys.push_back (t.get ());
+
+            if (t->mk.get_flags () & DPAPI_MASTER_KEY_SHA1)
+                p.need_sha1 = true;
+
+            else
+                p.need_nt = true;
+        }
+
+        else
+        {
+            auto iterations = t->type == "msdcc2" ? t->iterations : 0;
+
+            auto iter = std::find_if (
+                p.salted.begin (), p.salted.end (),
+                [&t, iterations] (const auto &g)
+                {
+                    return g.type == t->type && g.username == t->username &&
+                           g.iterations == iterations;
+                });
+
+            if (iter == p.salted.end ())
+                iter = p.salted.insert (
+                    p.salted.end (), {t->type, t->username, iterations, {}});
+
+            iter->targets.push_back (t.get ());
+        }
+    }
+
+    return p;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test one round of candidates, splitting it in batches
+// @param words Candidate passwords
+// @return Number of hits
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::impl::_run_round (const std::vector<std::string> &words)
+{
+    const plan p = _build_plan ();
+
+    if (p.empty () || words.empty ())
+        return 0;
+
+    // test batches
+    const std::size_t batches = (words.size () + batch_size_ - 1) / batch_size_;
+    std::vector<std::vector<worker_hit>> hits (batches);
+
+    for (std::size_t i = 0; i < batches; i++)
+    {
+        auto first = words.begin () + i * batch_size_;
+        auto last = words.begin () +
+                    std::min<std::size_t> (words.size (), (i + 1) * batch_size_);
+
+        pool_.submit ([&p, first, last, &h = hits[i]]
+                      { _test_batch (p, first, last, h); });
+    }
+
+    pool_.wait ();
+
+    // report hits, in candidate order
+    std::uint64_t count = 0;
+
+    for (const auto &batch_hits : hits)
+    {
+        for (const auto &wh : batch_hits)
+        {
+            if (wh.t->type == "dpapi.mk")
+                wh.t->mk.decrypt_with_password (wh.t->sid, wh.password);
+
+            if (hit_callback_)
+                hit_callback_ ({wh.t->id, wh.t->type, wh.password});
+
+            count++;
+        }
+    }
+
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test candidates, in rounds of one batch per thread
+// @param words Candidate passwords
+// @return Number of hits
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::impl::_run (const std::vector<std::string> &words)
+{
+    const std::size_t round_size = std::size_t (batch_size_) * get_threads ();
+    std::uint64_t count = 0;
+
+    if (words.size () <= round_size)
+        return _run_round (words);
+
+    for (std::size_t pos = 0; pos < words.size (); pos += round_size)
+    {
+        std::vector<std::string> round (
+            words.begin () + pos,
+            words.begin () + std::min (words.size (), pos + round_size));
+
+        count += _run_round (round);
+    }
+
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test candidate passwords
+// @param words Candidate passwords
+// @return Number of hits
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::impl::test (const std::vector<std::string> &words)
+{
+    auto start = std::chrono::steady_clock::now ();
+    auto count = _run (words);
+
+    word_count_ += words.size ();
+    elapsed_ += std::chrono::steady_clock::now () - start;
+
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test candidate passwords from wordlist, one password per line
+// @param reader Wordlist reader
+// @param encoding Wordlist encoding
+// @return Number of hits
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::impl::test (const mobius::core::io::reader &reader,
+                             const std::string &encoding)
+{
+    const std::size_t round_size = std::size_t (batch_size_) * get_threads ();
+    mobius::core::io::line_reader lr (reader, encoding);
+
+    std::vector<std::string> round;
+    round.reserve (round_size);
+
+    std::string line;
+    std::uint64_t count = 0;
+    bool eof = get_pending_count () == 0;
+
+    while (!eof)
+    {
+        eof = !lr.read (line);
+
+        if (!eof && !line.empty ())
+            round.push_back (line);
+
+        if (round.size () == round_size || (eof && !round.empty ()))
+        {
+            count += test (round);
+            round.clear ();
+            eof = eof || get_pending_count () == 0;
+        }
+    }
+
+    return count;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Measure test throughput against current targets
+// @param count Number of synthetic candidates
+// @return Words per second
+//
+// Candidates tested by this function are not added to word count.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+double
+password_engine::impl::benchmark (std::uint64_t count)
+{
+    std::vector<std::string> words;
+    words.reserve (count);
+
+    for (std::uint64_t i = 0; i < count; i++)
+        words.push_back ("mobius-benchmark-" + std::to_string (i));
+
+    auto start = std::chrono::steady_clock::now ();
+    _run (words);
+    auto seconds = std::chrono::duration<double> (
+                       std::chrono::steady_clock::now () - start)
+                       .count ();
+
+    return seconds > 0 ? double (count) / seconds : 0.0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param threads Number of worker threads (0 = one per hardware thread)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+password_engine::password_engine (unsigned int threads)
+    : impl_ (std::make_shared<impl> (threads))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add password hash
+// @param id Target ID
+// @param type Hash type (nt, lm, msdcc1, msdcc2 or sha1.utf16)
+// @param value Hash value
+// @param username User name (msdcc1 and msdcc2 only)
+// @param iterations Number of iterations (msdcc2 only)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+password_engine::add_hash (const std::string &id, const std::string &type,
+                           const mobius::core::bytearray &value,
+                           const std::string &username,
+                           std::uint32_t iterations)
+{
+    impl_->add_hash (id, type, value, username, iterations);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Add DPAPI master key
+// @param id Target ID
+// @param mk Master key
+// @param sid User SID
+//
+// Master key is decrypted when its password is found.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+password_engine::add_master_key (
+    const std::string &id, const mobius::core::os::win::dpapi::master_key &mk,
+    const std::string &sid)
+{
+    impl_->add_master_key (id, mk, sid);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set hit callback
+// @param f Callback function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+password_engine::set_hit_callback (const hit_callback_type &f)
+{
+    impl_->set_hit_callback (f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set batch size
+// @param size Number of candidates per batch (0 = default)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+password_engine::set_batch_size (std::uint32_t size)
+{
+    impl_->set_batch_size (size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test candidate passwords
+// @param words Candidate passwords
+// @return Number of hits
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::test (const std::vector<std::string> &words)
+{
+    return impl_->test (words);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Test candidate passwords from wordlist
+// @param reader Wordlist reader, one password per line
+// @param encoding Wordlist encoding
+// @return Number of hits
+//
+// Wordlist is read until its end or until all passwords have been found.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::test (const mobius::core::io::reader &reader,
+                       const std::string &encoding)
+{
+    return impl_->test (reader, encoding);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Measure test throughput against current targets
+// @param count Number of synthetic candidates
+// @return Words per second
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+double
+password_engine::benchmark (std::uint64_t count)
+{
+    return impl_->benchmark (count);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of worker threads
+// @return Number of threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+unsigned int
+password_engine::get_threads () const
+{
+    return impl_->get_threads ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of targets
+// @return Number of targets
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::get_target_count () const
+{
+    return impl_->get_target_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of targets whose password has not been found yet
+// @return Number of pending targets
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::get_pending_count () const
+{
+    return impl_->get_pending_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of candidates tested
+// @return Number of candidates
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+password_engine::get_word_count () const
+{
+    return impl_->get_word_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get average number of candidates tested per second
+// @return Words per second
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+double
+password_engine::get_words_per_second () const
+{
+    return impl_->get_words_per_second ();
+}
+
+} // namespace mobius::core::turing
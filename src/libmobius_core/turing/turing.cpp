@@ -19,8 +19,12 @@
 #include <mobius/core/database/connection_pool.hpp>
 #include <mobius/core/string_functions.hpp>
 #include <mobius/core/turing/turing.hpp>
+#include <algorithm>
+#include <map>
+#include <optional>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // Usage:
@@ -31,6 +35,10 @@
 // operations (set_hash, remove_hashes, get_hash_password, get_hashes, ...)
 // ...
 // transaction.commit ();                        // only when have modified data
+//
+// Hash lookups are cached in memory for the lifetime of the turing object,
+// including negative results. Bulk functions (set_hashes, get_hash_passwords)
+// resolve uncached hashes with one query per chunk of values.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 
 namespace
@@ -42,6 +50,21 @@ static const std::string LM_NULL = "aad3b435b51404ee";
 static const std::string NT_NULL = "31d6cfe0d16ae931b73c59d7e0c089c0";
 static constexpr int SCHEMA_VERSION = 2;
 
+// @brief Max number of hash values per bulk SELECT statement
+static constexpr std::size_t BULK_SELECT_SIZE = 500;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get cache key for hash
+// @param hash_type Hash type
+// @param hash_value Hash value
+// @return Cache key
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::string
+_cache_key (const std::string &hash_type, const std::string &hash_value)
+{
+    return hash_type + '\n' + hash_value;
+}
+
 } // namespace
 
 namespace mobius::core::turing
@@ -76,10 +99,13 @@ class turing::impl
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     mobius::core::database::transaction new_transaction ();
     bool has_hash (const std::string &, const std::string &);
-    void set_hash (const std::string &, const std::string &,
+    bool set_hash (const std::string &, const std::string &,
                    const std::string &);
+    std::uint64_t set_hashes (const hashlist_type &);
     std::pair<pwd_status, std::string>
     get_hash_password (const std::string &, const std::string &) const;
+    std::vector<std::pair<pwd_status, std::string>>
+    get_hash_passwords (const hashkeys_type &) const;
     hashlist_type get_hashes () const;
     void remove_hashes ();
 
@@ -90,8 +116,17 @@ class turing::impl
     // @brief database object
     mutable mobius::core::database::database db_;
 
+    // @brief Hash cache (cache key -> password, or nullopt if not found)
+    mutable std::unordered_map<std::string, std::optional<std::string>>
+        cache_;
+
     // Helper functions
     void _load_database () const;
+    bool _insert_hash (const std::string &, const std::string &,
+                       const std::string &);
+    std::optional<std::string>
+    _lookup_hash (const std::string &, const std::string &) const;
+    void _prefetch_hashes (const hashkeys_type &) const;
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -116,17 +151,7 @@ bool
 turing::impl::has_hash (const std::string &hash_type,
                         const std::string &hash_value)
 {
-    _load_database ();
-
-    auto stmt = db_.new_statement ("SELECT 1 "
-                                   "FROM hash "
-                                   "WHERE type = ? "
-                                   "AND value = ?");
-
-    stmt.bind (1, hash_type);
-    stmt.bind (2, hash_value);
-
-    return bool (stmt.fetch_row ());
+    return bool (_lookup_hash (hash_type, hash_value));
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -134,8 +159,9 @@ turing::impl::has_hash (const std::string &hash_type,
 // @param hash_type Hash type
 // @param hash_value Hash value
 // @param password Password as UTF-8 string
+// @return true if hash has been inserted
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-void
+bool
 turing::impl::set_hash (const std::string &hash_type,
                         const std::string &hash_value,
                         const std::string &password)
@@ -154,23 +180,55 @@ turing::impl::set_hash (const std::string &hash_type,
     }
 
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    // if hash already exists then return
+    // insert hash, if it does not exist yet
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    if (has_hash (hash_type, hash_value))
-        return;
+    return _insert_hash (hash_type, hash_value, password);
+}
 
-    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    // insert hash
-    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    _load_database ();
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set hashes in bulk, using a single transaction
+// @param hashes Tuples <type, value, password>
+// @return Number of hashes inserted
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+turing::impl::set_hashes (const hashlist_type &hashes)
+{
+    std::uint64_t count = 0;
 
-    auto stmt = db_.new_statement ("INSERT INTO hash "
-                                   "VALUES (?, ?, ?)");
+    try
+    {
+        auto transaction = new_transaction ();
 
-    stmt.bind (1, hash_type);
-    stmt.bind (2, hash_value);
-    stmt.bind (3, password);
-    stmt.execute ();
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // prefetch hashes already in database
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        hashkeys_type keys;
+        keys.reserve (hashes.size ());
+
+        for (const auto &[hash_type, hash_value, password] : hashes)
+            keys.emplace_back (hash_type, hash_value);
+
+        _prefetch_hashes (keys);
+
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        // insert new hashes
+        // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+        for (const auto &[hash_type, hash_value, password] : hashes)
+        {
+            if (!has_hash (hash_type, hash_value) &&
+                set_hash (hash_type, hash_value, password))
+                ++count;
+        }
+
+        transaction.commit ();
+    }
+    catch (...)
+    {
+        cache_.clear (); // cache may hold rolled-back hashes
+        throw;
+    }
+
+    return count;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -227,19 +285,11 @@ turing::impl::get_hash_password (const std::string &hash_type,
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     else
     {
-        _load_database ();
-
-        auto stmt = db_.new_statement ("SELECT password "
-                                       "FROM hash "
-                                       "WHERE type = ? "
-                                       "AND value = ?");
-
-        stmt.bind (1, hash_type);
-        stmt.bind (2, hash_value);
+        auto value = _lookup_hash (hash_type, hash_value);
 
-        if (stmt.fetch_row ())
+        if (value)
         {
-            password = stmt.get_column_string (0);
+            password = *value;
             status = pwd_status::found;
         }
     }
@@ -247,6 +297,46 @@ turing::impl::get_hash_password (const std::string &hash_type,
     return std::make_pair (status, password);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get passwords for many hashes at once
+// @param keys Pairs <type, value>
+// @return Pairs <status, password>, in the same order as keys
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<std::pair<turing::pwd_status, std::string>>
+turing::impl::get_hash_passwords (const hashkeys_type &keys) const
+{
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // prefetch hashes, including LM halves
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    hashkeys_type prefetch_keys;
+    prefetch_keys.reserve (keys.size ());
+
+    for (const auto &[hash_type, hash_value] : keys)
+    {
+        if (hash_type == "lm" && hash_value.length () > 16)
+        {
+            prefetch_keys.emplace_back (hash_type, hash_value.substr (0, 16));
+            prefetch_keys.emplace_back (hash_type, hash_value.substr (16));
+        }
+
+        else
+            prefetch_keys.emplace_back (hash_type, hash_value);
+    }
+
+    _prefetch_hashes (prefetch_keys);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // resolve passwords from cache
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::vector<std::pair<pwd_status, std::string>> passwords;
+    passwords.reserve (keys.size ());
+
+    for (const auto &[hash_type, hash_value] : keys)
+        passwords.push_back (get_hash_password (hash_type, hash_value));
+
+    return passwords;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Get hashes
 // @return Tuples <type, value, password>
@@ -283,6 +373,8 @@ turing::impl::remove_hashes ()
 
     auto stmt = db_.new_statement ("DELETE FROM hash");
     stmt.execute ();
+
+    cache_.clear ();
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -363,6 +455,153 @@ turing::impl::_load_database () const
     is_database_loaded_ = true;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Insert hash into database, if it does not exist yet
+// @param hash_type Hash type
+// @param hash_value Hash value
+// @param password Password as UTF-8 string
+// @return true if hash has been inserted
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+turing::impl::_insert_hash (const std::string &hash_type,
+                            const std::string &hash_value,
+                            const std::string &password)
+{
+    if (has_hash (hash_type, hash_value))
+        return false;
+
+    _load_database ();
+
+    auto stmt = db_.new_statement ("INSERT OR IGNORE INTO hash "
+                                   "VALUES (?, ?, ?)");
+
+    stmt.bind (1, hash_type);
+    stmt.bind (2, hash_value);
+    stmt.bind (3, password);
+    stmt.execute ();
+
+    bool inserted = db_.get_changes () > 0;
+
+    if (inserted)
+        cache_[_cache_key (hash_type, hash_value)] = password;
+
+    else
+        cache_.erase (_cache_key (hash_type, hash_value));
+
+    return inserted;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Lookup hash, using cache
+// @param hash_type Hash type
+// @param hash_value Hash value
+// @return Password, if hash is found
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::optional<std::string>
+turing::impl::_lookup_hash (const std::string &hash_type,
+                            const std::string &hash_value) const
+{
+    const auto key = _cache_key (hash_type, hash_value);
+    auto iter = cache_.find (key);
+
+    if (iter != cache_.end ())
+        return iter->second;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // select hash from table
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    _load_database ();
+
+    auto stmt = db_.new_statement ("SELECT password "
+                                   "FROM hash "
+                                   "WHERE type = ? "
+                                   "AND value = ?");
+
+    stmt.bind (1, hash_type);
+    stmt.bind (2, hash_value);
+
+    std::optional<std::string> password;
+
+    if (stmt.fetch_row ())
+        password = stmt.get_column_string (0);
+
+    cache_.emplace (key, password);
+
+    return password;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Load uncached hashes into cache, using bulk SELECT statements
+// @param keys Pairs <type, value>
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+turing::impl::_prefetch_hashes (const hashkeys_type &keys) const
+{
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // group uncached values by hash type
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::map<std::string, std::vector<std::string>> values_by_type;
+
+    for (const auto &[hash_type, hash_value] : keys)
+    {
+        // mark as not found. Found hashes are updated below
+        auto [iter, inserted] =
+            cache_.try_emplace (_cache_key (hash_type, hash_value));
+
+        if (inserted)
+            values_by_type[hash_type].push_back (hash_value);
+    }
+
+    if (values_by_type.empty ())
+        return;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // select hashes from table, in chunks
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    try
+    {
+        _load_database ();
+
+        for (const auto &[hash_type, values] : values_by_type)
+        {
+            for (std::size_t pos = 0; pos < values.size ();
+                 pos += BULK_SELECT_SIZE)
+            {
+                const auto count =
+                    std::min (BULK_SELECT_SIZE, values.size () - pos);
+
+                std::string sql = "SELECT value, password "
+                                  "FROM hash "
+                                  "WHERE type = ? "
+                                  "AND value IN (?";
+
+                for (std::size_t i = 1; i < count; i++)
+                    sql += ", ?";
+
+                sql += ')';
+
+                auto stmt = db_.new_statement (sql);
+                stmt.bind (1, hash_type);
+
+                for (std::size_t i = 0; i < count; i++)
+                    stmt.bind (int (i + 2), values[pos + i]);
+
+                while (stmt.fetch_row ())
+                {
+                    const auto hash_value = stmt.get_column_string (0);
+                    cache_[_cache_key (hash_type, hash_value)] =
+                        stmt.get_column_string (1);
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        cache_.clear (); // do not keep unresolved entries as "not found"
+        throw;
+    }
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Constructor
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -405,6 +644,17 @@ turing::set_hash (const std::string &hash_type, const std::string &hash_value,
     impl_->set_hash (hash_type, hash_value, password);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set hashes in bulk, using a single transaction
+// @param hashes Tuples <type, value, password>
+// @return Number of hashes inserted
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+turing::set_hashes (const hashlist_type &hashes)
+{
+    return impl_->set_hashes (hashes);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Get hash password
 // @param hash_type Hash type
@@ -418,6 +668,17 @@ turing::get_hash_password (const std::string &hash_type,
     return impl_->get_hash_password (hash_type, hash_value);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get passwords for many hashes at once
+// @param keys Pairs <type, value>
+// @return Pairs <status, password>, in the same order as keys
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<std::pair<turing::pwd_status, std::string>>
+turing::get_hash_passwords (const hashkeys_type &keys) const
+{
+    return impl_->get_hash_passwords (keys);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Get hashes
 // @return Tuples <type, value, password>
@@ -0,0 +1,1161 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/vfs/carver.hpp>
+#include <mobius/core/exception.inc>
+#include <mobius/core/thread_pool.hpp>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+namespace mobius::core::vfs
+{
+namespace
+{
+using pattern = mobius::core::decoder::filetype_engine::pattern;
+using signature = carver::signature;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Default header alignment in bytes (sector size)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint64_t DEFAULT_ALIGNMENT = 512;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Default chunk size in bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint64_t DEFAULT_CHUNK_SIZE = 16 * 1024 * 1024;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Signature compiled for carving
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct carving_signature
+{
+    std::uint32_t sig_idx = 0;          // index into signature list
+    std::vector<pattern> patterns;      // fixed patterns, anchor first
+    std::uint64_t header_length = 0;    // sum of pattern lengths
+    std::uint64_t header_end = 0;       // max pattern offset + length
+    std::int64_t footer_idx = -1;       // footer index (-1 = none)
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Header or footer found while scanning
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct hit
+{
+    std::uint64_t pos = 0;              // header start or footer start
+    std::uint64_t end = 0;              // footer end (footers only)
+    std::uint32_t idx = 0;              // carving signature or footer index
+    bool is_header = false;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Candidate being carved
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct open_candidate
+{
+    std::uint64_t start = 0;            // start offset
+    std::uint32_t idx = 0;              // carving signature index
+    std::uint64_t deadline = 0;         // max end offset (exclusive)
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Multi-pattern scanner
+//
+// Each pattern is indexed by one of its two byte windows, chosen to avoid
+// bytes that fill most of the disks (0x00, 0xff and spaces). A 64 KiB
+// filter of all window keys is tested at every position, eight positions
+// at a time. Unlike DFA transitions, filter tests do not depend on each
+// other, so the CPU runs many of them at once. Only positions passing the
+// filter are compared against the patterns sharing that window.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class scanner
+{
+  public:
+    scanner () = default;
+    explicit scanner (const std::vector<std::string> &);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Scan data, calling f (pattern_idx, end_pos) for each match
+    // @param data Data pointer
+    // @param size Data size
+    // @param f Function
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename F>
+    void
+    scan (const std::uint8_t *data, std::uint64_t size, F f) const
+    {
+        if (filter_.empty ())
+            return;
+
+        // one byte patterns
+        for (const auto &[b, pattern_idx] : byte_patterns_)
+        {
+            auto p = data;
+            auto end = data + size;
+
+            while ((p = static_cast<const std::uint8_t *> (
+                        std::memchr (p, b, end - p))) != nullptr)
+            {
+                p++;
+                f (pattern_idx, p - data);
+            }
+        }
+
+        // other patterns, testing filter for blocks of 8 positions first
+        std::uint64_t i = 0;
+
+        for (; i + 9 <= size; i += 8)
+        {
+            std::uint8_t found = 0;
+
+            for (std::uint64_t j = i; j < i + 8; j++)
+                found |= filter_[_get_key (data + j)];
+
+            if (found)
+            {
+                for (std::uint64_t j = i; j < i + 8; j++)
+                    _match (data, size, j, f);
+            }
+        }
+
+        for (; i + 1 < size; i++)
+            _match (data, size, i, f);
+    }
+
+  private:
+    // @brief Pattern indexed by window
+    struct entry
+    {
+        std::uint32_t pattern_idx;
+        std::uint64_t window_pos;
+    };
+
+    // @brief Patterns
+    std::vector<std::string> patterns_;
+
+    // @brief Window filter (one byte per two byte key)
+    std::vector<std::uint8_t> filter_;
+
+    // @brief Patterns by window key
+    std::unordered_map<std::uint32_t, std::vector<entry>> buckets_;
+
+    // @brief One byte patterns
+    std::vector<std::pair<std::uint8_t, std::uint32_t>> byte_patterns_;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get window key
+    // @param p Data pointer
+    // @return Key
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    static std::uint32_t
+    _get_key (const std::uint8_t *p)
+    {
+        return p[0] | (std::uint32_t (p[1]) << 8);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Match patterns whose window is at position i
+    // @param data Data pointer
+    // @param size Data size
+    // @param i Window position
+    // @param f Function
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    template <typename F>
+    void
+    _match (const std::uint8_t *data, std::uint64_t size, std::uint64_t i,
+            F &f) const
+    {
+        auto key = _get_key (data + i);
+
+        if (!filter_[key])
+            return;
+
+        for (const auto &e : buckets_.at (key))
+        {
+            if (i < e.window_pos)
+                continue;
+
+            auto start = i - e.window_pos;
+            const auto &bytes = patterns_[e.pattern_idx];
+
+            if (start + bytes.size () <= size &&
+                std::memcmp (data + start, bytes.data (), bytes.size ()) == 0)
+                f (e.pattern_idx, start + bytes.size ());
+        }
+    }
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param patterns Patterns
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+scanner::scanner (const std::vector<std::string> &patterns)
+    : patterns_ (patterns),
+      filter_ (65536, 0)
+{
+    auto weight = [] (std::uint8_t b)
+    { return (b == 0x00 || b == 0xff) ? 2 : (b == 0x20 ? 1 : 0); };
+
+    for (std::uint32_t pattern_idx = 0; pattern_idx < patterns_.size ();
+         pattern_idx++)
+    {
+        const auto &bytes = patterns_[pattern_idx];
+
+        if (bytes.size () == 1)
+        {
+            byte_patterns_.emplace_back (bytes[0], pattern_idx);
+            continue;
+        }
+
+        // choose window with the least common bytes
+        std::uint64_t window_pos = 0;
+        int window_weight = 5;
+
+        for (std::uint64_t pos = 0; pos + 1 < bytes.size (); pos++)
+        {
+            int w = weight (bytes[pos]) + weight (bytes[pos + 1]);
+
+            if (w < window_weight)
+            {
+                window_pos = pos;
+                window_weight = w;
+            }
+        }
+
+        std::uint32_t key = std::uint8_t (bytes[window_pos]) |
+                            (std::uint32_t (std::uint8_t (bytes[window_pos + 1]))
+                             << 8);
+
+        filter_[key] = 1;
+        buckets_[key].push_back ({pattern_idx, window_pos});
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Check if signature can be carved
+// @param sig Signature
+// @return True/false
+//
+// Carving needs at least one pattern at a fixed offset, to locate the file
+// start, and a max size, to bound files without footer. Signatures with
+// negative priority are too weak to be used alone.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+is_carvable (const signature &sig)
+{
+    return sig.priority >= 0 && sig.max_size > 0 &&
+           std::any_of (
+               sig.header.begin (), sig.header.end (),
+               [] (const pattern &p)
+               {
+                   return p.offset !=
+                              mobius::core::decoder::filetype_engine::
+                                  ANY_OFFSET &&
+                          !p.bytes.empty ();
+               });
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Carver implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class carver::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl (const std::vector<signature> &, unsigned int);
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set candidate callback
+    // @param f Callback function
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_candidate_callback (const candidate_callback_type &f)
+    {
+        candidate_callback_ = f;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set header alignment
+    // @param alignment Alignment in bytes (1 = any offset)
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_alignment (std::uint64_t alignment)
+    {
+        alignment_ = alignment ? alignment : 1;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set chunk size
+    // @param size Chunk size in bytes (0 = default)
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_chunk_size (std::uint64_t size)
+    {
+        chunk_size_ = size ? size : DEFAULT_CHUNK_SIZE;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of worker threads
+    // @return Number of threads
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    unsigned int
+    get_threads () const
+    {
+        return pool_.get_size ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get header alignment
+    // @return Alignment in bytes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_alignment () const
+    {
+        return alignment_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get chunk size
+    // @return Chunk size in bytes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_chunk_size () const
+    {
+        return chunk_size_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of signatures used for carving
+    // @return Number of signatures
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_signature_count () const
+    {
+        return carving_signatures_.size ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of candidates found by last carving
+    // @return Number of candidates
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_candidate_count () const
+    {
+        return candidate_count_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of bytes scanned by last carving
+    // @return Number of bytes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t
+    get_bytes_scanned () const
+    {
+        return bytes_scanned_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get time spent by last carving
+    // @return Time in seconds
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    double
+    get_elapsed_time () const
+    {
+        return std::chrono::duration<double> (elapsed_).count ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get throughput of last carving
+    // @return Bytes per second
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    double
+    get_bytes_per_second () const
+    {
+        auto seconds = get_elapsed_time ();
+        return seconds > 0 ? double (bytes_scanned_) / seconds : 0.0;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::uint64_t carve (const block &, bool);
+    std::uint64_t carve (const mobius::core::io::reader &,
+                         const std::vector<range_type> &);
+
+  private:
+    // @brief Signatures
+    std::vector<signature> signatures_;
+
+    // @brief Signatures used for carving
+    std::vector<carving_signature> carving_signatures_;
+
+    // @brief Footers
+    std::vector<std::string> footers_;
+
+    // @brief Scanner pattern index to (is_header, carving signature or
+    // footer index)
+    std::vector<std::pair<bool, std::uint32_t>> pattern_map_;
+
+    // @brief Extension by filetype
+    std::map<std::string, std::string> extensions_;
+
+    // @brief Anchor and footer scanner
+    scanner scanner_;
+
+    // @brief Filetype engine, used to refine candidate types
+    mobius::core::decoder::filetype_engine engine_;
+
+    // @brief Thread pool
+    mobius::core::thread_pool pool_;
+
+    // @brief Candidate callback
+    candidate_callback_type candidate_callback_;
+
+    // @brief Header alignment
+    std::uint64_t alignment_ = DEFAULT_ALIGNMENT;
+
+    // @brief Chunk size
+    std::uint64_t chunk_size_ = DEFAULT_CHUNK_SIZE;
+
+    // @brief Chunk overlap
+    std::uint64_t overlap_ = 0;
+
+    // @brief Number of candidates found by last carving
+    std::uint64_t candidate_count_ = 0;
+
+    // @brief Number of bytes scanned by last carving
+    std::uint64_t bytes_scanned_ = 0;
+
+    // @brief Time spent by last carving
+    std::chrono::steady_clock::duration elapsed_ {};
+
+    // Helper functions
+    std::vector<hit> _scan (const mobius::core::bytearray &, std::uint64_t,
+                            std::uint64_t, std::uint64_t) const;
+    void _carve_range (mobius::core::io::reader, std::uint64_t, std::uint64_t,
+                       std::uint64_t);
+    void _emit (const mobius::core::io::reader &, const open_candidate &,
+                std::uint64_t, bool, std::uint64_t);
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param signatures Signatures
+// @param threads Number of worker threads (0 = one per hardware thread)
+//
+// Signatures sharing the same fixed patterns and footer are carved once,
+// using the first one without floating patterns. The filetype engine then
+// tells them apart (e.g. docx from zip) when candidates are reported.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+carver::impl::impl (const std::vector<signature> &signatures,
+                    unsigned int threads)
+    : signatures_ (signatures),
+      engine_ (signatures, 1),
+      pool_ (threads)
+{
+    std::map<std::tuple<std::vector<std::pair<std::int64_t, std::string>>,
+                        std::string>,
+             std::uint32_t>
+        carving_signature_idx;
+
+    std::map<std::string, std::uint32_t> footer_idx;
+
+    for (std::uint32_t sig_idx = 0; sig_idx < signatures_.size (); sig_idx++)
+    {
+        const auto &sig = signatures_[sig_idx];
+        extensions_.emplace (sig.type, sig.extension);
+
+        if (!is_carvable (sig))
+            continue;
+
+        // get fixed patterns, using the longest one as anchor
+        carving_signature c;
+        c.sig_idx = sig_idx;
+        bool has_floating_patterns = false;
+
+        for (const auto &p : sig.header)
+        {
+            if (p.offset == mobius::core::decoder::filetype_engine::ANY_OFFSET)
+                has_floating_patterns = true;
+
+            else if (!p.bytes.empty ())
+            {
+                c.patterns.push_back (p);
+                c.header_length += p.bytes.size ();
+                c.header_end = std::max (c.header_end, std::uint64_t (p.offset) +
+                                                           p.bytes.size ());
+            }
+        }
+
+        std::stable_sort (c.patterns.begin (), c.patterns.end (),
+                          [] (const pattern &a, const pattern &b)
+                          { return a.bytes.size () > b.bytes.size (); });
+
+        // merge signatures with the same fixed patterns and footer
+        std::vector<std::pair<std::int64_t, std::string>> key_patterns;
+
+        for (const auto &p : c.patterns)
+            key_patterns.emplace_back (p.offset, p.bytes);
+
+        std::sort (key_patterns.begin (), key_patterns.end ());
+        auto key = std::make_tuple (key_patterns, sig.footer);
+
+        auto iter = carving_signature_idx.find (key);
+
+        if (iter != carving_signature_idx.end ())
+        {
+            auto &other = carving_signatures_[iter->second];
+            const auto &other_sig = signatures_[other.sig_idx];
+
+            if (!has_floating_patterns &&
+                std::any_of (other_sig.header.begin (), other_sig.header.end (),
+                             [] (const pattern &p)
+                             {
+                                 return p.offset == mobius::core::decoder::
+                                                        filetype_engine::
+                                                            ANY_OFFSET;
+                             }))
+                other.sig_idx = sig_idx;
+
+            continue;
+        }
+
+        // add footer
+        if (!sig.footer.empty ())
+        {
+            auto [f_iter, inserted] = footer_idx.try_emplace (
+                sig.footer, std::uint32_t (footers_.size ()));
+
+            if (inserted)
+                footers_.push_back (sig.footer);
+
+            c.footer_idx = f_iter->second;
+        }
+
+        carving_signature_idx.emplace (key, carving_signatures_.size ());
+        carving_signatures_.push_back (std::move (c));
+    }
+
+    // compile anchors and footers
+    std::vector<std::string> patterns;
+
+    for (std::uint32_t i = 0; i < carving_signatures_.size (); i++)
+    {
+        const auto &c = carving_signatures_[i];
+        patterns.push_back (c.patterns[0].bytes);
+        pattern_map_.emplace_back (true, i);
+        overlap_ = std::max (overlap_, c.header_end);
+    }
+
+    for (std::uint32_t i = 0; i < footers_.size (); i++)
+    {
+        patterns.push_back (footers_[i]);
+        pattern_map_.emplace_back (false, i);
+        overlap_ = std::max (overlap_, std::uint64_t (footers_[i].size ()));
+    }
+
+    scanner_ = scanner (patterns);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Scan chunk for headers and footers
+// @param data Chunk data, followed by overlap bytes
+// @param chunk_start Chunk start offset
+// @param chunk_end Chunk end offset (exclusive)
+// @param range_start Range start offset, for alignment
+// @return Hits, sorted by position
+//
+// Only hits starting inside the chunk are returned. Hits starting in the
+// overlap bytes are returned by the next chunk. When more than one
+// signature matches at the same offset, the one with the highest priority
+// and longest header is kept.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<hit>
+carver::impl::_scan (const mobius::core::bytearray &data,
+                     std::uint64_t chunk_start, std::uint64_t chunk_end,
+                     std::uint64_t range_start) const
+{
+    std::vector<hit> hits;
+    const std::uint8_t *p_data = data.data ();
+    const std::uint64_t size = data.size ();
+
+    scanner_.scan (
+        p_data, size,
+        [&] (std::uint32_t pattern_idx, std::uint64_t end_pos)
+        {
+            auto [is_header, idx] = pattern_map_[pattern_idx];
+
+            // footers
+            if (!is_header)
+            {
+                auto length = footers_[idx].size ();
+                auto pos = chunk_start + end_pos - length;
+
+                if (pos < chunk_end)
+                    hits.push_back ({pos, chunk_start + end_pos, idx, false});
+
+                return;
+            }
+
+            // headers, checking start position and other fixed patterns
+            const auto &c = carving_signatures_[idx];
+            const auto &anchor = c.patterns[0];
+            auto anchor_pos = end_pos - anchor.bytes.size ();
+
+            if (anchor_pos < std::uint64_t (anchor.offset))
+                return;
+
+            auto rel_start = anchor_pos - anchor.offset;
+            auto start = chunk_start + rel_start;
+
+            if (start >= chunk_end || (start - range_start) % alignment_ != 0)
+                return;
+
+            for (auto iter = c.patterns.begin () + 1; iter != c.patterns.end ();
+                 ++iter)
+            {
+                auto pos = rel_start + iter->offset;
+
+                if (pos + iter->bytes.size () > size ||
+                    std::memcmp (p_data + pos, iter->bytes.data (),
+                                 iter->bytes.size ()) != 0)
+                    return;
+            }
+
+            hits.push_back ({start, 0, idx, true});
+        });
+
+    // sort hits, keeping only the best header at each position
+    std::sort (hits.begin (), hits.end (),
+               [] (const hit &a, const hit &b)
+               {
+                   return std::tie (a.pos, a.is_header, a.idx) <
+                          std::tie (b.pos, b.is_header, b.idx);
+               });
+
+    std::vector<hit> result;
+
+    for (const auto &h : hits)
+    {
+        if (h.is_header && !result.empty () && result.back ().is_header &&
+            result.back ().pos == h.pos)
+        {
+            const auto &c1 = carving_signatures_[result.back ().idx];
+            const auto &c2 = carving_signatures_[h.idx];
+
+            if (std::make_tuple (signatures_[c2.sig_idx].priority,
+                                 c2.header_length) >
+                std::make_tuple (signatures_[c1.sig_idx].priority,
+                                 c1.header_length))
+                result.back () = h;
+        }
+
+        else
+            result.push_back (h);
+    }
+
+    return result;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Report candidate
+// @param reader Reader
+// @param o Open candidate
+// @param end End offset (exclusive)
+// @param has_footer True if candidate was closed by its footer
+// @param base_offset Offset of reader from the start of carved data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+carver::impl::_emit (const mobius::core::io::reader &reader,
+                     const open_candidate &o, std::uint64_t end,
+                     bool has_footer, std::uint64_t base_offset)
+{
+    candidate_count_++;
+
+    if (!candidate_callback_)
+        return;
+
+    const auto &sig = signatures_[carving_signatures_[o.idx].sig_idx];
+
+    candidate cd;
+    cd.offset = base_offset + o.start;
+    cd.size = end - o.start;
+    cd.has_footer = has_footer;
+    cd.reader = mobius::core::io::new_slice_reader (reader, o.start, end - 1);
+    cd.type = engine_.classify (cd.reader);
+
+    if (cd.type.empty ())
+        cd.type = sig.type;
+
+    auto iter = extensions_.find (cd.type);
+    cd.extension = (iter == extensions_.end ()) ? sig.extension : iter->second;
+
+    candidate_callback_ (cd);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Carve range of data
+// @param reader Reader
+// @param start Start offset
+// @param end End offset (exclusive)
+// @param base_offset Offset of reader from the start of carved data
+//
+// Chunks are read by the calling thread and scanned by the thread pool,
+// with at most one chunk per thread waiting to be scanned. Hits are then
+// processed in chunk order, so candidates can span any number of chunks.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+carver::impl::_carve_range (mobius::core::io::reader reader,
+                            std::uint64_t start, std::uint64_t end,
+                            std::uint64_t base_offset)
+{
+    if (start >= end || carving_signatures_.empty ())
+        return;
+
+    // scan chunks in parallel
+    struct chunk_result
+    {
+        std::vector<hit> hits;
+        std::exception_ptr error;
+    };
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::map<std::uint64_t, chunk_result> results;
+
+    const std::uint64_t chunks = (end - start + chunk_size_ - 1) / chunk_size_;
+    const std::uint64_t max_pending = get_threads () + 1;
+    std::uint64_t next_read = 0;
+
+    std::vector<open_candidate> open_candidates;
+
+    try
+    {
+        for (std::uint64_t chunk_idx = 0; chunk_idx < chunks; chunk_idx++)
+        {
+            // read chunks ahead
+            while (next_read < chunks && next_read - chunk_idx < max_pending)
+            {
+                auto chunk_start = start + next_read * chunk_size_;
+                auto chunk_end = std::min (chunk_start + chunk_size_, end);
+                auto data = reader.read_at (
+                    chunk_start,
+                    std::min (chunk_end + overlap_, end) - chunk_start);
+
+                pool_.submit (
+                    [this, &mutex, &cv, &results, idx = next_read,
+                     data = std::move (data), chunk_start, chunk_end, start]
+                    {
+                        chunk_result r;
+
+                        try
+                        {
+                            r.hits = _scan (data, chunk_start, chunk_end, start);
+                        }
+                        catch (...)
+                        {
+                            r.error = std::current_exception ();
+                        }
+
+                        std::lock_guard<std::mutex> lock (mutex);
+                        results.emplace (idx, std::move (r));
+                        cv.notify_all ();
+                    });
+
+                next_read++;
+            }
+
+            // wait for chunk result
+            chunk_result r;
+
+            {
+                std::unique_lock<std::mutex> lock (mutex);
+                cv.wait (lock, [&results, chunk_idx]
+                         { return results.count (chunk_idx) > 0; });
+
+                auto iter = results.find (chunk_idx);
+                r = std::move (iter->second);
+                results.erase (iter);
+            }
+
+            if (r.error)
+                std::rethrow_exception (r.error);
+
+            // process hits
+            auto chunk_end = std::min (start + (chunk_idx + 1) * chunk_size_, end);
+
+            auto close_expired = [&] (std::uint64_t pos)
+            {
+                auto iter = open_candidates.begin ();
+
+                while (iter != open_candidates.end ())
+                {
+                    if (iter->deadline <= pos)
+                    {
+                        _emit (reader, *iter, iter->deadline, false, base_offset);
+                        iter = open_candidates.erase (iter);
+                    }
+
+                    else
+                        ++iter;
+                }
+            };
+
+            for (const auto &h : r.hits)
+            {
+                close_expired (h.pos);
+
+                auto iter = open_candidates.begin ();
+
+                while (iter != open_candidates.end ())
+                {
+                    auto footer_idx = carving_signatures_[iter->idx].footer_idx;
+
+                    // footer closes open candidates with the same footer
+                    if (!h.is_header && footer_idx == std::int64_t (h.idx) &&
+                        h.end <= iter->deadline)
+                    {
+                        _emit (reader, *iter, h.end, true, base_offset);
+                        iter = open_candidates.erase (iter);
+                    }
+
+                    // header closes open candidates without footer
+                    else if (h.is_header && footer_idx == -1)
+                    {
+                        _emit (reader, *iter, h.pos, false, base_offset);
+                        iter = open_candidates.erase (iter);
+                    }
+
+                    else
+                        ++iter;
+                }
+
+                if (h.is_header)
+                {
+                    const auto &sig =
+                        signatures_[carving_signatures_[h.idx].sig_idx];
+
+                    auto deadline = end;
+
+                    if (sig.max_size < end - h.pos)
+                        deadline = h.pos + sig.max_size;
+
+                    open_candidates.push_back ({h.pos, h.idx, deadline});
+                }
+            }
+
+            close_expired (chunk_end);
+            bytes_scanned_ += chunk_end - (start + chunk_idx * chunk_size_);
+        }
+    }
+    catch (...)
+    {
+        pool_.wait ();
+        throw;
+    }
+
+    pool_.wait ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Carve reader ranges
+// @param reader Reader
+// @param ranges Ranges, as (start, end) offsets, end inclusive
+// @return Number of candidates
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::impl::carve (const mobius::core::io::reader &reader,
+                     const std::vector<range_type> &ranges)
+{
+    if (!reader)
+        throw std::invalid_argument (MOBIUS_EXCEPTION_MSG ("invalid reader"));
+
+    candidate_count_ = 0;
+    bytes_scanned_ = 0;
+
+    auto start_time = std::chrono::steady_clock::now ();
+    auto size = reader.get_size ();
+
+    for (const auto &[start, end] : ranges)
+    {
+        if (end < start)
+            throw std::invalid_argument (MOBIUS_EXCEPTION_MSG ("invalid range"));
+
+        if (start < size)
+            _carve_range (reader, start, std::min (end + 1, size), 0);
+    }
+
+    elapsed_ = std::chrono::steady_clock::now () - start_time;
+
+    return candidate_count_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Carve block data
+// @param b Block
+// @param unallocated_only If true, carve only freespace sub-blocks
+// @return Number of candidates
+//
+// Freespace blocks are carved through their own readers. Candidate offsets
+// are relative to the start of b, adding the start addresses of every block
+// down to each freespace.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::impl::carve (const block &b, bool unallocated_only)
+{
+    if (!unallocated_only)
+    {
+        auto reader = b.new_reader ();
+
+        if (!reader)
+            throw std::invalid_argument (
+                MOBIUS_EXCEPTION_MSG ("block has no data"));
+
+        return carve (reader, {{0, reader.get_size () - 1}});
+    }
+
+    candidate_count_ = 0;
+    bytes_scanned_ = 0;
+
+    auto start_time = std::chrono::steady_clock::now ();
+    std::vector<std::pair<block, std::uint64_t>> blocks {{b, 0}};
+
+    while (!blocks.empty ())
+    {
+        auto [current, base_offset] = blocks.back ();
+        blocks.pop_back ();
+
+        if (current.get_type () == "freespace")
+        {
+            auto reader = current.new_reader ();
+
+            if (reader)
+                _carve_range (reader, 0, reader.get_size (), base_offset);
+
+            continue;
+        }
+
+        auto children = current.get_children ();
+
+        for (auto iter = children.rbegin (); iter != children.rend (); ++iter)
+        {
+            std::uint64_t child_offset = base_offset;
+
+            if (iter->has_attribute ("start_address"))
+                child_offset += iter->get_attribute<std::int64_t> ("start_address");
+
+            blocks.emplace_back (*iter, child_offset);
+        }
+    }
+
+    elapsed_ = std::chrono::steady_clock::now () - start_time;
+
+    return candidate_count_;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param threads Number of worker threads (0 = one per hardware thread)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+carver::carver (unsigned int threads)
+    : impl_ (std::make_shared<impl> (
+          mobius::core::decoder::filetype_engine::get_default_signatures (),
+          threads))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param signatures Signatures
+// @param threads Number of worker threads (0 = one per hardware thread)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+carver::carver (const std::vector<signature> &signatures, unsigned int threads)
+    : impl_ (std::make_shared<impl> (signatures, threads))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set candidate callback
+// @param f Callback function
+//
+// The callback is always called from the thread calling carve.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+carver::set_candidate_callback (const candidate_callback_type &f)
+{
+    impl_->set_candidate_callback (f);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set header alignment
+// @param alignment Alignment in bytes (1 = any offset)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+carver::set_alignment (std::uint64_t alignment)
+{
+    impl_->set_alignment (alignment);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set chunk size
+// @param size Chunk size in bytes (0 = default)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+carver::set_chunk_size (std::uint64_t size)
+{
+    impl_->set_chunk_size (size);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Carve block data
+// @param b Block
+// @param unallocated_only If true, carve only freespace sub-blocks
+// @return Number of candidates
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::carve (const block &b, bool unallocated_only)
+{
+    return impl_->carve (b, unallocated_only);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Carve reader data
+// @param reader Reader
+// @return Number of candidates
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::carve (const mobius::core::io::reader &reader)
+{
+    if (!reader)
+        throw std::invalid_argument (MOBIUS_EXCEPTION_MSG ("invalid reader"));
+
+    return impl_->carve (reader, {{0, reader.get_size () - 1}});
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Carve reader ranges
+// @param reader Reader
+// @param ranges Ranges, as (start, end) offsets, end inclusive
+// @return Number of candidates
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::carve (const mobius::core::io::reader &reader,
+               const std::vector<range_type> &ranges)
+{
+    return impl_->carve (reader, ranges);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of worker threads
+// @return Number of threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+unsigned int
+carver::get_threads () const
+{
+    return impl_->get_threads ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get header alignment
+// @return Alignment in bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::get_alignment () const
+{
+    return impl_->get_alignment ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get chunk size
+// @return Chunk size in bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::get_chunk_size () const
+{
+    return impl_->get_chunk_size ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of signatures used for carving
+// @return Number of signatures
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::get_signature_count () const
+{
+    return impl_->get_signature_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of candidates found by last carving
+// @return Number of candidates
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::get_candidate_count () const
+{
+    return impl_->get_candidate_count ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of bytes scanned by last carving
+// @return Number of bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::uint64_t
+carver::get_bytes_scanned () const
+{
+    return impl_->get_bytes_scanned ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get time spent by last carving
+// @return Time in seconds
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+double
+carver::get_elapsed_time () const
+{
+    return impl_->get_elapsed_time ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get throughput of last carving
+// @return Bytes per second
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+double
+carver::get_bytes_per_second () const
+{
+    return impl_->get_bytes_per_second ();
+}
+
+} // namespace mobius::core::vfs
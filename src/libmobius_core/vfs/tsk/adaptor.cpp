@@ -44,10 +44,8 @@ mobius_read (TSK_IMG_INFO *img, TSK_OFF_T off, char *buf, size_t len)
 
     try
     {
-        p->reader.seek (off);
-        auto data = p->reader.read (len);
-        memcpy (buf, data.data (), data.size ());
-        ret = data.size ();
+        ret = p->reader.read_at (off, reinterpret_cast<std::uint8_t *> (buf),
+                                 len);
     }
     catch (const std::exception &e)
     {
@@ -66,35 +66,57 @@ reader_impl_file::seek (offset_type offset, whence_type w)
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-// @brief Read bytes from reader
+// @brief Read bytes from reader into buffer
+// @param buffer Buffer, with at least size bytes
 // @param size Size in bytes
-// @return Bytearray containing data
+// @return Number of bytes read
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-mobius::core::bytearray
-reader_impl_file::read (size_type size)
+reader_impl_file::size_type
+reader_impl_file::read_into (std::uint8_t *buffer, size_type size)
 {
+    if (pos_ >= size_ || size == 0)
+        return 0;
+
     if (pos_ + size > size_)
         size = size_ - pos_;
 
-    mobius::core::bytearray data (size);
+    ssize_t count =
+        tsk_fs_file_read (fs_file_.get_pointer (), pos_,
+                          reinterpret_cast<char *> (buffer), size,
+                          TSK_FS_FILE_READ_FLAG_NONE);
+
+    if (count < 0)
+        throw std::runtime_error (TSK_EXCEPTION_MSG);
+
+    pos_ += count;
+    return count;
+}
 
-    if (size > 0)
-    {
-        ssize_t count =
-            tsk_fs_file_read (fs_file_.get_pointer (), pos_,
-                              reinterpret_cast<char *> (data.data ()), size,
-                              TSK_FS_FILE_READ_FLAG_NONE);
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read bytes from a given position into buffer
+// @param offset Offset in bytes from the beginning of file
+// @param buffer Buffer, with at least size bytes
+// @param size Size in bytes
+// @return Number of bytes read
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+reader_impl_file::size_type
+reader_impl_file::read_at (size_type offset, std::uint8_t *buffer, size_type size)
+{
+    if (offset >= size_ || size == 0)
+        return 0;
 
-        if (count < 0)
-            throw std::runtime_error (TSK_EXCEPTION_MSG);
+    if (offset + size > size_)
+        size = size_ - offset;
 
-        if (size_type (count) < size)
-            data.resize (count);
+    ssize_t count =
+        tsk_fs_file_read (fs_file_.get_pointer (), offset,
+                          reinterpret_cast<char *> (buffer), size,
+                          TSK_FS_FILE_READ_FLAG_NONE);
 
-        pos_ += count;
-    }
+    if (count < 0)
+        throw std::runtime_error (TSK_EXCEPTION_MSG);
 
-    return data;
+    return count;
 }
 
 } // namespace mobius::core::vfs::tsk
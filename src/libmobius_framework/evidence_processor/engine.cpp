@@ -19,14 +19,44 @@
 #include <mobius/core/datasource/datasource_vfs.hpp>
 #include <mobius/core/io/walker.hpp>
 #include <mobius/core/log.hpp>
+#include <mobius/core/thread_pool.hpp>
 #include <mobius/framework/evidence_processor/engine.hpp>
 #include <mobius/framework/evidence_processor/evidence_processor_registry.hpp>
 #include <mobius/framework/evidence_processor/mediator.hpp>
+#include <mobius/framework/model/case.hpp>
+#include <mobius/framework/model/evidence_loader.hpp>
 #include <atomic>
+#include <functional>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
 #include <string>
+#include <vector>
+
+namespace
+{
+// @brief Minimum number of subtrees per worker thread, for load balancing
+constexpr unsigned int SUBTREES_PER_THREAD = 4;
+
+// @brief Maximum folder depth used to split folder tree into subtrees
+constexpr int MAX_SPLIT_DEPTH = 4;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Folder tree node, used to split folder tree into subtrees
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct folder_node
+{
+    // @brief Folder object
+    mobius::core::io::folder folder;
+
+    // @brief Flag: folder children have been listed
+    bool is_expanded = false;
+
+    // @brief Children indexes
+    std::vector<std::size_t> children;
+};
+
+} // namespace
 
 namespace mobius::framework::evidence_processor
 {
@@ -43,6 +73,9 @@ class engine::impl
         update
     };
 
+    using implementation_list =
+        std::vector<std::shared_ptr<evidence_processor_impl_base>>;
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Constructors
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -65,6 +98,26 @@ class engine::impl
     profile get_profile () const;
     mobius::core::pod::map get_status () const;
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get number of worker threads
+    // @return Number of threads
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    unsigned int
+    get_threads () const
+    {
+        return threads_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Set number of worker threads
+    // @param threads Number of threads (0 = one per hardware thread)
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    set_threads (unsigned int threads)
+    {
+        threads_ = threads ? threads : mobius::core::get_hardware_threads ();
+    }
+
   private:
     // @brief Case item
     mobius::framework::model::item item_;
@@ -76,11 +129,14 @@ class engine::impl
     mediator mediator_;
 
     // @brief Processor implementations
-    std::vector<std::shared_ptr<evidence_processor_impl_base>> implementations_;
+    implementation_list implementations_;
 
     // @brief Current mode
     mode current_mode_ = mode::none;
 
+    // @brief Number of worker threads (1 = sequential processing)
+    unsigned int threads_ = 1;
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Processing status
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -110,7 +166,13 @@ class engine::impl
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     void _complete ();
     void _load_evidences ();
-    void _process_folder (const mobius::core::io::folder &);
+    void _process_folder (
+        const mobius::core::io::folder &, const implementation_list &, bool
+    );
+    void _process_folders_parallel (
+        const std::vector<mobius::core::io::folder> &,
+        const implementation_list &
+    );
     void _run_vfs ();
     void _start ();
     void _stop ();
@@ -242,6 +304,7 @@ engine::impl::get_status () const
         {"evidence_processors",
          implementations_.size ()},
         {"started_time", started_time_},
+        {"threads", threads_},
     };
 
     // Add finished time if processing is complete, otherwise add current time
@@ -336,24 +399,27 @@ engine::impl::_complete ()
 {
     mobius::core::log log (__FILE__, __FUNCTION__);
 
-    auto transaction = item_.new_transaction ();
-
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    // Notify implementations that processing is complete
+    // Notify implementations that processing is complete. Implementations
+    // create their evidences here, so they run in the case writer thread,
+    // serialized with other case writers.
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    for (const auto &impl : implementations_)
-    {
-        try
+    item_.get_case ().get_write_queue ().run (
+        [this, &log] (mobius::core::database::database &)
         {
-            impl->on_complete ();
-        }
-        catch (const std::exception &e)
-        {
-            log.warning (__LINE__, e.what ());
+            for (const auto &impl : implementations_)
+            {
+                try
+                {
+                    impl->on_complete ();
+                }
+                catch (const std::exception &e)
+                {
+                    log.warning (__LINE__, e.what ());
+                }
+            }
         }
-    }
-
-    transaction.commit ();
+    );
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -365,7 +431,9 @@ engine::impl::_load_evidences ()
     mobius::core::log log (__FILE__, __FUNCTION__);
     loaded_evidences_.store (0);
 
-    for (auto &e : item_.get_evidences ())
+    mobius::framework::model::evidence_loader loader (item_);
+
+    while (auto e = loader.get ())
     {
         for (const auto &impl : implementations_)
         {
@@ -413,8 +481,16 @@ engine::impl::_run_vfs ()
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // @deprecated Load evidences created by deprecated implementations and
     // feed them back into the processor, to feed events to implementations.
+    // Evidences are loaded before the events are sent, because handlers may
+    // create new evidences.
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    for (auto &e : item_.get_evidences ())
+    std::vector<mobius::framework::model::evidence> evidences;
+    mobius::framework::model::evidence_loader loader (item_);
+
+    while (auto e = loader.get ())
+        evidences.push_back (e);
+
+    for (auto &e : evidences)
     {
         for (const auto &impl : implementations_)
         {
@@ -439,6 +515,7 @@ engine::impl::_run_vfs ()
     processed_files_.store (0);
 
     auto flag_all_folders = profile_.get_processor_scope () == "all";
+    std::vector<mobius::core::io::folder> folders;
 
     for (const auto &entry : vfs.get_root_entries ())
     {
@@ -447,7 +524,7 @@ engine::impl::_run_vfs ()
             auto folder = entry.get_folder ();
 
             if (flag_all_folders)
-                _process_folder (folder);
+                folders.push_back (folder);
 
             else
             {
@@ -457,7 +534,7 @@ engine::impl::_run_vfs ()
                 {
                     if (name == "home" || name == "users" ||
                         name == "documents and settings")
-                        _process_folder (child);
+                        folders.push_back (child);
 
                     else if (name == "windows.old")
                     {
@@ -465,25 +542,322 @@ engine::impl::_run_vfs ()
 
                         for (const auto &user_folder :
                              wo_walker.get_folders_by_name ("users"))
-                            _process_folder (user_folder);
+                            folders.push_back (user_folder);
                     }
                 }
             }
         }
     }
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // In parallel mode, thread-safe implementations are processed first,
+    // using worker threads. Other implementations are processed
+    // sequentially afterwards.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    implementation_list parallel_implementations;
+    implementation_list sequential_implementations;
+
+    for (const auto &impl : implementations_)
+    {
+        if (threads_ > 1 && impl->is_thread_safe ())
+            parallel_implementations.push_back (impl);
+
+        else
+            sequential_implementations.push_back (impl);
+    }
+
+    if (!parallel_implementations.empty ())
+        _process_folders_parallel (folders, parallel_implementations);
+
+    if (!sequential_implementations.empty ())
+    {
+        bool update_status = parallel_implementations.empty ();
+
+        for (const auto &folder : folders)
+            _process_folder (folder, sequential_implementations, update_status);
+    }
+
     log.info (__LINE__, "Finished VFS processing");
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Process folders using worker threads
+// @param folders Folders to process
+// @param implementations Thread-safe implementations
+//
+// Folder tree is split into subtrees, expanding folders breadth-first until
+// there are at least SUBTREES_PER_THREAD subtrees per thread. Split folders
+// are processed by implementations in the engine thread. Each subtree is
+// processed by a new set of workers, in the thread pool. Subtrees are
+// taken from the pool queue as threads become idle. Workers are joined
+// back into the implementations that created them, in folder tree order,
+// so results do not depend on thread scheduling. Implementations that do
+// not create workers process subtrees in the engine thread.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+engine::impl::_process_folders_parallel (
+    const std::vector<mobius::core::io::folder> &folders,
+    const implementation_list &implementations
+)
+{
+    mobius::core::log log (__FILE__, __FUNCTION__);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Split folder tree into subtrees
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::vector<folder_node> nodes;
+    std::vector<std::size_t> leaves;
+
+    for (const auto &folder : folders)
+    {
+        leaves.push_back (nodes.size ());
+        nodes.push_back ({folder, false, {}});
+    }
+
+    const std::size_t min_subtrees =
+        std::size_t (threads_) * SUBTREES_PER_THREAD;
+
+    for (int depth = 0; depth < MAX_SPLIT_DEPTH && !leaves.empty () &&
+                        leaves.size () < min_subtrees;
+         depth++)
+    {
+        std::vector<std::size_t> next_leaves;
+
+        for (auto idx : leaves)
+        {
+            auto folder = nodes[idx].folder;
+            nodes[idx].is_expanded = true;
+
+            try
+            {
+                for (const auto &entry : folder.get_children ())
+                {
+                    if (entry.is_folder ())
+                    {
+                        nodes[idx].children.push_back (nodes.size ());
+                        next_leaves.push_back (nodes.size ());
+                        nodes.push_back ({entry.get_folder (), false, {}});
+                    }
+
+                    else
+                        processed_files_.fetch_add (1);
+                }
+            }
+            catch (const std::exception &e)
+            {
+                log.warning (__LINE__, e.what ());
+            }
+        }
+
+        leaves = std::move (next_leaves);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Collect subtrees, in folder tree order
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::vector<std::size_t> subtrees;
+
+    std::function<void (std::size_t)> collect = [&] (std::size_t idx)
+    {
+        if (!nodes[idx].is_expanded)
+            subtrees.push_back (idx);
+
+        else
+        {
+            for (auto child : nodes[idx].children)
+                collect (child);
+        }
+    };
+
+    for (std::size_t idx = 0; idx < folders.size (); idx++)
+        collect (idx);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Create one worker per implementation and subtree. Implementations
+    // that fail to create any worker process every subtree in the engine
+    // thread instead.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    using worker_slot =
+        std::pair<std::shared_ptr<evidence_processor_impl_base>,
+                  std::shared_ptr<evidence_processor_impl_base>>;
+
+    std::vector<std::vector<worker_slot>> slots (subtrees.size ());
+    implementation_list serial_implementations;
+
+    for (const auto &impl : implementations)
+    {
+        std::vector<std::shared_ptr<evidence_processor_impl_base>> impl_workers;
+
+        try
+        {
+            for (std::size_t i = 0; i < subtrees.size (); i++)
+            {
+                auto worker = impl->new_worker ();
+
+                if (!worker)
+                    break;
+
+                impl_workers.push_back (worker);
+            }
+        }
+        catch (const std::exception &e)
+        {
+            log.warning (__LINE__, e.what ());
+        }
+
+        if (impl_workers.size () == subtrees.size ())
+        {
+            for (std::size_t i = 0; i < subtrees.size (); i++)
+                slots[i].emplace_back (impl, impl_workers[i]);
+        }
+
+        else
+        {
+            log.warning (
+                __LINE__,
+                "Thread-safe implementation has no worker. Processing it "
+                "sequentially"
+            );
+            serial_implementations.push_back (impl);
+        }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Process split folders in the engine thread, with subtrees of serial
+    // implementations, in folder tree order
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::function<void (std::size_t)> visit = [&] (std::size_t idx)
+    {
+        const auto &node = nodes[idx];
+
+        if (!node.is_expanded)
+        {
+            if (!serial_implementations.empty ())
+                _process_folder (
+                    node.folder, serial_implementations,
+                    serial_implementations.size () == implementations.size ()
+                );
+
+            return;
+        }
+
+        {
+            processed_folders_.fetch_add (1);
+
+            std::lock_guard<std::mutex> lock (status_mutex_);
+            current_folder_path_ = node.folder.get_path ();
+        }
+
+        for (const auto &impl : implementations)
+        {
+            try
+            {
+                impl->on_folder_entered (node.folder);
+            }
+            catch (const std::exception &e)
+            {
+                log.warning (__LINE__, e.what ());
+            }
+        }
+
+        for (auto child : node.children)
+            visit (child);
+
+        for (const auto &impl : implementations)
+        {
+            try
+            {
+                impl->on_folder_exited (node.folder);
+            }
+            catch (const std::exception &e)
+            {
+                log.warning (__LINE__, e.what ());
+            }
+        }
+    };
+
+    for (std::size_t idx = 0; idx < folders.size (); idx++)
+        visit (idx);
+
+    log.info (
+        __LINE__, "Processing " + std::to_string (subtrees.size ()) +
+                      " subtrees using " + std::to_string (threads_) +
+                      " threads"
+    );
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Process subtrees in the thread pool, one set of workers per subtree
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    if (serial_implementations.size () < implementations.size ())
+    {
+        std::vector<implementation_list> workers (subtrees.size ());
+
+        for (std::size_t i = 0; i < subtrees.size (); i++)
+        {
+            for (const auto &[impl, worker] : slots[i])
+                workers[i].push_back (worker);
+        }
+
+        mobius::core::thread_pool pool (threads_);
+
+        for (std::size_t i = 0; i < subtrees.size (); i++)
+        {
+            pool.submit (
+                [this, folder = nodes[subtrees[i]].folder, &w = workers[i]]
+                {
+                    auto connection = item_.new_connection ();
+                    _process_folder (folder, w, true);
+                }
+            );
+        }
+
+        pool.wait ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Join workers into their own implementations, in folder tree order
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    for (const auto &subtree_slots : slots)
+    {
+        for (const auto &[impl, worker] : subtree_slots)
+        {
+            try
+            {
+                impl->join_worker (*worker);
+            }
+            catch (const std::exception &e)
+            {
+                log.warning (__LINE__, e.what ());
+            }
+        }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Clear split folders children cache to free memory
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    for (auto &node : nodes)
+    {
+        if (node.is_expanded)
+            node.folder.reload ();
+    }
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Process folder
 // @param folder Folder object
+// @param implementations Implementations to notify
+// @param update_status Update processed folders and files counters
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-engine::impl::_process_folder (const mobius::core::io::folder &folder)
+engine::impl::_process_folder (
+    const mobius::core::io::folder &folder,
+    const implementation_list &implementations,
+    bool update_status
+)
 {
     mobius::core::log log (__FILE__, __FUNCTION__);
 
+    if (update_status)
     {
         processed_folders_.fetch_add (1);
 
@@ -494,7 +868,7 @@ engine::impl::_process_folder (const mobius::core::io::folder &folder)
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Notify implementations that we're entering a folder
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    for (const auto &impl : implementations_)
+    for (const auto &impl : implementations)
     {
         try
         {
@@ -514,9 +888,11 @@ engine::impl::_process_folder (const mobius::core::io::folder &folder)
         for (const auto &entry : folder.get_children ())
         {
             if (entry.is_folder ())
-                _process_folder (entry.get_folder ());
+                _process_folder (
+                    entry.get_folder (), implementations, update_status
+                );
 
-            else
+            else if (update_status)
                 processed_files_.fetch_add (1);
         }
     }
@@ -528,7 +904,7 @@ engine::impl::_process_folder (const mobius::core::io::folder &folder)
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Notify implementations that we're exiting a folder
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    for (const auto &impl : implementations_)
+    for (const auto &impl : implementations)
     {
         try
         {
@@ -577,6 +953,30 @@ engine::update ()
     impl_->update ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get number of worker threads
+// @return Number of threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+unsigned int
+engine::get_threads () const
+{
+    return impl_->get_threads ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Set number of worker threads
+// @param threads Number of threads (0 = one per hardware thread)
+//
+// With more than one thread, folders are processed in parallel by
+// thread-safe implementations. Default is one thread (sequential
+// processing).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+engine::set_threads (unsigned int threads)
+{
+    impl_->set_threads (threads);
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Get case item
 // @return Case item
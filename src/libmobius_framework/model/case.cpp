@@ -16,6 +16,7 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <mobius/core/database/database.hpp>
+#include <mobius/core/database/write_queue.hpp>
 #include <mobius/core/exception.inc>
 #include <mobius/core/exception_posix.inc>
 #include <mobius/core/io/path.hpp>
@@ -120,6 +121,25 @@ class Case::impl
     mobius::core::database::database get_database () const;
     bool has_item_by_uid (std::int64_t) const;
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get case write queue
+    // @return Write queue
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    mobius::core::database::write_queue
+    get_write_queue () const
+    {
+        return write_queue_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Switch case database to WAL journal mode
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    enable_wal ()
+    {
+        pool_.enable_wal ();
+    }
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // @brief get root item
     // @return root item
@@ -152,6 +172,9 @@ class Case::impl
 
     // @brief database connection pool
     mobius::core::database::connection_pool pool_;
+
+    // @brief serialized writer queue
+    mobius::core::database::write_queue write_queue_;
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -162,9 +185,19 @@ class Case::impl
 Case::impl::impl (const std::string &path, std::uint32_t uid)
     : uid_ (uid),
       base_dir_ (path),
-      pool_ (join_path (path, "case.sqlite"))
+      pool_ (join_path (path, "case.sqlite")),
+      write_queue_ (pool_)
 
 {
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Keep WAL connection settings for databases already switched to WAL
+    // mode. Other databases keep their journal mode until enable_wal is
+    // called.
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    if (mobius::core::database::database (join_path (path, "case.sqlite"))
+            .is_wal ())
+        pool_.enable_wal ();
+
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Create tables
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -347,6 +380,33 @@ Case::get_database () const
     return impl_->get_database ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get case write queue
+// @return Write queue
+//
+// Tasks submitted to the write queue run in a single writer thread, so
+// threads that write to the case database do not compete for its lock.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::database::write_queue
+Case::get_write_queue () const
+{
+    return impl_->get_write_queue ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Switch case database to WAL journal mode
+//
+// In WAL mode, readers do not block the writer and vice-versa. WAL mode is
+// stored in the database file, so it is kept when the case is reopened.
+// Case databases in WAL mode cannot be opened from read-only media or by
+// sqlite3 versions older than 3.7.0.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+Case::enable_wal ()
+{
+    impl_->enable_wal ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief get item by UID
 // @param uid item UID
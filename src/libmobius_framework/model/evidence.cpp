@@ -20,6 +20,7 @@
 #include <mobius/framework/model/evidence.hpp>
 #include <stdexcept>
 #include <algorithm>
+#include <mutex>
 
 namespace mobius::framework::model
 {
@@ -35,6 +36,7 @@ class evidence::impl
     impl (const impl &) = delete;
     impl (impl &&) = delete;
     impl (item, std::int64_t, const std::string &);
+    impl (item, std::int64_t, const std::string &, evidence::snapshot &&);
 
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // Operators
@@ -109,6 +111,27 @@ class evidence::impl
         return case_.get_database ();
     }
 
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get preloaded data
+    // @return Pointer to snapshot or null, if evidence is not preloaded
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::shared_ptr<const evidence::snapshot>
+    _get_snapshot () const
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        return snapshot_;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Discard preloaded data, after evidence is modified
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    _reset_snapshot ()
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+        snapshot_.reset ();
+    }
+
   private:
     // @brief Case object
     Case case_;
@@ -121,6 +144,12 @@ class evidence::impl
 
     // @brief Evidence type
     const std::string type_;
+
+    // @brief Preloaded data (attributes, tags, sources and hashes)
+    std::shared_ptr<const evidence::snapshot> snapshot_;
+
+    // @brief Mutex protecting snapshot_
+    mutable std::mutex mutex_;
 };
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -137,6 +166,27 @@ evidence::impl::impl (item i, std::int64_t uid, const std::string &type)
 {
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor with preloaded data
+// @param i Item object
+// @param uid Evidence UID
+// @param type Evidence type
+// @param data Evidence data
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+evidence::impl::impl (
+    item i,
+    std::int64_t uid,
+    const std::string &type,
+    evidence::snapshot &&data
+)
+    : case_ (i.get_case ()),
+      item_ (i),
+      uid_ (uid),
+      type_ (type),
+      snapshot_ (std::make_shared<const evidence::snapshot> (std::move (data)))
+{
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Check if attribute exists
 // @param id Attribute ID
@@ -145,6 +195,9 @@ evidence::impl::impl (item i, std::int64_t uid, const std::string &type)
 bool
 evidence::impl::has_attribute (const std::string &id) const
 {
+    if (auto data = _get_snapshot ())
+        return data->attributes.find (id) != data->attributes.end ();
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -168,6 +221,18 @@ evidence::impl::has_attribute (const std::string &id) const
 mobius::core::pod::data
 evidence::impl::get_attribute (const std::string &id) const
 {
+    if (auto data = _get_snapshot ())
+    {
+        auto iter = data->attributes.find (id);
+
+        if (iter == data->attributes.end ())
+            throw std::runtime_error (
+                MOBIUS_EXCEPTION_MSG ("attribute '" + id + "' not found")
+            );
+
+        return iter->second;
+    }
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -198,6 +263,8 @@ evidence::impl::set_attribute (
     const std::string &id, const mobius::core::pod::data &value
 )
 {
+    _reset_snapshot ();
+
     auto db = _get_database ();
     mobius::core::database::statement stmt;
 
@@ -237,6 +304,8 @@ evidence::impl::set_attribute (
 void
 evidence::impl::remove_attribute (const std::string &id)
 {
+    _reset_snapshot ();
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -257,6 +326,9 @@ evidence::impl::remove_attribute (const std::string &id)
 std::map<std::string, mobius::core::pod::data>
 evidence::impl::get_attributes () const
 {
+    if (auto data = _get_snapshot ())
+        return data->attributes;
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -286,6 +358,9 @@ evidence::impl::get_attributes () const
 bool
 evidence::impl::has_tag (const std::string &name) const
 {
+    if (auto data = _get_snapshot ())
+        return data->tags.find (name) != data->tags.end ();
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -308,6 +383,8 @@ evidence::impl::has_tag (const std::string &name) const
 void
 evidence::impl::set_tag (const std::string &name)
 {
+    _reset_snapshot ();
+
     auto db = _get_database ();
 
     mobius::core::database::statement stmt = db.new_statement (
@@ -340,6 +417,8 @@ evidence::impl::set_tags (const std::set<std::string> &tags)
 void
 evidence::impl::reset_tag (const std::string &name)
 {
+    _reset_snapshot ();
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -360,6 +439,9 @@ evidence::impl::reset_tag (const std::string &name)
 std::set<std::string>
 evidence::impl::get_tags () const
 {
+    if (auto data = _get_snapshot ())
+        return data->tags;
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -394,6 +476,8 @@ evidence::impl::add_source (
     const std::string &description
 )
 {
+    _reset_snapshot ();
+
     auto db = _get_database ();
 
     mobius::core::database::statement stmt = db.new_statement (
@@ -416,6 +500,9 @@ evidence::impl::add_source (
 std::vector<evidence::source>
 evidence::impl::get_sources () const
 {
+    if (auto data = _get_snapshot ())
+        return data->sources;
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -449,6 +536,8 @@ evidence::impl::get_sources () const
 void
 evidence::impl::add_hash (const std::string &type, const std::string &value)
 {
+    _reset_snapshot ();
+
     auto db = _get_database ();
 
     mobius::core::database::statement stmt = db.new_statement (
@@ -470,6 +559,8 @@ evidence::impl::add_hash (const std::string &type, const std::string &value)
 void
 evidence::impl::remove_hash (const std::string &type)
 {
+    _reset_snapshot ();
+
     auto db = _get_database ();
 
     mobius::core::database::statement stmt = db.new_statement (
@@ -489,6 +580,8 @@ evidence::impl::remove_hash (const std::string &type)
 void
 evidence::impl::remove_hashes ()
 {
+    _reset_snapshot ();
+
     auto db = _get_database ();
 
     mobius::core::database::statement stmt = db.new_statement (
@@ -508,6 +601,12 @@ evidence::impl::remove_hashes ()
 std::string
 evidence::impl::get_hash (const std::string &type) const
 {
+    if (auto data = _get_snapshot ())
+    {
+        auto iter = data->hashes.find (type);
+        return iter != data->hashes.end () ? iter->second : std::string ();
+    }
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -532,6 +631,9 @@ evidence::impl::get_hash (const std::string &type) const
 std::map<std::string, std::string>
 evidence::impl::get_hashes () const
 {
+    if (auto data = _get_snapshot ())
+        return data->hashes;
+
     auto db = _get_database ();
 
     auto stmt = db.new_statement (
@@ -565,6 +667,23 @@ evidence::evidence (item i, std::int64_t uid, const std::string &type)
 {
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor with preloaded data
+// @param i Item object
+// @param uid Evidence UID
+// @param type Evidence type
+// @param data Evidence data, as loaded from database
+//
+// Getters return preloaded data, without querying the database. Any
+// modification to the evidence discards preloaded data.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+evidence::evidence (
+    item i, std::int64_t uid, const std::string &type, snapshot &&data
+)
+    : impl_ (std::make_shared<impl> (i, uid, type, std::move (data)))
+{
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Get item
 // @return Item
@@ -0,0 +1,219 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <mobius/core/database/database.hpp>
+#include <mobius/core/database/statement.hpp>
+#include <mobius/core/exception.inc>
+#include <mobius/framework/model/case.hpp>
+#include <mobius/framework/model/evidence_loader.hpp>
+#include <stdexcept>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Row kinds, used to sort rows of the same evidence. Evidence row comes
+// first, so evidence type is known before its data rows.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static constexpr std::int64_t ROW_EVIDENCE = 0;
+static constexpr std::int64_t ROW_ATTRIBUTE = 1;
+static constexpr std::int64_t ROW_TAG = 2;
+static constexpr std::int64_t ROW_SOURCE = 3;
+static constexpr std::int64_t ROW_HASH = 4;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Build loader SQL query
+// @param has_type If evidences are filtered by type
+// @return SQL query
+//
+// Each SELECT reads evidences through idx_evidence (item_uid, type), which
+// returns them in (type, uid) order, and joins one table using its
+// (evidence_uid) index. Rows are sorted by (type, uid, kind), so SQLite
+// merges the UNION ALL parts as they are read, without sorting.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::string
+get_sql (bool has_type)
+{
+    const std::string where =
+        has_type ? "WHERE e.item_uid = ?1 AND e.type = ?2 "
+                 : "WHERE e.item_uid = ?1 ";
+
+    return "SELECT e.type, e.uid, 0, NULL, NULL, NULL "
+           "FROM evidence e " +
+           where +
+           "UNION ALL "
+           "SELECT e.type, e.uid, 1, x.id, x.value, NULL "
+           "FROM evidence e "
+           "CROSS JOIN evidence_attribute x ON x.evidence_uid = e.uid " +
+           where +
+           "UNION ALL "
+           "SELECT e.type, e.uid, 2, x.name, NULL, NULL "
+           "FROM evidence e "
+           "CROSS JOIN evidence_tag x ON x.evidence_uid = e.uid " +
+           where +
+           "UNION ALL "
+           "SELECT e.type, e.uid, 3, x.type, x.source_uid, x.description "
+           "FROM evidence e "
+           "CROSS JOIN evidence_source x ON x.evidence_uid = e.uid " +
+           where +
+           "UNION ALL "
+           "SELECT e.type, e.uid, 4, x.type, x.value, NULL "
+           "FROM evidence e "
+           "CROSS JOIN evidence_hash x ON x.evidence_uid = e.uid " +
+           where + "ORDER BY 1, 2, 3";
+}
+
+} // namespace
+
+namespace mobius::framework::model
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Evidence loader implementation class
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class evidence_loader::impl
+{
+  public:
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Constructors
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl (const impl &) = delete;
+    impl (impl &&) = delete;
+    impl (const item &, const std::string &);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Operators
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    impl &operator= (const impl &) = delete;
+    impl &operator= (impl &&) = delete;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Prototypes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    evidence get ();
+
+  private:
+    // @brief Case item
+    item item_;
+
+    // @brief Statement
+    mobius::core::database::statement stmt_;
+
+    // @brief Whether statement has a row not yet consumed
+    bool has_row_ = false;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param i Item object
+// @param type Evidence type (empty for all evidences)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+evidence_loader::impl::impl (const item &i, const std::string &type)
+    : item_ (i)
+{
+    auto db = item_.get_case ().get_database ();
+
+    stmt_ = db.new_statement (get_sql (!type.empty ()));
+    stmt_.bind (1, item_.get_uid ());
+
+    if (!type.empty ())
+        stmt_.bind (2, type);
+
+    has_row_ = stmt_.fetch_row ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get next evidence
+// @return Evidence or invalid evidence, if there are no more evidences
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+evidence
+evidence_loader::impl::get ()
+{
+    if (!has_row_)
+        return {};
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Evidence row
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    if (stmt_.get_column_int64 (2) != ROW_EVIDENCE)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("unexpected row"));
+
+    auto uid = stmt_.get_column_int64 (1);
+    auto type = stmt_.get_column_string (0);
+    evidence::snapshot data;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Data rows
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    while ((has_row_ = stmt_.fetch_row ()) &&
+           stmt_.get_column_int64 (1) == uid)
+    {
+        switch (stmt_.get_column_int64 (2))
+        {
+        case ROW_ATTRIBUTE:
+            data.attributes[stmt_.get_column_string (3)] =
+                stmt_.get_column_pod (4);
+            break;
+
+        case ROW_TAG:
+            data.tags.insert (stmt_.get_column_string (3));
+            break;
+
+        case ROW_SOURCE:
+        {
+            evidence::source s;
+            s.type = static_cast<evidence::source_type> (
+                stmt_.get_column_int64 (3)
+            );
+            s.source_uid = stmt_.get_column_int64 (4);
+            s.description = stmt_.get_column_string (5);
+            data.sources.push_back (s);
+            break;
+        }
+
+        case ROW_HASH:
+            data.hashes[stmt_.get_column_string (3)] =
+                stmt_.get_column_string (4);
+            break;
+
+        default:
+            throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("unexpected row"));
+        }
+    }
+
+    return evidence (item_, uid, type, std::move (data));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Constructor
+// @param i Item object
+// @param type Evidence type (empty for all evidences)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+evidence_loader::evidence_loader (const item &i, const std::string &type)
+    : impl_ (std::make_shared<impl> (i, type))
+{
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get next evidence
+// @return Evidence, with data preloaded, or invalid evidence at the end
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+evidence
+evidence_loader::get ()
+{
+    return impl_->get ();
+}
+
+} // namespace mobius::framework::model
@@ -25,9 +25,11 @@
 #include <mobius/framework/model/case.hpp>
 #include <mobius/framework/model/event.hpp>
 #include <mobius/framework/model/evidence.hpp>
+#include <mobius/framework/model/evidence_builder.hpp>
 #include <mobius/framework/model/item.hpp>
 #include <stdexcept>
 #include <unordered_map>
+#include <variant>
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // Rationale:
@@ -107,6 +109,138 @@ expand_value_mask (const std::string &value_mask,
     return out;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Multi-row INSERT helper
+//
+// Rows are buffered and written BATCH_ROWS at a time, using one multi-row
+// INSERT statement. The full batch statement is prepared only once.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class batch_inserter
+{
+  public:
+    using value_type =
+        std::variant<std::int64_t, std::string, mobius::core::pod::data>;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Constructor
+    // @param db Database object
+    // @param prefix SQL command prefix (e.g. "INSERT INTO t VALUES ")
+    // @param row SQL row placeholders (e.g. "(NULL, ?, ?)")
+    // @param columns Number of placeholders per row
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    batch_inserter (
+        const mobius::core::database::database &db,
+        const std::string &prefix,
+        const std::string &row,
+        std::size_t columns
+    )
+        : db_ (db),
+          prefix_ (prefix),
+          row_ (row),
+          columns_ (columns)
+    {
+        values_.reserve (BATCH_ROWS * columns_);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Add row
+    // @param row Row values
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    add_row (std::initializer_list<value_type> row)
+    {
+        values_.insert (values_.end (), row);
+
+        if (values_.size () >= BATCH_ROWS * columns_)
+        {
+            if (!is_prepared_)
+            {
+                stmt_ = db_.new_statement (_get_sql (BATCH_ROWS));
+                is_prepared_ = true;
+            }
+
+            _execute (stmt_);
+        }
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Write remaining rows
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    flush ()
+    {
+        if (values_.empty ())
+            return;
+
+        auto stmt = db_.new_statement (_get_sql (values_.size () / columns_));
+        _execute (stmt);
+    }
+
+  private:
+    // @brief Rows per INSERT statement
+    static constexpr std::size_t BATCH_ROWS = 64;
+
+    // @brief Database object
+    mobius::core::database::database db_;
+
+    // @brief SQL command prefix
+    const std::string prefix_;
+
+    // @brief SQL row placeholders
+    const std::string row_;
+
+    // @brief Number of columns per row
+    const std::size_t columns_;
+
+    // @brief Full batch statement
+    mobius::core::database::statement stmt_;
+
+    // @brief Flag: stmt_ is prepared
+    bool is_prepared_ = false;
+
+    // @brief Buffered values
+    std::vector<value_type> values_;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Get SQL command for a given number of rows
+    // @param rows Number of rows
+    // @return SQL command
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::string
+    _get_sql (std::size_t rows) const
+    {
+        std::string sql = prefix_;
+        sql.reserve (prefix_.size () + rows * (row_.size () + 1));
+
+        for (std::size_t i = 0; i < rows; i++)
+        {
+            if (i)
+                sql += ',';
+
+            sql += row_;
+        }
+
+        return sql;
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // @brief Bind buffered values and execute statement
+    // @param stmt Statement
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    void
+    _execute (mobius::core::database::statement &stmt)
+    {
+        int idx = 1;
+
+        for (const auto &value : values_)
+            std::visit ([&stmt, &idx] (const auto &v) { stmt.bind (idx++, v); },
+                        value);
+
+        stmt.execute ();
+        values_.clear ();
+    }
+};
+
 } // namespace
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -1362,6 +1496,90 @@ item::new_evidence (const std::string &type)
     return evidence (*this, uid, type);
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create new evidences from evidence builders
+// @param builders Evidence builders
+// @return Evidences created, in the same order as builders
+//
+// All evidences are written in a single transaction. Attributes, tags,
+// sources and hashes are written with multi-row INSERT statements, instead
+// of one query per value.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<evidence>
+item::new_evidences (const std::vector<evidence_builder> &builders)
+{
+    if (!impl_)
+        throw std::runtime_error (MOBIUS_EXCEPTION_MSG ("invalid item"));
+
+    std::vector<evidence> evidences;
+
+    if (builders.empty ())
+        return evidences;
+
+    evidences.reserve (builders.size ());
+
+    auto db = get_database ();
+    auto transaction = db.new_transaction ();
+
+    auto stmt = db.new_statement ("INSERT INTO evidence "
+                                  "VALUES (NULL, ?, ?)");
+
+    batch_inserter attributes (
+        db, "INSERT INTO evidence_attribute VALUES ", "(NULL, ?, ?, ?)", 3
+    );
+
+    batch_inserter tags (
+        db, "INSERT OR IGNORE INTO evidence_tag VALUES ", "(NULL, ?, ?)", 2
+    );
+
+    batch_inserter sources (
+        db, "INSERT INTO evidence_source VALUES ", "(NULL, ?, ?, ?, ?)", 4
+    );
+
+    batch_inserter hashes (
+        db,
+        "INSERT OR REPLACE INTO evidence_hash (evidence_uid, type, value) "
+        "VALUES ",
+        "(?, ?, ?)", 3
+    );
+
+    for (const auto &builder : builders)
+    {
+        auto type = builder.get_type ();
+
+        stmt.bind (1, get_uid ());
+        stmt.bind (2, type);
+        stmt.execute ();
+
+        std::int64_t uid = db.get_last_insert_row_id ();
+
+        for (const auto &[id, value] : builder.get_attributes ())
+            attributes.add_row ({uid, id, value});
+
+        for (const auto &name : builder.get_tags ())
+            tags.add_row ({uid, name});
+
+        for (const auto &s : builder.get_sources ())
+            sources.add_row ({uid, static_cast<std::int64_t> (s.type),
+                              static_cast<std::int64_t> (s.source_uid),
+                              s.description});
+
+        for (const auto &[hash_type, value] : builder.get_hashes ())
+            hashes.add_row ({uid, hash_type, value});
+
+        evidences.emplace_back (*this, uid, type);
+    }
+
+    attributes.flush ();
+    tags.flush ();
+    sources.flush ();
+    hashes.flush ();
+
+    transaction.commit ();
+
+    return evidences;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Add evidence
 // @param e Evidence object
@@ -25,6 +25,7 @@
 #include "cipher.hpp"
 #include "hash.hpp"
 #include "hmac.hpp"
+#include "multi_hash.hpp"
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Function prototypes
@@ -107,6 +108,7 @@ new_core_crypt_module ()
     module.add_type ("cipher", new_core_crypt_cipher_type ());
     module.add_type ("hash", new_core_crypt_hash_type ());
     module.add_type ("hmac", new_core_crypt_hmac_type ());
+    module.add_type ("multi_hash", new_core_crypt_multi_hash_type ());
 
     // Return module
     return module;
@@ -0,0 +1,349 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @file multi_hash.cpp C++ API <i>mobius.core.crypt.multi_hash</i> class wrapper
+// @author Eduardo Aguiar
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "multi_hash.hpp"
+#include "core/io/reader.hpp"
+#include <pygil.hpp>
+#include <pylist.hpp>
+#include <pymobius.hpp>
+#include <mobius/core/exception.inc>
+#include <stdexcept>
+
+namespace
+{
+// @brief Global pointer to hold the heap-allocated type
+static PyTypeObject *core_crypt_multi_hash_type = nullptr;
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_types</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Hash types
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_types (core_crypt_multi_hash_o *self, PyObject *)
+{
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylist_from_cpp_container (
+            self->obj->get_types (), mobius::py::pystring_from_std_string);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>update</i> method implementation
+// @param self object
+// @param args argument list
+// @return Number of bytes hashed
+//
+// Argument can be either a bytes object or a reader. Reader is read until
+// the end of data, using the optional block size argument.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_update (core_crypt_multi_hash_o *self, PyObject *args)
+{
+    // parse input args
+    mobius::core::io::reader arg_reader;
+    mobius::core::bytearray arg_data;
+    std::uint64_t arg_block_size = 65536;
+
+    try
+    {
+        if (mobius::py::check_arg (args, 0, pymobius_core_io_reader_check))
+        {
+            arg_reader = mobius::py::get_arg_as_cpp (
+                args, 0, pymobius_core_io_reader_from_pyobject);
+            arg_block_size =
+                mobius::py::get_arg_as_uint64_t (args, 1, arg_block_size);
+        }
+
+        else
+            arg_data = mobius::py::get_arg_as_bytearray (args, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ code
+    PyObject *ret = nullptr;
+
+    try
+    {
+        std::uint64_t count = 0;
+
+        {
+            mobius::py::GIL GIL;
+
+            if (arg_reader)
+                count = self->obj->update (arg_reader, arg_block_size);
+
+            else
+            {
+                self->obj->update (arg_data);
+                count = arg_data.size ();
+            }
+        }
+
+        ret = mobius::py::pylong_from_std_uint64_t (count);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>reset</i> method implementation
+// @param self Object
+// @param args Argument list
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_reset (core_crypt_multi_hash_o *self, PyObject *)
+{
+    // Execute C++ function
+    try
+    {
+        mobius::py::GIL GIL;
+        self->obj->reset ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+        return nullptr;
+    }
+
+    // return None
+    return mobius::py::pynone ();
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_digest</i> method implementation
+// @param self object
+// @param args argument list
+// @return Digest as bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_digest (core_crypt_multi_hash_o *self, PyObject *args)
+{
+    // parse input args
+    std::string arg_type;
+
+    try
+    {
+        arg_type = mobius::py::get_arg_as_std_string (args, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ code
+    PyObject *ret = nullptr;
+
+    try
+    {
+        mobius::core::bytearray digest;
+
+        {
+            mobius::py::GIL GIL;
+            digest = self->obj->get_digest (arg_type);
+        }
+
+        ret = mobius::py::pybytes_from_bytearray (digest);
+    }
+    catch (const std::invalid_argument &e)
+    {
+        mobius::py::set_value_error (e.what ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_digests</i> method implementation
+// @param self object
+// @param args argument list
+// @return List of (type, digest) tuples
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_digests (core_crypt_multi_hash_o *self, PyObject *)
+{
+    // execute C++ code
+    PyObject *ret = nullptr;
+
+    try
+    {
+        mobius::core::crypt::multi_hash::digest_list_type digests;
+
+        {
+            mobius::py::GIL GIL;
+            digests = self->obj->get_digests ();
+        }
+
+        ret = mobius::py::pylist_from_cpp_pair_container (
+            digests, mobius::py::pystring_from_std_string,
+            mobius::py::pybytes_from_bytearray);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Methods structure
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyMethodDef tp_methods[] = {
+    {(char *) "get_types", (PyCFunction) tp_f_get_types, METH_VARARGS,
+     "Get hash types"},
+    {(char *) "update", (PyCFunction) tp_f_update, METH_VARARGS,
+     "Update hashes with data or reader"},
+    {(char *) "reset", (PyCFunction) tp_f_reset, METH_VARARGS, "Reset hashes"},
+    {(char *) "get_digest", (PyCFunction) tp_f_get_digest, METH_VARARGS,
+     "Get digest for hash type as byte array"},
+    {(char *) "get_digests", (PyCFunction) tp_f_get_digests, METH_VARARGS,
+     "Get (type, digest) pairs for all hash types"},
+    {nullptr, nullptr, 0, nullptr} // sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>multi_hash</i> constructor
+// @param type type object
+// @param args constructor arguments
+// @return new <i>multi_hash</i> object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_new (PyTypeObject *type, PyObject *args, PyObject *)
+{
+    // parse input args
+    std::vector<std::string> arg_types;
+
+    try
+    {
+        arg_types = mobius::py::get_arg_as_cpp_vector (
+            args, 0, mobius::py::pystring_as_std_string);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // create object
+    PyObject *ret = type->tp_alloc (type, 0);
+
+    if (ret)
+    {
+        try
+        {
+            ((core_crypt_multi_hash_o *) ret)->obj =
+                new mobius::core::crypt::multi_hash (arg_types);
+        }
+
+        catch (const std::exception &e)
+        {
+            Py_DECREF (ret);
+            mobius::py::set_runtime_error (e.what ());
+            ret = nullptr;
+        }
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>multi_hash</i> deallocator
+// @param self object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+tp_dealloc (core_crypt_multi_hash_o *self)
+{
+    delete self->obj;
+    Py_TYPE (self)->tp_free ((PyObject *) self);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Type Slots
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyType_Slot core_crypt_multi_hash_slots[] = {
+    {Py_tp_dealloc, reinterpret_cast<void *> (tp_dealloc)},
+    {Py_tp_doc, const_cast<char *> ("Single pass multiple hash calculator class")},
+    {Py_tp_new, reinterpret_cast<void *> (tp_new)},
+    {Py_tp_methods, reinterpret_cast<void *> (tp_methods)},
+    {0, nullptr} // Sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Type specification
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyType_Spec core_crypt_multi_hash_spec = {
+    .name = "mobius.core.crypt.multi_hash",
+    .basicsize = sizeof (core_crypt_multi_hash_o),
+    .itemsize = 0,
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .slots = core_crypt_multi_hash_slots,
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create <i>mobius.core.crypt.multi_hash</i> type
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::py::pytypeobject
+new_core_crypt_multi_hash_type ()
+{
+    // If type is already created, return it
+    if (core_crypt_multi_hash_type)
+        return mobius::py::pytypeobject (core_crypt_multi_hash_type);
+
+    // Allocate type from spec
+    core_crypt_multi_hash_type = reinterpret_cast<PyTypeObject *> (
+        PyType_FromSpec (&core_crypt_multi_hash_spec)
+    );
+
+    // Create type
+    mobius::py::pytypeobject type (core_crypt_multi_hash_type);
+    type.create ();
+
+    return type;
+}
@@ -24,6 +24,7 @@
 #include <pymobius.hpp>
 #include "datasource.hpp"
 #include "extraction.hpp"
+#include "report_parser.hpp"
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Function prototypes
@@ -68,6 +69,9 @@ new_core_datasource_ufdr_module ()
     // Add types
     module.add_type ("datasource", new_core_datasource_ufdr_datasource_type ());
     module.add_type ("extraction", new_core_datasource_ufdr_extraction_type ());
+    module.add_type (
+        "report_parser", new_core_datasource_ufdr_report_parser_type ()
+    );
 
     // Return module
     return module;
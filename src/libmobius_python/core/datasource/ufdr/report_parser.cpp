@@ -0,0 +1,569 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @file report_parser.cc C++ API
+// <i>mobius.core.datasource.ufdr.report_parser</i> class wrapper
+// @author Eduardo Aguiar
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "report_parser.hpp"
+#include <mobius/core/exception.inc>
+#include <pyfunction.hpp>
+#include <pylist.hpp>
+#include <pymobius.hpp>
+#include <pyset.hpp>
+#include <stdexcept>
+#include "core/io/reader.hpp"
+#include "core/pod/map.hpp"
+#include "extraction.hpp"
+
+namespace
+{
+// @brief Global pointer to hold the heap-allocated type
+static PyTypeObject *core_datasource_ufdr_report_parser_type = nullptr;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Get handler function argument
+// @param args Argument list
+// @param idx Argument index
+// @return Python function (null if argument is None)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::py::function
+get_arg_as_function (PyObject *args, std::uint32_t idx)
+{
+    auto arg = mobius::py::get_arg (args, idx);
+
+    if (mobius::py::pynone_check (arg))
+        return {};
+
+    return mobius::py::function (arg);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Convert Python handler return value to C++ bool
+// @param value Python object (new reference)
+// @return true/false
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+handler_result (PyObject *value)
+{
+    int rc = PyObject_IsTrue (value);
+    Py_DECREF (value);
+
+    if (rc == -1)
+        throw std::runtime_error (
+            MOBIUS_EXCEPTION_MSG (mobius::py::get_error_message ())
+        );
+
+    return rc == 1;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create element handler from Python function
+// @param f Python function, called with element full name
+// @return Element handler
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::datasource::ufdr::report_parser::element_handler_type
+new_element_handler (const mobius::py::function &f)
+{
+    if (!f)
+        return {};
+
+    return [func = f] (const std::string &fullname) mutable
+    {
+        PyObject *py_fullname = mobius::py::pystring_from_std_string (fullname);
+        PyObject *rc = nullptr;
+
+        try
+        {
+            rc = func (py_fullname);
+        }
+        catch (...)
+        {
+            Py_DECREF (py_fullname);
+            throw;
+        }
+
+        Py_DECREF (py_fullname);
+        return handler_result (rc);
+    };
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create data handler from Python function
+// @param f Python function, called with data as Python dict
+// @return Data handler
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::datasource::ufdr::report_parser::data_handler_type
+new_data_handler (const mobius::py::function &f)
+{
+    if (!f)
+        return {};
+
+    return [func = f] (const mobius::core::pod::map &data) mutable
+    {
+        PyObject *py_data = pymobius_core_pod_map_to_python (data);
+
+        if (!py_data)
+            throw std::runtime_error (
+                MOBIUS_EXCEPTION_MSG (mobius::py::get_error_message ())
+            );
+
+        PyObject *rc = nullptr;
+
+        try
+        {
+            rc = func (py_data);
+        }
+        catch (...)
+        {
+            Py_DECREF (py_data);
+            throw;
+        }
+
+        Py_DECREF (py_data);
+        return handler_result (rc);
+    };
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>set_element_start_handler</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_set_element_start_handler (
+    core_datasource_ufdr_report_parser_o *self, PyObject *args
+)
+{
+    // Parse input args
+    mobius::py::function arg_f;
+
+    try
+    {
+        arg_f = get_arg_as_function (args, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->set_element_start_handler (new_element_handler (arg_f));
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>set_element_end_handler</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_set_element_end_handler (
+    core_datasource_ufdr_report_parser_o *self, PyObject *args
+)
+{
+    // Parse input args
+    mobius::py::function arg_f;
+
+    try
+    {
+        arg_f = get_arg_as_function (args, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->set_element_end_handler (new_element_handler (arg_f));
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>set_tagged_file_handler</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_set_tagged_file_handler (
+    core_datasource_ufdr_report_parser_o *self, PyObject *args
+)
+{
+    // Parse input args
+    mobius::py::function arg_f;
+
+    try
+    {
+        arg_f = get_arg_as_function (args, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->set_tagged_file_handler (new_data_handler (arg_f));
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>set_model_handler</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_set_model_handler (
+    core_datasource_ufdr_report_parser_o *self, PyObject *args
+)
+{
+    // Parse input args
+    mobius::py::function arg_f;
+
+    try
+    {
+        arg_f = get_arg_as_function (args, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->set_model_handler (new_data_handler (arg_f));
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>run</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_run (core_datasource_ufdr_report_parser_o *self, PyObject *)
+{
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->run ();
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_case_info</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Case info
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_case_info (core_datasource_ufdr_report_parser_o *self, PyObject *)
+{
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = pymobius_core_pod_map_to_pyobject (self->obj->get_case_info ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_extractions</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Extractions
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_extractions (core_datasource_ufdr_report_parser_o *self, PyObject *)
+{
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylist_from_cpp_container (
+            self->obj->get_extractions (),
+            pymobius_core_datasource_ufdr_extraction_to_pyobject
+        );
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_model_count</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Model count
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_model_count (core_datasource_ufdr_report_parser_o *self, PyObject *)
+{
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylong_from_std_int64_t (self->obj->get_model_count ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_unknown_datatypes</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Unknown datatypes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_unknown_datatypes (core_datasource_ufdr_report_parser_o *self, PyObject *)
+{
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pyset_from_cpp_container (
+            self->obj->get_unknown_datatypes (),
+            mobius::py::pystring_from_std_string
+        );
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Methods structure
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyMethodDef tp_methods[] = {
+    {"get_case_info", (PyCFunction) tp_f_get_case_info, METH_VARARGS,
+     "Get case info"},
+    {"get_extractions", (PyCFunction) tp_f_get_extractions, METH_VARARGS,
+     "Get extractions"},
+    {"get_model_count", (PyCFunction) tp_f_get_model_count, METH_VARARGS,
+     "Get model count"},
+    {"get_unknown_datatypes", (PyCFunction) tp_f_get_unknown_datatypes,
+     METH_VARARGS, "Get unknown datatypes"},
+    {"run", (PyCFunction) tp_f_run, METH_VARARGS, "Parse report.xml"},
+    {"set_element_end_handler", (PyCFunction) tp_f_set_element_end_handler,
+     METH_VARARGS, "Set element end handler"},
+    {"set_element_start_handler",
+     (PyCFunction) tp_f_set_element_start_handler, METH_VARARGS,
+     "Set element start handler"},
+    {"set_model_handler", (PyCFunction) tp_f_set_model_handler, METH_VARARGS,
+     "Set model handler"},
+    {"set_tagged_file_handler", (PyCFunction) tp_f_set_tagged_file_handler,
+     METH_VARARGS, "Set tagged file handler"},
+    {nullptr, nullptr, 0, nullptr}, // sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>report_parser</i> Constructor
+// @param type Type object
+// @param args Argument list
+// @param kwds Keywords dict
+// @return new <i>report_parser</i> object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_new (PyTypeObject *type, PyObject *args, PyObject *)
+{
+    // Parse input args
+    mobius::core::io::reader arg_reader;
+
+    try
+    {
+        arg_reader = mobius::py::get_arg_as_cpp (
+            args, 0, pymobius_core_io_reader_from_pyobject
+        );
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Create Python object
+    core_datasource_ufdr_report_parser_o *ret =
+        reinterpret_cast<core_datasource_ufdr_report_parser_o *> (
+            type->tp_alloc (type, 0)
+        );
+
+    if (ret)
+    {
+        try
+        {
+            ret->obj =
+                new mobius::core::datasource::ufdr::report_parser (arg_reader);
+        }
+        catch (const std::exception &e)
+        {
+            Py_DECREF (ret);
+            mobius::py::set_runtime_error (e.what ());
+            ret = nullptr;
+        }
+    }
+
+    return reinterpret_cast<PyObject *> (ret);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>report_parser</i> deallocator
+// @param self Object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+tp_dealloc (core_datasource_ufdr_report_parser_o *self)
+{
+    delete self->obj;
+    Py_TYPE (self)->tp_free ((PyObject *) self);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Type Slots
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyType_Slot core_datasource_ufdr_report_parser_slots[] = {
+    {Py_tp_dealloc, reinterpret_cast<void *> (tp_dealloc)},
+    {Py_tp_doc, const_cast<char *> ("Cellebrite UFDR report.xml parser")},
+    {Py_tp_new, reinterpret_cast<void *> (tp_new)},
+    {Py_tp_methods, reinterpret_cast<void *> (tp_methods)},
+    {0, nullptr} // Sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Type specification
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyType_Spec core_datasource_ufdr_report_parser_spec = {
+    .name = "mobius.core.datasource.ufdr.report_parser",
+    .basicsize = sizeof (core_datasource_ufdr_report_parser_o),
+    .itemsize = 0,
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .slots = core_datasource_ufdr_report_parser_slots,
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create <i>mobius.core.datasource.ufdr.report_parser</i> type
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::py::pytypeobject
+new_core_datasource_ufdr_report_parser_type ()
+{
+    // If type is already created, return it
+    if (core_datasource_ufdr_report_parser_type)
+        return mobius::py::pytypeobject (core_datasource_ufdr_report_parser_type);
+
+    // Allocate type from spec
+    core_datasource_ufdr_report_parser_type = reinterpret_cast<PyTypeObject *> (
+        PyType_FromSpec (&core_datasource_ufdr_report_parser_spec)
+    );
+
+    // Create type
+    mobius::py::pytypeobject type (core_datasource_ufdr_report_parser_type);
+    type.create ();
+
+    return type;
+}
@@ -0,0 +1,315 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @file filetype_engine.cpp C++ API <i>mobius.core.decoder.filetype_engine</i>
+//       class wrapper
+// @author Eduardo Aguiar
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "filetype_engine.hpp"
+#include <mobius/core/exception.inc>
+#include <pygil.hpp>
+#include <pylist.hpp>
+#include <pymobius.hpp>
+#include <stdexcept>
+#include "core/io/file.hpp"
+#include "core/io/folder.hpp"
+#include "core/io/reader.hpp"
+
+namespace
+{
+// @brief Global pointer to hold the heap-allocated type
+static PyTypeObject *core_decoder_filetype_engine_type = nullptr;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create header pattern from Python tuple (offset, bytes)
+// @param py_value Python object
+// @return Header pattern
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::decoder::filetype_engine::pattern
+pattern_from_pyobject (PyObject *py_value)
+{
+    if (!PyTuple_Check (py_value) || PyTuple_Size (py_value) != 2)
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("header pattern must be (offset, bytes)"));
+
+    auto bytes = mobius::py::pybytes_as_bytearray (
+        PyTuple_GetItem (py_value, 1));
+
+    mobius::core::decoder::filetype_engine::pattern p;
+    p.offset = mobius::py::pylong_as_std_int64_t (PyTuple_GetItem (py_value, 0));
+    p.bytes = std::string (bytes.begin (), bytes.end ());
+
+    return p;
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>threads</i> Attribute getter
+// @param self Object
+// @return <i>threads</i> attribute
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_getter_threads (core_decoder_filetype_engine_o *self, void *)
+{
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylong_from_std_uint32_t (self->obj->get_threads ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Getters and setters structure
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyGetSetDef tp_getset[] = {
+    {(char *) "threads", (getter) tp_getter_threads, (setter) 0,
+     (char *) "Number of worker threads", nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr} // sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>add_signature</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_add_signature (core_decoder_filetype_engine_o *self, PyObject *args)
+{
+    // Parse input args
+    mobius::core::decoder::filetype_engine::signature arg_sig;
+
+    try
+    {
+        arg_sig.type = mobius::py::get_arg_as_std_string (args, 0);
+        arg_sig.extension = mobius::py::get_arg_as_std_string (args, 1);
+        arg_sig.header = mobius::py::pylist_to_cpp_container (
+            mobius::py::get_arg (args, 2), pattern_from_pyobject);
+
+        auto footer = mobius::py::get_arg_as_bytearray (args, 3, {});
+        arg_sig.footer = std::string (footer.begin (), footer.end ());
+        arg_sig.max_size = mobius::py::get_arg_as_uint64_t (args, 4, 0);
+        arg_sig.priority = mobius::py::get_arg_as_int (args, 5, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    try
+    {
+        self->obj->add_signature (arg_sig);
+        return mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+        return nullptr;
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>classify</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Filetype, list of filetypes or list of (file, filetype)
+//
+// Argument can be a reader, a file, a list of files or a folder. For
+// folders, a second argument sets whether subfolders are classified too
+// (default = True).
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_classify (core_decoder_filetype_engine_o *self, PyObject *args)
+{
+    PyObject *ret = nullptr;
+
+    try
+    {
+        auto py_arg = mobius::py::get_arg (args, 0);
+
+        if (pymobius_core_io_reader_check (py_arg))
+        {
+            auto reader = pymobius_core_io_reader_from_pyobject (py_arg);
+            ret = mobius::py::pystring_from_std_string (
+                mobius::py::GIL () (self->obj->classify (reader)));
+        }
+
+        else if (pymobius_core_io_file_check (py_arg))
+        {
+            auto f = pymobius_core_io_file_from_pyobject (py_arg);
+            ret = mobius::py::pystring_from_std_string (
+                mobius::py::GIL () (self->obj->classify (f)));
+        }
+
+        else if (pymobius_core_io_folder_check (py_arg))
+        {
+            auto folder = pymobius_core_io_folder_from_pyobject (py_arg);
+            auto recursive = mobius::py::get_arg_as_bool (args, 1, true);
+
+            ret = mobius::py::pylist_from_cpp_pair_container (
+                mobius::py::GIL () (self->obj->classify (folder, recursive)),
+                pymobius_core_io_file_to_pyobject,
+                mobius::py::pystring_from_std_string);
+        }
+
+        else if (PyList_Check (py_arg))
+        {
+            auto files = mobius::py::pylist_to_cpp_container (
+                py_arg, pymobius_core_io_file_from_pyobject);
+
+            ret = mobius::py::pylist_from_cpp_container (
+                mobius::py::GIL () (self->obj->classify (files)),
+                mobius::py::pystring_from_std_string);
+        }
+
+        else
+            mobius::py::set_invalid_type_error (
+                "argument must be reader, file, folder or list of files");
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Methods structure
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyMethodDef tp_methods[] = {
+    {(char *) "add_signature", (PyCFunction) tp_f_add_signature, METH_VARARGS,
+     "Add signature"},
+    {(char *) "classify", (PyCFunction) tp_f_classify, METH_VARARGS,
+     "Get filetype of reader, file, list of files or folder"},
+    {nullptr, nullptr, 0, nullptr} // sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>filetype_engine</i> Constructor
+// @param type Type object
+// @param args Argument list
+// @param kwds Keywords dict
+// @return new <i>filetype_engine</i> object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_new (PyTypeObject *type, PyObject *args, PyObject *)
+{
+    // Parse input args
+    std::uint32_t arg_threads;
+
+    try
+    {
+        arg_threads = mobius::py::get_arg_as_uint32_t (args, 0, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Create Python object
+    core_decoder_filetype_engine_o *ret =
+        reinterpret_cast<core_decoder_filetype_engine_o *> (
+            type->tp_alloc (type, 0)
+        );
+
+    if (ret)
+    {
+        try
+        {
+            ret->obj =
+                new mobius::core::decoder::filetype_engine (arg_threads);
+        }
+        catch (const std::exception &e)
+        {
+            Py_DECREF (ret);
+            mobius::py::set_runtime_error (e.what ());
+            ret = nullptr;
+        }
+    }
+
+    return reinterpret_cast<PyObject *> (ret);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>filetype_engine</i> deallocator
+// @param self Object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+tp_dealloc (core_decoder_filetype_engine_o *self)
+{
+    delete self->obj;
+    Py_TYPE (self)->tp_free ((PyObject *) self);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Type Slots
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyType_Slot core_decoder_filetype_engine_slots[] = {
+    {Py_tp_dealloc, reinterpret_cast<void *> (tp_dealloc)},
+    {Py_tp_doc, const_cast<char *> ("filetype_engine class")},
+    {Py_tp_new, reinterpret_cast<void *> (tp_new)},
+    {Py_tp_methods, reinterpret_cast<void *> (tp_methods)},
+    {Py_tp_getset, reinterpret_cast<void *> (tp_getset)},
+    {0, nullptr} // Sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Type specification
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyType_Spec core_decoder_filetype_engine_spec = {
+    .name = "mobius.core.decoder.filetype_engine",
+    .basicsize = sizeof (core_decoder_filetype_engine_o),
+    .itemsize = 0,
+    .flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+    .slots = core_decoder_filetype_engine_slots,
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create <i>mobius.core.decoder.filetype_engine</i> type
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::py::pytypeobject
+new_core_decoder_filetype_engine_type ()
+{
+    // If type is already created, return it
+    if (core_decoder_filetype_engine_type)
+        return mobius::py::pytypeobject (core_decoder_filetype_engine_type);
+
+    // Allocate type from spec
+    core_decoder_filetype_engine_type = reinterpret_cast<PyTypeObject *> (
+        PyType_FromSpec (&core_decoder_filetype_engine_spec)
+    );
+
+    // Create type
+    mobius::py::pytypeobject type (core_decoder_filetype_engine_type);
+    type.create ();
+
+    return type;
+}
@@ -23,6 +23,7 @@
 #include "module.hpp"
 #include <pymobius.hpp>
 #include "data_decoder.hpp"
+#include "filetype_engine.hpp"
 #include "inifile.hpp"
 #include "lnk.hpp"
 #include "mfc.hpp"
@@ -92,6 +93,8 @@ new_core_decoder_module ()
 
     // Add types
     module.add_type ("data_decoder", new_core_decoder_data_decoder_type ());
+    module.add_type ("filetype_engine",
+                     new_core_decoder_filetype_engine_type ());
     module.add_type ("inifile", new_core_decoder_inifile_type ());
     module.add_type ("lnk", new_core_decoder_lnk_type ());
     module.add_type ("mfc", new_core_decoder_mfc_type ());
@@ -206,6 +206,43 @@ tp_f_read (core_io_reader_o *self, PyObject *args)
     return ret;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Read at method
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_read_at (core_io_reader_o *self, PyObject *args)
+{
+    std::uint64_t arg_offset = 0;
+    std::uint64_t arg_size = 0;
+
+    // parse input args
+    try
+    {
+        arg_offset = mobius::py::get_arg_as_uint64_t (args, 0);
+        arg_size = mobius::py::get_arg_as_uint64_t (args, 1);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ code
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pybytes_from_bytearray (
+            mobius::py::GIL () (self->obj->read_at (arg_offset, arg_size)));
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_io_error (e.what ());
+    }
+
+    return ret;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief tell method
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -363,6 +400,8 @@ tp_f_get_block_size (core_io_reader_o *self, PyObject *)
 static PyMethodDef tp_methods[] = {
     {(char *) "read", (PyCFunction) tp_f_read, METH_VARARGS,
      "Read bytes from reader"},
+    {(char *) "read_at", (PyCFunction) tp_f_read_at, METH_VARARGS,
+     "Read bytes from a given position, without changing read position"},
     {(char *) "tell", (PyCFunction) tp_f_tell, METH_VARARGS,
      "Get current read position"},
     {(char *) "seek", (PyCFunction) tp_f_seek, METH_VARARGS,
@@ -23,7 +23,10 @@
 #include "hashset.hpp"
 #include "core/database/connection.hpp"
 #include "core/database/transaction.hpp"
+#include "core/io/reader.hpp"
+#include "core/io/writer.hpp"
 #include <mobius/core/exception.inc>
+#include <pyfunction.hpp>
 #include <pylist.hpp>
 #include <pymobius.hpp>
 #include <stdexcept>
@@ -320,6 +323,108 @@ tp_f_add (core_kff_hashset_o *self, PyObject *args)
     return mobius::py::pynone ();
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>import_hashes</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Number of hashes added
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_import_hashes (core_kff_hashset_o *self, PyObject *args)
+{
+    // Parse input args
+    mobius::core::io::reader arg_reader;
+    std::string arg_format;
+    std::string arg_hash_type;
+    mobius::py::function arg_progress;
+
+    try
+    {
+        arg_reader = mobius::py::get_arg_as_cpp (
+            args, 0, pymobius_core_io_reader_from_pyobject);
+        arg_format = mobius::py::get_arg_as_std_string (args, 1);
+        arg_hash_type = mobius::py::get_arg_as_std_string (args, 2, {});
+
+        if (mobius::py::get_arg_size (args) > 3 &&
+            !mobius::py::pynone_check (mobius::py::get_arg (args, 3)))
+            arg_progress = mobius::py::function (mobius::py::get_arg (args, 3));
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        mobius::core::kff::hashset::progress_callback_type progress;
+
+        if (arg_progress)
+            progress = [&arg_progress] (std::uint64_t bytes_read,
+                                        std::uint64_t hashes_read)
+            {
+                Py_XDECREF (arg_progress (
+                    mobius::py::pylong_from_std_uint64_t (bytes_read),
+                    mobius::py::pylong_from_std_uint64_t (hashes_read)));
+            };
+
+        ret = mobius::py::pylong_from_std_uint64_t (self->obj->import_hashes (
+            arg_reader, arg_format, arg_hash_type, progress));
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>export_hashes</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Number of hashes written
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_export_hashes (core_kff_hashset_o *self, PyObject *args)
+{
+    // Parse input args
+    mobius::core::io::writer arg_writer;
+    std::string arg_format;
+
+    try
+    {
+        arg_writer = mobius::py::get_arg_as_cpp (
+            args, 0, pymobius_core_io_writer_from_pyobject);
+        arg_format = mobius::py::get_arg_as_std_string (args, 1);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylong_from_std_uint64_t (
+            self->obj->export_hashes (arg_writer, arg_format));
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief <i>remove</i> method implementation
 // @param self Object
@@ -374,6 +479,10 @@ static PyMethodDef tp_methods[] = {
      "Clear hash set"},
     {(char *) "add", (PyCFunction) tp_f_add, METH_VARARGS, "Add hash"},
     {(char *) "remove", (PyCFunction) tp_f_remove, METH_VARARGS, "Remove hash"},
+    {(char *) "import_hashes", (PyCFunction) tp_f_import_hashes, METH_VARARGS,
+     "Import hashes from hash list"},
+    {(char *) "export_hashes", (PyCFunction) tp_f_export_hashes, METH_VARARGS,
+     "Export hashes to hash list"},
     {nullptr, nullptr, 0, nullptr} // sentinel
 };
 
@@ -361,6 +361,47 @@ tp_f_decrypt_with_password_hash (core_os_win_dpapi_master_key_o *self,
     return ret;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>test_password_hash</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return True if password hash decrypts master key
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_test_password_hash (core_os_win_dpapi_master_key_o *self, PyObject *args)
+{
+    // parse input args
+    std::string arg_sid;
+    mobius::core::bytearray arg_password_hash;
+
+    try
+    {
+        arg_sid = mobius::py::get_arg_as_std_string (args, 0);
+        arg_password_hash = mobius::py::get_arg_as_bytearray (args, 1);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pybool_from_bool (
+            mobius::py::GIL () (self->obj->test_password_hash (
+                arg_sid, arg_password_hash)));
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief <i>decrypt_with_password</i> method implementation
 // @param self Object
@@ -439,6 +480,8 @@ static PyMethodDef tp_methods[] = {
      METH_VARARGS, "Decrypt master key using password"},
     {(char *) "is_decrypted", (PyCFunction) tp_f_is_decrypted, METH_VARARGS,
      "Check if master key is decrypted"},
+    {(char *) "test_password_hash", (PyCFunction) tp_f_test_password_hash,
+     METH_VARARGS, "Test password hash, without decrypting master key"},
     {nullptr, nullptr, 0, nullptr} // sentinel
 };
 
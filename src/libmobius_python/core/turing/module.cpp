@@ -21,6 +21,7 @@
 // @author Eduardo Aguiar
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "module.hpp"
+#include "password_engine.hpp"
 #include "turing.hpp"
 #include <pymobius.hpp>
 
@@ -52,6 +53,7 @@ new_core_turing_module ()
     mobius::py::pymodule module (&module_def);
 
     // Add types
+    module.add_type ("password_engine", &core_turing_password_engine_t);
     module.add_type ("turing", &core_turing_turing_t);
 
     // Return module
@@ -0,0 +1,626 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @file password_engine.cpp C++ API <i>mobius.core.turing.password_engine</i>
+//       class wrapper
+// @author Eduardo Aguiar
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include "password_engine.hpp"
+#include "core/io/reader.hpp"
+#include "core/os/win/dpapi/master_key.hpp"
+#include <mobius/core/exception.inc>
+#include <pyfunction.hpp>
+#include <pygil.hpp>
+#include <pymobius.hpp>
+#include <pyobject.hpp>
+#include <stdexcept>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create std::vector <std::string> from Python iterable
+// @param py_value Python object
+// @return C++ vector
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+std::vector<std::string>
+string_vector_from_pyobject (PyObject *py_value)
+{
+    std::vector<std::string> v;
+
+    mobius::py::pyobject iter = PyObject_GetIter (py_value);
+    if (!iter)
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG (mobius::py::get_error_message ()));
+
+    mobius::py::pyobject item = PyIter_Next (iter);
+
+    while (item)
+    {
+        v.push_back (mobius::py::pystring_as_std_string (item));
+        item = PyIter_Next (iter);
+    }
+
+    return v;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create hit callback from Python function
+// @param f Python function, called as f (id, type, password)
+// @return Hit callback
+//
+// Engine runs with the GIL released, so callback reacquires it.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+mobius::core::turing::password_engine::hit_callback_type
+new_hit_callback (const mobius::py::function &f)
+{
+    if (!f)
+        return {};
+
+    return [func = f] (
+               const mobius::core::turing::password_engine::hit &hit) mutable
+    {
+        mobius::py::GIL_guard gil_guard;
+
+        mobius::py::pyobject py_id =
+            mobius::py::pystring_from_std_string (hit.id);
+        mobius::py::pyobject py_type =
+            mobius::py::pystring_from_std_string (hit.type);
+        mobius::py::pyobject py_password =
+            mobius::py::pystring_from_std_string (hit.password);
+
+        mobius::py::pyobject rc =
+            func (static_cast<PyObject *> (py_id),
+                  static_cast<PyObject *> (py_type),
+                  static_cast<PyObject *> (py_password));
+    };
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>threads</i> Attribute getter
+// @param self Object
+// @return <i>threads</i> attribute
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_getter_threads (core_turing_password_engine_o *self, void *)
+{
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylong_from_std_uint32_t (self->obj->get_threads ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>target_count</i> Attribute getter
+// @param self Object
+// @return <i>target_count</i> attribute
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_getter_target_count (core_turing_password_engine_o *self, void *)
+{
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylong_from_std_uint64_t (
+            self->obj->get_target_count ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>pending_count</i> Attribute getter
+// @param self Object
+// @return <i>pending_count</i> attribute
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_getter_pending_count (core_turing_password_engine_o *self, void *)
+{
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylong_from_std_uint64_t (
+            self->obj->get_pending_count ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>word_count</i> Attribute getter
+// @param self Object
+// @return <i>word_count</i> attribute
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_getter_word_count (core_turing_password_engine_o *self, void *)
+{
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret =
+            mobius::py::pylong_from_std_uint64_t (self->obj->get_word_count ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>words_per_second</i> Attribute getter
+// @param self Object
+// @return <i>words_per_second</i> attribute
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_getter_words_per_second (core_turing_password_engine_o *self, void *)
+{
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pyfloat_from_cpp (self->obj->get_words_per_second ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Getters and setters structure
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyGetSetDef tp_getset[] = {
+    {(char *) "threads", (getter) tp_getter_threads, nullptr,
+     (char *) "Number of worker threads", nullptr},
+    {(char *) "target_count", (getter) tp_getter_target_count, nullptr,
+     (char *) "Number of targets", nullptr},
+    {(char *) "pending_count", (getter) tp_getter_pending_count, nullptr,
+     (char *) "Number of targets whose password has not been found", nullptr},
+    {(char *) "word_count", (getter) tp_getter_word_count, nullptr,
+     (char *) "Number of candidate passwords tested", nullptr},
+    {(char *) "words_per_second", (getter) tp_getter_words_per_second, nullptr,
+     (char *) "Average number of candidate passwords tested per second",
+     nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr} // sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>add_hash</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_add_hash (core_turing_password_engine_o *self, PyObject *args)
+{
+    // parse input args
+    std::string arg_id;
+    std::string arg_type;
+    mobius::core::bytearray arg_value;
+    std::string arg_username;
+    std::uint32_t arg_iterations;
+
+    try
+    {
+        arg_id = mobius::py::get_arg_as_std_string (args, 0);
+        arg_type = mobius::py::get_arg_as_std_string (args, 1);
+        arg_value = mobius::py::get_arg_as_bytearray (args, 2);
+        arg_username = mobius::py::get_arg_as_std_string (args, 3, {});
+        arg_iterations = mobius::py::get_arg_as_uint32_t (args, 4, 10240);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->add_hash (arg_id, arg_type, arg_value, arg_username,
+                             arg_iterations);
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>add_master_key</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_add_master_key (core_turing_password_engine_o *self, PyObject *args)
+{
+    // parse input args
+    std::string arg_id;
+    mobius::core::os::win::dpapi::master_key arg_mk;
+    std::string arg_sid;
+
+    try
+    {
+        arg_id = mobius::py::get_arg_as_std_string (args, 0);
+        arg_mk = mobius::py::get_arg_as_cpp (
+            args, 1, pymobius_core_os_win_dpapi_master_key_from_pyobject);
+        arg_sid = mobius::py::get_arg_as_std_string (args, 2);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->add_master_key (arg_id, arg_mk, arg_sid);
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>set_hit_callback</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+//
+// Callback is called as f (id, type, password). None removes callback.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_set_hit_callback (core_turing_password_engine_o *self, PyObject *args)
+{
+    // parse input args
+    mobius::py::function arg_f;
+
+    try
+    {
+        auto arg = mobius::py::get_arg (args, 0);
+
+        if (!mobius::py::pynone_check (arg))
+            arg_f = mobius::py::function (arg);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->set_hit_callback (new_hit_callback (arg_f));
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>set_batch_size</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_set_batch_size (core_turing_password_engine_o *self, PyObject *args)
+{
+    // parse input args
+    std::uint32_t arg_size;
+
+    try
+    {
+        arg_size = mobius::py::get_arg_as_uint32_t (args, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        self->obj->set_batch_size (arg_size);
+        ret = mobius::py::pynone ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>test</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Number of hits
+//
+// Argument can be either a reader (wordlist, one password per line) or an
+// iterable of strings.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_test (core_turing_password_engine_o *self, PyObject *args)
+{
+    // parse input args
+    mobius::core::io::reader arg_reader;
+    std::vector<std::string> arg_words;
+    std::string arg_encoding;
+
+    try
+    {
+        auto arg = mobius::py::get_arg (args, 0);
+
+        if (pymobius_core_io_reader_check (arg))
+        {
+            arg_reader = pymobius_core_io_reader_from_pyobject (arg);
+            arg_encoding = mobius::py::get_arg_as_std_string (args, 1, "UTF-8");
+        }
+
+        else
+            arg_words = string_vector_from_pyobject (arg);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        std::uint64_t count = 0;
+
+        {
+            mobius::py::GIL gil;
+
+            if (arg_reader)
+                count = self->obj->test (arg_reader, arg_encoding);
+
+            else
+                count = self->obj->test (arg_words);
+        }
+
+        ret = mobius::py::pylong_from_std_uint64_t (count);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>benchmark</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Words per second
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_benchmark (core_turing_password_engine_o *self, PyObject *args)
+{
+    // parse input args
+    std::uint64_t arg_count;
+
+    try
+    {
+        arg_count = mobius::py::get_arg_as_uint64_t (args, 0, 10000);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pyfloat_from_cpp (
+            mobius::py::GIL () (self->obj->benchmark (arg_count)));
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Methods structure
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyMethodDef tp_methods[] = {
+    {(char *) "add_hash", (PyCFunction) tp_f_add_hash, METH_VARARGS,
+     "Add password hash"},
+    {(char *) "add_master_key", (PyCFunction) tp_f_add_master_key,
+     METH_VARARGS, "Add DPAPI master key"},
+    {(char *) "set_hit_callback", (PyCFunction) tp_f_set_hit_callback,
+     METH_VARARGS, "Set function called when a password is found"},
+    {(char *) "set_batch_size", (PyCFunction) tp_f_set_batch_size,
+     METH_VARARGS, "Set number of candidate passwords per batch"},
+    {(char *) "test", (PyCFunction) tp_f_test, METH_VARARGS,
+     "Test candidate passwords"},
+    {(char *) "benchmark", (PyCFunction) tp_f_benchmark, METH_VARARGS,
+     "Measure test throughput, in words per second"},
+    {nullptr, nullptr, 0, nullptr} // sentinel
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>password_engine</i> constructor
+// @param type type object
+// @param args argument list
+// @param kwds keywords dict
+// @return new <i>password_engine</i> object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_new (PyTypeObject *type, PyObject *args, PyObject *)
+{
+    // parse input args
+    std::uint32_t arg_threads;
+
+    try
+    {
+        arg_threads = mobius::py::get_arg_as_uint32_t (args, 0, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // create object
+    core_turing_password_engine_o *self =
+        (core_turing_password_engine_o *) type->tp_alloc (type, 0);
+
+    if (self)
+    {
+        try
+        {
+            self->obj =
+                new mobius::core::turing::password_engine (arg_threads);
+        }
+        catch (const std::exception &e)
+        {
+            mobius::py::set_runtime_error (e.what ());
+            Py_TYPE (self)->tp_free ((PyObject *) self);
+            self = nullptr;
+        }
+    }
+
+    return (PyObject *) self;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>password_engine</i> deallocator
+// @param self object
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static void
+tp_dealloc (core_turing_password_engine_o *self)
+{
+    delete self->obj;
+    Py_TYPE (self)->tp_free ((PyObject *) self);
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Type structure
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+PyTypeObject core_turing_password_engine_t = {
+    PyVarObject_HEAD_INIT (nullptr, 0)         // header
+    "mobius.core.turing.password_engine",      // tp_name
+    sizeof (core_turing_password_engine_o),    // tp_basicsize
+    0,                                         // tp_itemsize
+    (destructor) tp_dealloc,                   // tp_dealloc
+    0,                                         // tp_print
+    0,                                         // tp_getattr
+    0,                                         // tp_setattr
+    0,                                         // tp_compare
+    0,                                         // tp_repr
+    0,                                         // tp_as_number
+    0,                                         // tp_as_sequence
+    0,                                         // tp_as_mapping
+    0,                                         // tp_hash
+    0,                                         // tp_call
+    0,                                         // tp_str
+    0,                                         // tp_getattro
+    0,                                         // tp_setattro
+    0,                                         // tp_as_buffer
+    Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,  // tp_flags
+    "Password testing engine",                 // tp_doc
+    0,                                         // tp_traverse
+    0,                                         // tp_clear
+    0,                                         // tp_richcompare
+    0,                                         // tp_weaklistoffset
+    0,                                         // tp_iter
+    0,                                         // tp_iternext
+    tp_methods,                                // tp_methods
+    0,                                         // tp_members
+    tp_getset,                                 // tp_getset
+    0,                                         // tp_base
+    0,                                         // tp_dict
+    0,                                         // tp_descr_get
+    0,                                         // tp_descr_set
+    0,                                         // tp_dictoffset
+    0,                                         // tp_init
+    0,                                         // tp_alloc
+    tp_new,                                    // tp_new
+    0,                                         // tp_free
+    0,                                         // tp_is_gc
+    0,                                         // tp_bases
+    0,                                         // tp_mro
+    0,                                         // tp_cache
+    0,                                         // tp_subclasses
+    0,                                         // tp_weaklist
+    0,                                         // tp_del
+    0,                                         // tp_version_tag
+    0,                                         // tp_finalize
+};
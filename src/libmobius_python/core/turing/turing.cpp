@@ -23,8 +23,13 @@
 #include "turing.hpp"
 #include "core/database/transaction.hpp"
 #include "module.hpp"
+#include <mobius/core/exception.inc>
+#include <pygil.hpp>
 #include <pylist.hpp>
 #include <pymobius.hpp>
+#include <pyobject.hpp>
+#include <stdexcept>
+#include <tuple>
 
 namespace
 {
@@ -49,6 +54,68 @@ PyTuple_from_hash (const std::tuple<std::string, std::string, std::string> &row)
     return ret;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create C++ tuple from Python sequence (type, value, password)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::tuple<std::string, std::string, std::string>
+hash_from_pyobject (PyObject *obj)
+{
+    if (!PySequence_Check (obj) || PySequence_Size (obj) != 3)
+        throw std::invalid_argument (MOBIUS_EXCEPTION_MSG (
+            "hash must be a (type, value, password) tuple"));
+
+    mobius::py::pyobject hash_type (PySequence_GetItem (obj, 0));
+    mobius::py::pyobject hash_value (PySequence_GetItem (obj, 1));
+    mobius::py::pyobject password (PySequence_GetItem (obj, 2));
+
+    return std::make_tuple (
+        mobius::py::pystring_as_std_string (hash_type),
+        mobius::py::pystring_as_std_string (hash_value),
+        mobius::py::pystring_as_std_string (password));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create C++ pair from Python sequence (type, value)
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static std::pair<std::string, std::string>
+hash_key_from_pyobject (PyObject *obj)
+{
+    if (!PySequence_Check (obj) || PySequence_Size (obj) != 2)
+        throw std::invalid_argument (
+            MOBIUS_EXCEPTION_MSG ("hash must be a (type, value) tuple"));
+
+    mobius::py::pyobject hash_type (PySequence_GetItem (obj, 0));
+    mobius::py::pyobject hash_value (PySequence_GetItem (obj, 1));
+
+    return std::make_pair (mobius::py::pystring_as_std_string (hash_type),
+                           mobius::py::pystring_as_std_string (hash_value));
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief Create Python tuple from (status, password) pair
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+PyTuple_from_hash_password (
+    const std::pair<mobius::core::turing::turing::pwd_status, std::string> &p)
+{
+    PyObject *ret = PyTuple_New (2);
+
+    if (ret)
+    {
+        PyTuple_SetItem (
+            ret, 0, mobius::py::pylong_from_int (static_cast<int> (p.first)));
+
+        if (p.first == mobius::core::turing::turing::pwd_status::not_found)
+            PyTuple_SetItem (ret, 1, mobius::py::pynone ());
+
+        else
+            PyTuple_SetItem (ret, 1,
+                             mobius::py::pystring_from_std_string (p.second));
+    }
+
+    return ret;
+}
+
 } // namespace
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -182,22 +249,95 @@ tp_f_get_hash_password (core_turing_turing_o *self, PyObject *args)
 
     try
     {
-        auto p = self->obj->get_hash_password (arg_type, arg_value);
-        ret = PyTuple_New (2);
+        ret = PyTuple_from_hash_password (
+            self->obj->get_hash_password (arg_type, arg_value));
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
 
-        if (ret)
-        {
-            PyTuple_SetItem (
-                ret, 0,
-                mobius::py::pylong_from_int (static_cast<int> (p.first)));
+    // return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>set_hashes</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Number of hashes inserted
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_set_hashes (core_turing_turing_o *self, PyObject *args)
+{
+    // parse input args
+    mobius::core::turing::turing::hashlist_type arg_hashes;
+
+    try
+    {
+        arg_hashes =
+            mobius::py::get_arg_as_cpp_vector (args, 0, hash_from_pyobject);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
 
-            if (p.first == mobius::core::turing::turing::pwd_status::not_found)
-                PyTuple_SetItem (ret, 1, mobius::py::pynone ());
+    try
+    {
+        std::uint64_t count = 0;
 
-            else
-                PyTuple_SetItem (
-                    ret, 1, mobius::py::pystring_from_std_string (p.second));
+        {
+            mobius::py::GIL gil;
+            count = self->obj->set_hashes (arg_hashes);
         }
+
+        ret = mobius::py::pylong_from_std_uint64_t (count);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_hash_passwords</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return List of (status, password), in the same order as the hashes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_hash_passwords (core_turing_turing_o *self, PyObject *args)
+{
+    // parse input args
+    mobius::core::turing::turing::hashkeys_type arg_keys;
+
+    try
+    {
+        arg_keys =
+            mobius::py::get_arg_as_cpp_vector (args, 0, hash_key_from_pyobject);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylist_from_cpp_container (
+            self->obj->get_hash_passwords (arg_keys),
+            PyTuple_from_hash_password);
     }
     catch (const std::exception &e)
     {
@@ -289,8 +429,12 @@ static PyMethodDef tp_methods[] = {
      "Check if hash is set"},
     {(char *) "set_hash", (PyCFunction) tp_f_set_hash, METH_VARARGS,
      "Set hash type, value and password"},
+    {(char *) "set_hashes", (PyCFunction) tp_f_set_hashes, METH_VARARGS,
+     "Set many hashes at once, from a list of (type, value, password)"},
     {(char *) "get_hash_password", (PyCFunction) tp_f_get_hash_password,
      METH_VARARGS, "Get password for a given hash"},
+    {(char *) "get_hash_passwords", (PyCFunction) tp_f_get_hash_passwords,
+     METH_VARARGS, "Get passwords for a list of (type, value) hashes"},
     {(char *) "remove_hashes", (PyCFunction) tp_f_remove_hashes, METH_VARARGS,
      "Remove all hashes from database"},
     {(char *) "get_hashes", (PyCFunction) tp_f_get_hashes, METH_VARARGS,
@@ -162,6 +162,68 @@ tp_f_get_status (framework_evidence_processor_engine_o *self, PyObject *)
     return ret;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>get_threads</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return Number of worker threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_get_threads (framework_evidence_processor_engine_o *self, PyObject *)
+{
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        ret = mobius::py::pylong_from_std_uint32_t (self->obj->get_threads ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    // Return value
+    return ret;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>set_threads</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_set_threads (framework_evidence_processor_engine_o *self, PyObject *args)
+{
+    // Parse input args
+    std::uint32_t arg_threads;
+
+    try
+    {
+        arg_threads = mobius::py::get_arg_as_uint32_t (args, 0);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    try
+    {
+        self->obj->set_threads (arg_threads);
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+        return nullptr;
+    }
+
+    // return None
+    return mobius::py::pynone ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief Methods structure
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -173,6 +235,10 @@ static PyMethodDef tp_methods[] = {
      "Get case profile"},
     {"get_status", (PyCFunction) tp_f_get_status, METH_VARARGS,
      "Get current status"},
+    {"get_threads", (PyCFunction) tp_f_get_threads, METH_VARARGS,
+     "Get number of worker threads"},
+    {"set_threads", (PyCFunction) tp_f_set_threads, METH_VARARGS,
+     "Set number of worker threads (0 = one per hardware thread)"},
     {nullptr, nullptr, 0, nullptr}, // sentinel
 };
 
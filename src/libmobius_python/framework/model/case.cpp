@@ -222,6 +222,30 @@ tp_f_new_transaction (framework_model_case_o *self, PyObject *)
     return ret;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>enable_wal</i> method implementation
+// @param self object
+// @param args argument list
+// @return None
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_enable_wal (framework_model_case_o *self, PyObject *)
+{
+    // execute C++ function
+    try
+    {
+        self->obj->enable_wal ();
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_runtime_error (e.what ());
+        return nullptr;
+    }
+
+    // return None
+    return mobius::py::pynone ();
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief <i>get_item_by_uid</i> method implementation
 // @param self object
@@ -323,6 +347,8 @@ static PyMethodDef tp_methods[] = {
      "create new connection to case database"},
     {(char *) "new_transaction", (PyCFunction) tp_f_new_transaction,
      METH_VARARGS, "create new transaction for case database"},
+    {(char *) "enable_wal", (PyCFunction) tp_f_enable_wal, METH_VARARGS,
+     "switch case database to WAL journal mode"},
     {(char *) "get_item_by_uid", (PyCFunction) tp_f_get_item_by_uid,
      METH_VARARGS, "get item by UID"},
     {(char *) "get_passwords", (PyCFunction) tp_f_get_passwords, METH_VARARGS,
@@ -21,6 +21,7 @@
 // @author Eduardo Aguiar
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include "item.hpp"
+#include <mobius/framework/model/evidence_loader.hpp>
 #include <functional>
 #include <pycallback.hpp>
 #include <pydict.hpp>
@@ -998,6 +999,65 @@ tp_f_get_evidences (framework_model_item_o *self, PyObject *args)
     return ret;
 }
 
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// @brief <i>load_evidences</i> method implementation
+// @param self Object
+// @param args Argument list
+// @return List of evidences, with attributes, tags, sources and hashes
+// already loaded
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+static PyObject *
+tp_f_load_evidences (framework_model_item_o *self, PyObject *args)
+{
+    // Parse input args
+    std::string arg_type;
+
+    try
+    {
+        arg_type = mobius::py::get_arg_as_std_string (args, 0, std::string ());
+    }
+    catch (const std::exception &e)
+    {
+        mobius::py::set_invalid_type_error (e.what ());
+        return nullptr;
+    }
+
+    // Execute C++ function
+    PyObject *ret = nullptr;
+
+    try
+    {
+        mobius::framework::model::evidence_loader loader (*self->obj, arg_type);
+        ret = PyList_New (0);
+
+        while (ret)
+        {
+            auto e = loader.get ();
+
+            if (!e)
+                break;
+
+            PyObject *py_e = pymobius_framework_model_evidence_to_pyobject (e);
+
+            if (!py_e)
+                Py_CLEAR (ret);
+
+            else
+            {
+                PyList_Append (ret, py_e);
+                Py_DECREF (py_e);
+            }
+        }
+    }
+    catch (const std::exception &e)
+    {
+        Py_CLEAR (ret);
+        mobius::py::set_runtime_error (e.what ());
+    }
+
+    return ret;
+}
+
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 // @brief <i>remove_evidences</i> method implementation
 // @param self Object
@@ -1275,6 +1335,8 @@ static PyMethodDef tp_methods[] = {
      "Add evidence"},
     {"get_evidences", (PyCFunction) tp_f_get_evidences, METH_VARARGS,
      "Get evidences by type"},
+    {"load_evidences", (PyCFunction) tp_f_load_evidences, METH_VARARGS,
+     "Load evidences by type, with their data, using a single query"},
     {"remove_evidences", (PyCFunction) tp_f_remove_evidences, METH_VARARGS,
      "Remove evidences of a given type"},
     {"count_evidences", (PyCFunction) tp_f_count_evidences, METH_VARARGS,
@@ -168,16 +168,12 @@ def set_handled(item, f):
         return
 
     # calculate hash sha2-512
-    h = mobius.core.crypt.hash('sha2-512')
-    data = reader.read(65536)
-
-    while data:
-        h.update(data)
-        data = reader.read(65536)
+    h = mobius.core.crypt.multi_hash(['sha2-512'])
+    h.update(reader)
 
     # add to kff file
     case = item.case
     path = case.create_path(f'hashset/{item.uid:04d}-handled.ignore')
     fp = open(path, 'a')
-    fp.write(f'{h.get_hex_digest()}\n')
+    fp.write(f'{h.get_digest("sha2-512").hex()}\n')
     fp.close()
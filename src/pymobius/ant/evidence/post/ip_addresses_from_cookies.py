@@ -55,7 +55,7 @@ class Ant(object):
     # @brief Retrieve data from cookies
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def __retrieve_cookies(self):
-        for c in self.__item.get_evidences('cookie'):
+        for c in self.__item.load_evidences('cookie'):
             if not c.is_encrypted and c.last_update_time:
                 self.__retrieve_cookie(c)
 
@@ -123,7 +123,7 @@ class Ant(object):
     def __retrieve_browser_history(self):
 
         # retrieve data
-        for h in self.__item.get_evidences('visited-url'):
+        for h in self.__item.load_evidences('visited-url'):
             uri = mobius.core.io.uri(h.url)
             host = uri.get_host()
 
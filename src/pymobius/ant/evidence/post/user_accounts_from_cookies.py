@@ -117,7 +117,7 @@ class Ant(object):
     # @brief Retrieve data from cookies
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def __retrieve_cookies(self):
-        for c in self.__item.get_evidences('cookie'):
+        for c in self.__item.load_evidences('cookie'):
             if not c.is_encrypted:
                 self.__retrieve_cookie(c)
 
@@ -67,7 +67,7 @@ class Ant(object):
                 ant.run()
 
             # retrieve data
-            for p in self.__item.get_evidences(pymobius.ant.turing.PASSWORD_EVIDENCE_TYPE):
+            for p in self.__item.load_evidences(pymobius.ant.turing.PASSWORD_EVIDENCE_TYPE):
                 self.__retrieve_password(p)
 
         except Exception as e:
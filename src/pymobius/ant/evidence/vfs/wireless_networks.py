@@ -84,7 +84,7 @@ class Ant(object):
     # @brief Retrieve DPAPI encryption keys
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def __retrieve_dpapi_encryption_keys(self):
-        for key in self.__item.get_evidences('encryption-key'):
+        for key in self.__item.load_evidences('encryption-key'):
             if key.key_type == 'dpapi.sys':
                 self.__dpapi_master_keys[key.id] = key.value
 
@@ -278,24 +278,53 @@ class Ant(object):
     # @brief Test password
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def test_password(self, value):
-        if isinstance(value, bytes):
-            mobius.core.logf('WRN bytes password %s' % '\n'.join(traceback.format_stack()))
+        self.test_passwords([value])
 
-        if value in self.__unique_passwords:
-            return
+    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    # @brief Test passwords
+    # @param values Password values
+    #
+    # Ants implementing on_test_passwords receive all new passwords at once,
+    # so they can test them in batch. Other ants receive one password at a
+    # time, through on_test_password.
+    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    def test_passwords(self, values):
+        passwords = []
+
+        for value in values:
+            if isinstance(value, bytes):
+                mobius.core.logf('WRN bytes password %s' % '\n'.join(traceback.format_stack()))
 
-        self.__unique_passwords.add(value)
+            if value not in self.__unique_passwords:
+                self.__unique_passwords.add(value)
+                passwords.append(value)
+
+        if not passwords:
+            return
 
         for ant in self.__ants:
-            try:
-                f = getattr(ant, 'on_test_password', None)
+            f = getattr(ant, 'on_test_passwords', None)
 
-                if f:
-                    mobius.core.logf(f'DBG ant.on_test_password started <{value}> {ant.name}')
-                    f(self, value)
-                    mobius.core.logf(f'DBG ant.on_test_password ended <{value}> {ant.name}')
-            except Exception as e:
-                mobius.core.logf('WRN (%s.on_test_password) %s %s' % (ant.name, str(e), traceback.format_exc()))
+            if f:
+                try:
+                    mobius.core.logf(f'DBG ant.on_test_passwords started <{len(passwords):d}> {ant.name}')
+                    f(self, passwords)
+                    mobius.core.logf(f'DBG ant.on_test_passwords ended <{len(passwords):d}> {ant.name}')
+                except Exception as e:
+                    mobius.core.logf('WRN (%s.on_test_passwords) %s %s' % (ant.name, str(e), traceback.format_exc()))
+
+                continue
+
+            f = getattr(ant, 'on_test_password', None)
+
+            if f:
+                for value in passwords:
+                    try:
+                        mobius.core.logf(f'DBG ant.on_test_password started <{value}> {ant.name}')
+                        f(self, value)
+                        mobius.core.logf(f'DBG ant.on_test_password ended <{value}> {ant.name}')
+                    except Exception as e:
+                        mobius.core.logf('WRN (%s.on_test_password) %s %s' % (ant.name, str(e), traceback.format_exc()))
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Add hash to model
@@ -18,6 +18,7 @@
 import traceback
 import mobius
 import mobius.core.os
+import mobius.core.turing
 import pymobius.operating_system
 
 
@@ -42,12 +43,19 @@ class Ant(object):
     def run(self):
         self.__secrets = []
         self.__unique_hashes = set()
+        self.__hits = []
 
         try:
             self.__retrieve_dpapi_user_master_keys()
         except Exception as e:
             mobius.core.logf(f'WRN {str(e)}\n{traceback.format_exc()}')
 
+        self.__engine = mobius.core.turing.password_engine()
+        self.__engine.set_hit_callback(self.__on_hit)
+
+        for i, secret in enumerate(self.__secrets):
+            self.__engine.add_master_key(str(i), secret.mk, secret.sid)
+
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Event <i>on_export_data</i>: Export data to mediator ant
     # @param ant Mediator ant object
@@ -65,17 +73,32 @@ class Ant(object):
         mobius.core.logf(f'INF {count:d}/{len(self.__secrets):d} user master key(s) decrypted')
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Event <i>on_test_password</i>: Process password object
+    # @brief Event <i>on_test_passwords</i>: Test passwords in batch
     # @param ant Mediator ant object
-    # @param password Password value
+    # @param passwords Password values
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def on_test_password(self, ant, password):
-        for secret in self.__secrets:
-            mk = secret.mk
+    def on_test_passwords(self, ant, passwords):
+        passwords = [p for p in passwords if isinstance(p, str)]
 
-            if not mk.is_decrypted() and mk.decrypt_with_password(secret.sid, password):
-                key = self.__create_key(secret)
-                ant.add_key(key)
+        if not passwords or not self.__engine.pending_count:
+            return
+
+        self.__hits = []
+        self.__engine.test(passwords)
+        hits, self.__hits = self.__hits, []
+
+        for idx in hits:
+            key = self.__create_key(self.__secrets[idx])
+            ant.add_key(key)
+
+    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    # @brief Handle password engine hit
+    # @param target_id Target ID
+    # @param target_type Target type
+    # @param password Password found
+    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    def __on_hit(self, target_id, target_type, password):
+        self.__hits.append(int(target_id))
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Event <i>on_hash</i>: Process hash object
@@ -52,8 +52,7 @@ class Ant(object):
     # @param ant Mediator ant object
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def on_export_data(self, ant):
-        for password in set(self.__passwords):
-            ant.test_password(password)
+        ant.test_passwords(set(self.__passwords))
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Event <i>on_stop</i>: Terminate this ant
@@ -21,6 +21,11 @@ import mobius.core.os
 import mobius.core.turing
 import pymobius
 
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+# Hash types supported by password engine
+# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+HASH_TYPES = {'nt', 'lm', 'msdcc1', 'msdcc2', 'sha1.utf16'}
+
 
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 # @brief Test passwords for hashes found
@@ -36,6 +41,8 @@ class Ant(object):
         self.version = '1.0'
         self.__item = item
         self.__turing = None
+        self.__engine = None
+        self.__hits = []
         self.__count = 0
         self.__password_count = 0
         self.__hashes = []
@@ -46,6 +53,8 @@ class Ant(object):
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def run(self):
         self.__turing = mobius.core.turing.turing()
+        self.__engine = mobius.core.turing.password_engine()
+        self.__engine.set_hit_callback(self.__on_hit)
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Event <i>on_export_data</i>: Export data to mediator ant
@@ -60,6 +69,7 @@ class Ant(object):
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def on_stop(self, ant):
         mobius.core.logf(f'INF ant.turing: {self.__password_count:d}/{self.__count:d} password(s) found for hashes')
+        mobius.core.logf(f'DBG ant.turing: {self.__engine.word_count:d} password(s) tested at {self.__engine.words_per_second:.0f} words/s')
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Event <i>on_hash</i>: Process hash object
@@ -68,29 +78,31 @@ class Ant(object):
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def on_hash(self, ant, h):
         if h.password is None:
-            p = self.__test_hash(h)
+            p = self.__test_database(h)
 
             if p:
                 ant.add_password(p)
 
-            else:
-                self.__hashes.append(h)
-
-            self.__count += 1
+            elif h.type in HASH_TYPES:
+                attrs = dict(h.metadata)
+                username = attrs.get('username') or ''
+                iterations = int(attrs.get('iterations', 10240))
 
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Test hash passwords
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __test_hash(self, h):
-        p = None
+                hash_id = str(len(self.__hashes))
+                self.__hashes.append(h)
 
-        if h.password is None:
-            p = self.__test_database(h)
+                # test new hash alone against passwords already known. If no
+                # password matches, hash is kept pending in the main engine,
+                # to be tested against passwords received later
+                engine = mobius.core.turing.password_engine()
+                engine.set_hit_callback(self.__on_hit)
+                engine.add_hash(hash_id, h.type, h.value, username, iterations)
+                self.__test_passwords(ant, engine, list(self.__passwords))
 
-            if not p:
-                p = self.__test_passwords(h)
+                if engine.pending_count:
+                    self.__engine.add_hash(hash_id, h.type, h.value, username, iterations)
 
-        return p
+            self.__count += 1
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Test hash against turing database
@@ -108,36 +120,35 @@ class Ant(object):
         return p
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Test hash against collected passwords
+    # @brief Test pending hashes against passwords, using password engine
+    # @param ant Mediator ant object
+    # @param engine Password engine
+    # @param passwords Password list
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __test_passwords(self, h):
-        passwords = set(self.__passwords)
-        attrs = dict(h.metadata)
-
-        for password in passwords:
-            value = ''
-
-            if h.type == 'nt':
-                value = mobius.core.os.win.hash_nt(password)
-
-            elif h.type == 'lm':
-                value = mobius.core.os.win.hash_lm(password)
+    def __test_passwords(self, ant, engine, passwords):
+        if not passwords or not engine.pending_count:
+            return
 
-            elif h.type == 'msdcc1':
-                value = mobius.core.os.win.hash_msdcc1(password, attrs['username'])
+        self.__hits = []
+        engine.test(passwords)
+        hits, self.__hits = self.__hits, []
 
-            elif h.type == 'msdcc2':
-                value = mobius.core.os.win.hash_msdcc2(password, attrs['username'], int(attrs['iterations']))
-
-            elif h.type == 'sha1.utf16':
-                value = mobius.core.crypt.hash_digest('sha1', password.encode('utf-16-le'))
+        for idx, password in hits:
+            h = self.__hashes[idx]
+            self.__password_count += 1
 
-            if h.value == mobius.core.encoder.hexstring(value):
-                self.__password_count += 1
-                p = self.__create_password(h, password)
-                return p
+            p = self.__create_password(h, password)
+            if p:
+                ant.add_password(p)
 
-        return None
+    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    # @brief Password engine hit callback
+    # @param hash_id Hash ID
+    # @param hash_type Hash type
+    # @param password Password found
+    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    def __on_hit(self, hash_id, hash_type, password):
+        self.__hits.append((int(hash_id), password))
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Create password object
@@ -162,14 +173,11 @@ class Ant(object):
         return p
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Event <i>on_test_password</i>: Test password
+    # @brief Event <i>on_test_passwords</i>: Test passwords
     # @param ant Mediator ant object
-    # @param h Hash object
+    # @param passwords Password list
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def on_test_password(self, ant, password):
-        self.__passwords.add(password)
-
-        hashes = list(self.__hashes)
-
-        for h in hashes:
-            self.__test_hash(h)
+    def on_test_passwords(self, ant, passwords):
+        passwords = [p for p in passwords if isinstance(p, str)]
+        self.__passwords.update(passwords)
+        self.__test_passwords(ant, self.__engine, passwords)
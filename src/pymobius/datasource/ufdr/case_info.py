@@ -51,15 +51,7 @@ class UFDRCaseInfo(object):
 
         self.__datasource.set_case_info(ufdr_parser.get_case_info())
 
-        for e in ufdr_parser.get_extractions():
-            extraction = mobius.core.datasource.ufdr.extraction(e.id)
-            extraction.type = e.extraction_type
-            extraction.name = e.name
-            extraction.device_name = e.device_name
-
-            for name, value in e.metadata:
-                extraction.add_metadata(name, value)
-
+        for extraction in ufdr_parser.get_extractions():
             self.__datasource.add_extraction(extraction)
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -15,13 +15,10 @@
 # You should have received a copy of the GNU General Public License
 # along with this program. If not, see <http://www.gnu.org/licenses/>.
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-import datetime
-import traceback
-import xml.dom.pulldom
-import zipfile
-
 import mobius
+import mobius.core.datasource
 import pymobius
+import traceback
 
 
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -117,34 +114,6 @@ import pymobius
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 
 
-# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-# @brief Get node datetime
-# =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-def get_datetime_from_node(value):
-    value = (value or '').strip()
-
-    if value in ('N/A', ''):
-        value = None
-
-    elif len(value) >= 19:
-        date_part = value[:19]
-        tz_part = value[23:]    # skip milliseconds
-
-        try:
-            value = datetime.datetime.strptime(date_part, '%Y-%m-%dT%H:%M:%S')
-
-            if len(tz_part) >= 6 and tz_part != '+00:00':
-                seconds = int(tz_part[1:3]) * 3600 + int(tz_part[4:6]) * 60
-                if tz_part[0] == '+':
-                    seconds = -seconds
-                value += datetime.timedelta(seconds=seconds)
-
-        except ValueError as e:
-            mobius.core.logf(f"WRN {str(e)}\nValue:<{value}>\n{traceback.format_exc()}")
-
-    return value
-
-
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 # @brief Sink in function, to be the default handler
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -155,6 +124,9 @@ def default_handler(*args):
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 # @brief UFDR file parser class
 # @author Eduardo Aguiar
+#
+# report.xml is parsed by mobius.core.datasource.ufdr.report_parser, which
+# streams the zip entry and calls back for each tagged file and model.
 # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 class UFDRParser(object):
 
@@ -165,14 +137,12 @@ class UFDRParser(object):
         self.__path = path
         self.__case_info = mobius.core.pod.map()
         self.__extractions = []
-        self.__evidence_idx = 0
-        self.__evidence_count = 0
         self.__unknown_datatypes = set()
         self.__on_tagged_file_handler = getattr(control, 'on_tagged_file', None)
         self.__on_evidence_handler = getattr(control, 'on_evidence', None)
         self.__on_document_end_handler = getattr(control, 'on_document_end', default_handler)
-        self.__on_element_start_handler = getattr(control, 'on_element_start', default_handler)
-        self.__on_element_end_handler = getattr(control, 'on_element_end', default_handler)
+        self.__on_element_start_handler = getattr(control, 'on_element_start', None)
+        self.__on_element_end_handler = getattr(control, 'on_element_end', None)
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     # @brief Get case info
@@ -193,425 +163,100 @@ class UFDRParser(object):
         return self.__unknown_datatypes
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Run agent
+    # @brief Run parser
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     def run(self):
-        zfile = zipfile.ZipFile(self.__path)
-        fp = zfile.open("report.xml", force_zip64=True)
-        doc = xml.dom.pulldom.parse(fp)
-        last_fullname = ''
-
-        # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        # Process pulldom events
-        # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        for event, node in doc:
-
-            # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-            # start element
-            # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-            if event == xml.dom.pulldom.START_ELEMENT:
-
-                # update fullname
-                if last_fullname:
-                    fullname = f"{last_fullname}.{node.tagName}"
-                else:
-                    fullname = node.tagName
+        f = mobius.core.io.new_file_by_path(self.__path)
+        parser = mobius.core.datasource.ufdr.report_parser(f.new_reader())
 
-                # handle relevant nodes
-                if fullname == 'project.caseInformation':
-                    self.__on_case_information(doc, node)
+        if self.__on_element_start_handler:
+            parser.set_element_start_handler(self.__on_element_start_handler)
 
-                elif fullname == 'project.sourceExtractions':
-                    self.__on_source_extractions(doc, node)
+        if self.__on_element_end_handler:
+            parser.set_element_end_handler(self.__on_element_end_handler)
 
-                elif fullname == 'project.metadata' and node.getAttribute('section') == 'Extraction Data':
-                    self.__on_extraction_data(doc, node)
+        if self.__on_tagged_file_handler:
+            parser.set_tagged_file_handler(self.__on_tagged_file)
 
-                elif fullname == 'project.metadata' and node.getAttribute('section') == 'Device Info':
-                    self.__on_device_info(doc, node)
+        if self.__on_evidence_handler:
+            parser.set_model_handler(self.__on_evidence)
 
-                elif self.__on_tagged_file_handler and fullname == 'project.taggedFiles.file':
-                    if self.__on_tagged_file(doc, node):
-                        break
+        parser.run()
 
-                elif self.__on_evidence_handler and fullname == 'project.decodedData.modelType.model':
-                    self.__on_evidence(doc, node)
-
-                else:
-                    if fullname == 'project':
-                        self.__on_project(node)
-
-                    elif self.__on_element_start_handler(fullname):
-                        break
-
-                    last_fullname = fullname
-
-            # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-            # end element
-            # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-            elif event == xml.dom.pulldom.END_ELEMENT:
-                if self.__on_element_end_handler(last_fullname):
-                    break
-                last_fullname = last_fullname.rsplit('.', 1)[0]
-
-        fp.close()
-        zfile.close()
+        self.__case_info = parser.get_case_info()
+        self.__extractions = parser.get_extractions()
+        self.__unknown_datatypes = parser.get_unknown_datatypes()
 
         self.__on_document_end_handler()
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Handle __on_project node
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __on_project(self, node):
-        try:
-            self.__evidence_count = int(node.getAttribute('ModelCount') or '0')
-
-        except Exception as e:
-            mobius.core.logf(f"WRN {str(e)}\n{traceback.format_exc()}")
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Handle __on_case_information node
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __on_case_information(self, doc, node):
-        try:
-            doc.expandNode(node)
-
-            for child in node.getElementsByTagName('field'):
-                varname = child.getAttribute('fieldType')
-                content = child.firstChild.nodeValue.strip()
-                self.__case_info.set(varname, content)
-
-        except Exception as e:
-            mobius.core.logf(f"WRN {str(e)}\n{traceback.format_exc()}")
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Handle <sourceExtractions> node
+    # @brief Handle tagged file
+    # @param data Tagged file data
+    # @return True to stop parsing
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __on_source_extractions(self, doc, node):
+    def __on_tagged_file(self, data):
         try:
-            doc.expandNode(node)
+            f = pymobius.Data()
 
-            for child in node.getElementsByTagName('extractionInfo'):
-                obj = pymobius.Data()
-                obj.id = int(child.getAttribute('id') or '-1')
-                obj.name = child.getAttribute('name')
-                obj.device_name = child.getAttribute('fullName')
-                obj.extraction_type = child.getAttribute('type')
-                obj.metadata = []
+            for name, value in data.items():
+                setattr(f, name, value)
 
-                self.__extractions.append(obj)
+            return self.__on_tagged_file_handler(f)
 
         except Exception as e:
             mobius.core.logf(f"WRN {str(e)}\n{traceback.format_exc()}")
 
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Handle <metadata section="Extraction Data"> node
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __on_extraction_data(self, doc, node):
-        try:
-            doc.expandNode(node)
-
-            for child in node.getElementsByTagName('item'):
-                source_extraction = child.getAttribute('sourceExtraction')
-
-                if source_extraction:
-                    source = int(source_extraction)
-                    name = child.getAttribute('name')
-                    value = child.firstChild.nodeValue.strip()
-                    self.__extractions[source].metadata.append((name, value))
-
-        except Exception as e:
-            mobius.core.logf(f"WRN {str(e)}\n{traceback.format_exc()}")
+        return False
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Handle __on_device_info node
+    # @brief Handle model
+    # @param data Model data
+    # @return True to stop parsing
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __on_device_info(self, doc, node):
+    def __on_evidence(self, data):
         try:
-            doc.expandNode(node)
-
-            for child in node.getElementsByTagName('item'):
-                source = int(child.getAttribute('sourceExtraction'))
-                name = child.getAttribute('name')
-                value = child.firstChild.nodeValue.strip()
-                self.__extractions[source].metadata.append((name, value))
+            self.__on_evidence_handler(self.__get_model(data))
 
         except Exception as e:
             mobius.core.logf(f"WRN {str(e)}\n{traceback.format_exc()}")
 
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Handle __on_tagged_file
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __on_tagged_file(self, doc, node):
-        try:
-            doc.expandNode(node)
-
-            f = pymobius.Data()
-            f.id = node.getAttribute("id")
-            f.size = int(node.getAttribute("size") or '-1')
-            f.path = node.getAttribute("path")
-            f.fs_id = node.getAttribute("fsid")
-            f.fs = node.getAttribute("fs")
-            f.extraction_id = int(node.getAttribute('extractionId') or '-1')
-            f.deleted = node.getAttribute("deleted")
-            f.embedded = node.getAttribute("embedded")
-            f.is_related = node.getAttribute("isrelated")
-            f.decoded_by = node.getAttribute("decodedBy")
-            f.decoded_app = node.getAttribute("decodedApplication")
-            f.source_index = int(node.getAttribute("source_index") or '-1')
-            f.access_info = {}
-            f.metadata = {}
-            f.file_metadata = {}
-
-            # children
-            for child in node.childNodes:
-
-                # accessInfo
-                if child.nodeType == child.ELEMENT_NODE and child.tagName == 'accessInfo':
-                    for ts_node in child.getElementsByTagName('timestamp'):
-                        name = ts_node.getAttribute("name")
-                        timestamp = get_datetime_from_node(ts_node.firstChild.nodeValue)
-                        f.access_info[name] = timestamp
-
-                # metadata
-                elif child.nodeType == child.ELEMENT_NODE and child.tagName == 'metadata':
-                    section = child.getAttribute("section")
-
-                    for i_node in child.getElementsByTagName('item'):
-                        name = i_node.getAttribute("name")
-                        value = None
-
-                        if i_node.firstChild:
-                            value = (i_node.firstChild.nodeValue or '').strip()
-
-                        if section == 'File':
-                            f.file_metadata[name] = value
-
-                        elif section == 'MetaData':
-                            f.metadata[name] = value
-
-                        else:
-                            mobius.core.logf(f"DEV unhandled file metadata section: {section}")
-
-            return self.__on_tagged_file_handler(f)
-
-        except Exception as e:
-            mobius.core.logf(f"WRN {str(e)}\n{traceback.format_exc()}")
+        return False
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Handle __on_evidence
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __on_evidence(self, doc, node):
-        try:
-            doc.expandNode(node)
-
-            e = self.__get_model(node)
-            e.evidence_count = self.__evidence_count
-            self.__on_evidence_handler(e)
-
-        except Exception as e:
-            mobius.core.logf(f"WRN {str(e)}\n{traceback.format_exc()}")
-
+    # @brief Get model object from model data
+    # @param data Model data
+    # @return Model object
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get model from XML node
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_model(self, node):
+    def __get_model(self, data):
         m = pymobius.Data()
 
-        # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        # Attributes
-        # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        for name, value in node.attributes.items():
+        for name, value in data.items():
             setattr(m, name, value)
 
-        m.extraction_id = int(node.getAttribute('extractionId'))
-        m.is_carved = node.getAttribute("iscarved") == "True"
-        m.is_related = node.getAttribute("isrelated") == "True"
-        m.metadata = []
-        m.jump_targets = []
-
-        # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        # Children nodes
-        # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-        for child in node.childNodes:
-            if child.nodeType == child.ELEMENT_NODE:
-                name = child.getAttribute('name')
-
-                if child.tagName == 'field':
-                    value = self.__get_field_value(child)
-                    m.metadata.append((name, value))
-
-                elif child.tagName == 'multiField':
-                    value = self.__get_multifield_value(child)
-                    m.metadata.append((name, value))
-
-                elif child.tagName == 'modelField':
-                    value = self.__get_modelfield_value(child)
-                    m.metadata.append((name, value))
-
-                elif child.tagName == 'multiModelField':
-                    value = self.__get_multimodelfield_value(child)
-                    m.metadata.append((name, value))
-
-                elif child.tagName == 'dataField':
-                    value = self.__get_datafield_value(child)
-                    m.metadata.append((name, value))
-
-                elif child.tagName == 'nodeField':
-                    value = self.__get_nodefield_value(child)
-                    m.metadata.append((name, value))
-
-                elif child.tagName == 'jumptargets':
-                    value = self.__get_jumptargets(child)
-                    m.jump_targets += value
-
-                else:
-                    value = self.__get_related_models(child)
-                    m.metadata.append((name, value))
-
-        # RelatedModels
+        m.metadata = [(name, self.__get_value(value)) for name, value in data.get('metadata', [])]
+        m.jump_targets = [self.__get_value(target) for target in data.get('jump_targets', [])]
 
         return m
 
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get value
+    # @brief Convert field value, turning dicts into objects
+    # @param value Field value
+    # @return Converted value
     # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_value(self, value_type, value):
-
-        try:
-            if value_type == 'Boolean':
-                value = (value == 'True')
-
-            elif value_type in ('UInt32', 'Int32', 'Uint64', 'Int64'):
-                value = int(value)
-
-            elif value_type == 'Double':
-                value = float(value.replace(',', '.'))
-
-            elif value_type == 'TimeStamp':
-                value = get_datetime_from_node(value)
+    def __get_value(self, value):
 
-            elif value_type != 'String':
-                self.__unknown_datatypes.add(value_type)
+        if isinstance(value, list):
+            return [self.__get_value(v) for v in value]
 
-        except Exception as e:
-            mobius.core.logf(f"WRN {str(e)}\n{traceback.format_exc()}")
-            value = None
+        elif isinstance(value, dict) and 'metadata' in value:
+            return self.__get_model(value)
 
-        return value
+        elif isinstance(value, dict):
+            obj = pymobius.Data()
 
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get field value
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_field_value(self, node):
-        value = None
+            for name, v in value.items():
+                setattr(obj, name, v)
 
-        for child in node.childNodes:
-            if child.nodeType == child.ELEMENT_NODE and child.tagName == 'value':
-                value_type = child.getAttribute("type")
-                value = self.__get_value(value_type, child.firstChild.nodeValue.strip())
+            return obj
 
         return value
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get multifield value
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_multifield_value(self, node):
-        values = []
-
-        for child in node.childNodes:
-            if child.nodeType == child.ELEMENT_NODE and child.tagName == 'value':
-                value_type = child.getAttribute("type")
-
-                if child.firstChild:
-                    value = self.__get_value(value_type, child.firstChild.nodeValue.strip())
-                else:
-                    value = None
-
-                values.append(value)
-
-        return values
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get modelField value
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_modelfield_value(self, node):
-        value = None
-
-        for child in node.childNodes:
-            if child.nodeType == child.ELEMENT_NODE and child.tagName == 'model':
-                value = self.__get_model(child)
-
-        return value
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get multimodelfield value
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_multimodelfield_value(self, node):
-        values = []
-
-        for child in node.childNodes:
-            if child.nodeType == child.ELEMENT_NODE and child.tagName == 'model':
-                model = self.__get_model(child)
-                values.append(model)
-
-        return values
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get dataField value
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_datafield_value(self, node):
-        value = None
-        field_type = node.getAttribute('type')
-
-        if field_type == 'MemoryRange':
-            for child in node.getElementsByTagName('source'):
-                value = pymobius.Data()
-                value.length = int(child.getAttribute('length') or '-1')
-
-        else:
-            mobius.core.logf(f"DEV unhandled datafield type: {field_type}")
-
-        return value
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get nodeField value
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_nodefield_value(self, node):
-        value = None
-
-        for child in node.childNodes:
-            if child.nodeType == child.ELEMENT_NODE and child.tagName == 'id':
-                value = pymobius.Data()
-                value.name = child.getAttribute("name")
-                value.id = child.firstChild.nodeValue.strip()
-
-        return value
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get jump targets from node
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_jumptargets(self, node):
-        targets = []
-
-        for child in node.childNodes:
-            if child.nodeType == child.ELEMENT_NODE and child.tagName == 'targetid':
-                target = pymobius.Data()
-                target.is_model = child.getAttribute("ismodel") == 'true'
-                target.id = child.firstChild.nodeValue.strip()
-
-                targets.append(target)
-
-        return targets
-
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    # @brief Get related models
-    # =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    def __get_related_models(self, node):
-        values = []
-
-        for child in node.childNodes:
-            if child.nodeType == child.ELEMENT_NODE and child.tagName == 'model':
-                values.append(self.__get_model(child))
-
-        return values
@@ -72,19 +72,15 @@ class file_wrapper(object):
             return
 
         # calculate hash sha2-512
-        h = mobius.core.crypt.hash('sha2-512')
-        data = reader.read(65536)
-
-        while data:
-            h.update(data)
-            data = reader.read(65536)
+        h = mobius.core.crypt.multi_hash(['sha2-512'])
+        h.update(reader)
 
         # add to kff file
         case = self.__item.case
         path = case.create_path(os.path.join('hashset', f'{self.__item.uid:04d}-handled.ignore'))
 
         fp = open(path, 'a')
-        fp.write('%s\n' % h.get_hex_digest())
+        fp.write('%s\n' % h.get_digest('sha2-512').hex())
         fp.close()
 
 
@@ -0,0 +1,260 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <iostream>
+#include <mobius/core/application.hpp>
+#include <mobius/core/io/file.hpp>
+#include <mobius/core/string_functions.hpp>
+#include <mobius/core/thread_pool.hpp>
+#include <mobius/core/vfs/carver.hpp>
+#include <mobius/core/vfs/vfs.hpp>
+#include <cstdint>
+#include <iomanip>
+#include <unistd.h>
+
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Read block size
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint64_t BLOCK_SIZE = 65536;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Max header alignment in bytes
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint64_t MAX_ALIGNMENT = 67108864;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Max number of scanning threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint64_t MAX_JOBS = 1024;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Parse numeric option argument
+//! \param arg Option argument
+//! \param max_value Max value accepted
+//! \param value Parsed value
+//! \return true if arg is a number up to max_value, false otherwise
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+bool
+parse_number (const std::string &arg, std::uint64_t max_value,
+              std::uint64_t &value)
+{
+    if (!mobius::core::string::is_digit (arg) || arg.size () > 10)
+        return false;
+
+    value = std::stoull (arg);
+    return value <= max_value;
+}
+
+} // namespace
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Show usage text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+usage ()
+{
+    std::cerr << std::endl;
+    std::cerr << "use: carvefs [OPTIONS] <URL>" << std::endl;
+    std::cerr << "e.g: carvefs file://disk.raw" << std::endl;
+    std::cerr << "     carvefs -u -j 0 -o carved file://disk.ewf" << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "options are:" << std::endl;
+    std::cerr << "  -a header alignment in bytes (default: 512, max. 64 MiB)"
+              << std::endl;
+    std::cerr << "  -j number of scanning threads (0 = all cores, max. 1024)"
+              << std::endl;
+    std::cerr << "  -o output folder for carved files" << std::endl;
+    std::cerr << "  -u carve unallocated space (freespace blocks) only"
+              << std::endl;
+    std::cerr << std::endl;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Save carved candidate to output folder
+//! \param c Candidate
+//! \param path Output folder path
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+save_candidate (const mobius::core::vfs::carver::candidate &c,
+                const std::string &path)
+{
+    auto f = mobius::core::io::new_file_by_path (
+        path + '/' + std::to_string (c.offset) + '.' + c.extension);
+
+    auto reader = c.reader;
+    auto writer = f.new_writer ();
+    auto data = reader.read (BLOCK_SIZE);
+
+    while (data)
+    {
+        writer.write (data);
+        data = reader.read (BLOCK_SIZE);
+    }
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Main function
+//! \param argc Argument count
+//! \param argv Argument values
+//! \return Exit code
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main (int argc, char **argv)
+{
+    mobius::core::application app;
+    app.start ();
+
+    std::cerr << app.get_name () << " v" << app.get_version () << std::endl;
+    std::cerr << app.get_copyright () << std::endl;
+    std::cerr << "CarveFS v1.0" << std::endl;
+    std::cerr << "by Eduardo Aguiar" << std::endl;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // parse command line
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    int opt;
+    std::uint64_t alignment = 512;
+    unsigned int jobs = 1;
+    std::string output_path;
+    bool unallocated_only = false;
+
+    while ((opt = getopt (argc, argv, "a:hj:o:u")) != EOF)
+    {
+        switch (opt)
+        {
+        case 'a':
+            if (!parse_number (optarg, MAX_ALIGNMENT, alignment) ||
+                alignment == 0)
+            {
+                std::cerr << std::endl;
+                std::cerr << "Error: Invalid alignment: " << optarg
+                          << std::endl;
+                usage ();
+                exit (EXIT_FAILURE);
+            }
+            break;
+
+        case 'h':
+            usage ();
+            exit (EXIT_SUCCESS);
+            break;
+
+        case 'j':
+        {
+            std::uint64_t value = 0;
+
+            if (!parse_number (optarg, MAX_JOBS, value))
+            {
+                std::cerr << std::endl;
+                std::cerr << "Error: Invalid number of jobs: " << optarg
+                          << std::endl;
+                usage ();
+                exit (EXIT_FAILURE);
+            }
+
+            jobs = value;
+
+            if (jobs == 0)
+                jobs = mobius::core::get_hardware_threads ();
+        }
+        break;
+
+        case 'o':
+            output_path = optarg;
+            break;
+
+        case 'u':
+            unallocated_only = true;
+            break;
+
+        default:
+            usage ();
+            exit (EXIT_FAILURE);
+        }
+    }
+
+    if (optind >= argc)
+    {
+        std::cerr << std::endl;
+        std::cerr << "Error: You must enter a valid URL to an imagefile"
+                  << std::endl;
+        usage ();
+        exit (EXIT_FAILURE);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // Create VFS and check if it is available
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    mobius::core::vfs::vfs vfs;
+    vfs.add_disk (mobius::core::vfs::new_disk_by_url (argv[optind]));
+
+    if (!vfs.is_available ())
+    {
+        std::cerr << std::endl;
+        std::cerr << "Error: Image file is not available" << std::endl;
+        usage ();
+        exit (EXIT_FAILURE);
+    }
+
+    if (!output_path.empty ())
+    {
+        auto folder = mobius::core::io::new_folder_by_path (output_path);
+        folder.create ();
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // carve root blocks
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    mobius::core::vfs::carver carver (jobs);
+    carver.set_alignment (alignment);
+
+    carver.set_candidate_callback (
+        [&output_path] (const mobius::core::vfs::carver::candidate &c)
+        {
+            std::cout << c.offset << '\t' << c.size << '\t' << c.type << '\t'
+                      << (c.has_footer ? "footer" : "truncated") << std::endl;
+
+            if (!output_path.empty ())
+                save_candidate (c, output_path);
+        });
+
+    for (const auto &block : vfs.get_blocks ())
+    {
+        if (!block.get_parents ().empty ())
+            continue;
+
+        carver.carve (block, unallocated_only);
+
+        std::cerr << std::endl;
+        std::cerr << "Block " << block.get_uid () << ": "
+                  << carver.get_candidate_count () << " candidate(s)"
+                  << std::endl;
+        std::cerr << "  Threads: " << carver.get_threads () << std::endl;
+        std::cerr << "  Bytes scanned: " << carver.get_bytes_scanned ()
+                  << std::endl;
+        std::cerr << "  Elapsed time: " << std::fixed << std::setprecision (3)
+                  << carver.get_elapsed_time () << " s" << std::endl;
+        std::cerr << "  Throughput: " << std::fixed << std::setprecision (1)
+                  << carver.get_bytes_per_second () / (1024 * 1024)
+                  << " MiB/s" << std::endl;
+    }
+
+    app.stop ();
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,212 @@
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+// Mobius Forensic Toolkit
+// Copyright (C) 2008-2026 Eduardo Aguiar
+//
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the
+// Free Software Foundation; either version 2, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but
+// WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General
+// Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program. If not, see <http://www.gnu.org/licenses/>.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mobius/core/application.hpp>
+#include <mobius/core/bytearray.hpp>
+#include <mobius/core/crypt/crc32.hpp>
+#include <mobius/core/crypt/hash.hpp>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Show usage text
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+void
+usage ()
+{
+    std::cerr << std::endl;
+    std::cerr << "use: hash_bench [OPTIONS] [hash type...]" << std::endl;
+    std::cerr << "e.g: hash_bench adler32 crc32 md5" << std::endl;
+    std::cerr << "     hash_bench -s 256 -r 4" << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "options are:" << std::endl;
+    std::cerr << "  -b block size in KiB (default: 64)" << std::endl;
+    std::cerr << "  -r rounds (default: 8)" << std::endl;
+    std::cerr << "  -s data size in MiB (default: 64)" << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "hash type 'crc32.kernel' measures mobius::core::crypt::crc32 "
+                 "function directly"
+              << std::endl;
+    std::cerr << std::endl;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Run benchmark for a hash type
+//! \param hash_type Hash type
+//! \param blocks Data blocks
+//! \param rounds Number of rounds
+//! \return Throughput in GB/s
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+double
+run_benchmark (const std::string &hash_type,
+               const std::vector<mobius::core::bytearray> &blocks, int rounds)
+{
+    std::uint64_t size = 0;
+    const auto start = std::chrono::steady_clock::now ();
+
+    for (int i = 0; i < rounds; i++)
+    {
+        if (hash_type == "crc32.kernel")
+        {
+            std::uint32_t value = 0xffffffff;
+
+            for (const auto &block : blocks)
+            {
+                value = mobius::core::crypt::crc32 (value, block);
+                size += block.size ();
+            }
+        }
+
+        else
+        {
+            mobius::core::crypt::hash h (hash_type);
+
+            for (const auto &block : blocks)
+            {
+                h.update (block);
+                size += block.size ();
+            }
+
+            h.get_digest ();
+        }
+    }
+
+    const std::chrono::duration<double> elapsed =
+        std::chrono::steady_clock::now () - start;
+
+    return elapsed.count () > 0 ? size / elapsed.count () / 1e9 : 0.0;
+}
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief main function
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+int
+main (int argc, char **argv)
+{
+    mobius::core::application app;
+    app.start ();
+
+    std::cerr << app.get_name () << " v" << app.get_version () << std::endl;
+    std::cerr << app.get_copyright () << std::endl;
+    std::cerr << "HashBench v1.0" << std::endl;
+    std::cerr << "by Eduardo Aguiar" << std::endl;
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // parse command line
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    int opt;
+    std::uint64_t block_size = 64;
+    std::uint64_t data_size = 64;
+    int rounds = 8;
+
+    while ((opt = getopt (argc, argv, "b:hr:s:")) != EOF)
+    {
+        switch (opt)
+        {
+        case 'b':
+            block_size = std::strtoull (optarg, nullptr, 10);
+            break;
+
+        case 'h':
+            usage ();
+            exit (EXIT_SUCCESS);
+            break;
+
+        case 'r':
+            rounds = std::atoi (optarg);
+            break;
+
+        case 's':
+            data_size = std::strtoull (optarg, nullptr, 10);
+            break;
+
+        default:
+            usage ();
+            exit (EXIT_FAILURE);
+        }
+    }
+
+    if (block_size == 0 || data_size == 0 || rounds <= 0)
+    {
+        std::cerr << std::endl;
+        std::cerr << "Error: Invalid block size, data size or rounds"
+                  << std::endl;
+        usage ();
+        exit (EXIT_FAILURE);
+    }
+
+    std::vector<std::string> hash_types;
+
+    for (int i = optind; i < argc; i++)
+        hash_types.push_back (argv[i]);
+
+    if (hash_types.empty ())
+        hash_types = {"adler32", "crc32", "crc32.kernel", "md5", "sha1",
+                      "sha2-256"};
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // create pseudo-random data blocks
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    const std::uint64_t block_bytes = block_size * 1024;
+    const std::uint64_t block_count =
+        std::max<std::uint64_t> (1, data_size * 1024 * 1024 / block_bytes);
+
+    std::vector<mobius::core::bytearray> blocks;
+    std::uint32_t seed = 0x12345678;
+
+    for (std::uint64_t i = 0; i < block_count; i++)
+    {
+        mobius::core::bytearray block (block_bytes);
+
+        for (auto &b : block)
+        {
+            seed = seed * 1103515245 + 12345;
+            b = std::uint8_t (seed >> 16);
+        }
+
+        blocks.push_back (block);
+    }
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // run benchmarks
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::cout << std::fixed << std::setprecision (2);
+
+    for (const auto &hash_type : hash_types)
+    {
+        try
+        {
+            const double gbps = run_benchmark (hash_type, blocks, rounds);
+            std::cout << std::setw (16) << std::left << hash_type << gbps
+                      << " GB/s" << std::endl;
+        }
+        catch (const std::exception &e)
+        {
+            std::cerr << "Warning: " << hash_type << ": " << e.what ()
+                      << std::endl;
+        }
+    }
+
+    app.stop ();
+    return EXIT_SUCCESS;
+}
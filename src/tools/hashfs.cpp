@@ -17,15 +17,85 @@
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 #include <iostream>
 #include <mobius/core/application.hpp>
+#include <mobius/core/benchmark.hpp>
 #include <mobius/core/crypt/hash.hpp>
+#include <mobius/core/crypt/multi_hash.hpp>
 #include <mobius/core/io/file.hpp>
+#include <mobius/core/string_functions.hpp>
+#include <mobius/core/thread_pool.hpp>
 #include <mobius/core/vfs/vfs.hpp>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <unistd.h>
 
-void process_file (const mobius::core::io::file &, const std::string &,
-                   const std::string &);
-void process_folder (const mobius::core::io::folder &, const std::string &,
-                     const std::string &);
+namespace
+{
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Read block size
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr std::uint64_t BLOCK_SIZE = 65536;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Max number of worker threads
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+constexpr unsigned int MAX_JOBS = 1024;
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief File to be hashed
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+struct file_item
+{
+    mobius::core::io::file f;
+    std::string path;
+};
+
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+//! \brief Write output lines in file enumeration order
+//
+// Lines can be set in any order, by any thread. Each line is written as soon
+// as every line before it has been set.
+// =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+class ordered_writer
+{
+  public:
+    explicit ordered_writer (std::size_t count)
+        : lines_ (count),
+          done_ (count, false)
+    {
+    }
+
+    void
+    set_line (std::size_t idx, std::string line)
+    {
+        std::lock_guard<std::mutex> lock (mutex_);
+
+        lines_[idx] = std::move (line);
+        done_[idx] = true;
+
+        while (next_ < done_.size () && done_[next_])
+        {
+            if (!lines_[next_].empty ())
+                std::cout << lines_[next_] << '\n';
+
+            lines_[next_] = std::string ();
+            next_++;
+        }
+
+        std::cout.flush ();
+    }
+
+  private:
+    std::vector<std::string> lines_;
+    std::vector<bool> done_;
+    std::size_t next_ = 0;
+    std::mutex mutex_;
+};
+
+} // namespace
+
+void collect_folder (const mobius::core::io::folder &,
+                     std::vector<file_item> &, const std::string &);
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 //! \brief Show usage text
@@ -36,32 +106,42 @@ usage ()
     std::cerr << std::endl;
     std::cerr << "use: hashfs [OPTIONS] <URL>" << std::endl;
     std::cerr << "e.g: hashfs -t md5 file://disk.raw" << std::endl;
-    std::cerr << "     hashfs file://disk.ewf" << std::endl;
+    std::cerr << "     hashfs -t md5,sha1,sha2-256 file://disk.raw" << std::endl;
+    std::cerr << "     hashfs -j 0 file://disk.ewf" << std::endl;
     std::cerr << std::endl;
     std::cerr << "options are:" << std::endl;
-    std::cerr << "  -t hash type\t\t" << std::endl;
+    std::cerr << "  -t hash type(s), comma separated (default: md5)" << std::endl;
+    std::cerr << "  -j number of files hashed in parallel (0 = all cores, "
+                 "max. 1024)"
+              << std::endl;
+    std::cerr << std::endl;
+    std::cerr << "Option -t can be given more than once. All hashes are"
+              << std::endl;
+    std::cerr << "calculated in a single pass over each file." << std::endl;
     std::cerr << std::endl;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Process entry
+//! \brief Collect files from entry
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-process_entry (const mobius::core::io::entry &entry,
-               const std::string &hash_type, const std::string &path = "")
+collect_entry (const mobius::core::io::entry &entry,
+               std::vector<file_item> &items, const std::string &path = "")
 {
     try
     {
         if (entry.is_file ())
         {
             auto fchild = entry.get_file ();
-            process_file (fchild, hash_type, path + '/' + fchild.get_name ());
+
+            if (!fchild.is_reallocated ())
+                items.push_back ({fchild, path + '/' + fchild.get_name ()});
         }
 
         else
         {
             auto fchild = entry.get_folder ();
-            process_folder (fchild, hash_type, path + '/' + fchild.get_name ());
+            collect_folder (fchild, items, path + '/' + fchild.get_name ());
         }
     }
     catch (const std::exception &e)
@@ -71,34 +151,19 @@ process_entry (const mobius::core::io::entry &entry,
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Process file
+//! \brief Collect files from folder
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
 void
-process_file (const mobius::core::io::file &f, const std::string &hash_type,
-              const std::string &path)
+collect_folder (const mobius::core::io::folder &folder,
+                std::vector<file_item> &items, const std::string &path = "")
 {
+    if (folder.is_reallocated ())
+        return;
+
     try
     {
-        if (f.is_reallocated ())
-            return;
-
-        auto reader = f.new_reader ();
-
-        if (!reader)
-            return;
-
-        mobius::core::crypt::hash h (hash_type);
-
-        constexpr int BLOCK_SIZE = 65536;
-        auto data = reader.read (BLOCK_SIZE);
-
-        while (data)
-        {
-            h.update (data);
-            data = reader.read (BLOCK_SIZE);
-        }
-
-        std::cout << h.get_hex_digest () << '\t' << path << std::endl;
+        for (const auto &entry : folder.get_children ())
+            collect_entry (entry, items, path);
     }
     catch (const std::exception &e)
     {
@@ -107,24 +172,84 @@ process_file (const mobius::core::io::file &f, const std::string &hash_type,
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-//! \brief Process folder
+//! \brief Hash file
+//! \param item File item
+//! \param hash_types Hash types
+//! \param in_pool Whether file is being hashed by a thread pool worker
+//! \param bytes Number of bytes read (updated)
+//! \return Output line or empty string, if file could not be hashed
+//
+// Zero-length files are not opened: their digests are the digests of an
+// empty input. When files are already being hashed in parallel, digests of
+// each file are calculated inline, to avoid oversubscribing the cores.
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-void
-process_folder (const mobius::core::io::folder &folder,
-                const std::string &hash_type, const std::string &path = "")
+std::string
+hash_file (const file_item &item, const std::vector<std::string> &hash_types,
+           bool in_pool, std::atomic<std::uint64_t> &bytes)
 {
-    if (folder.is_reallocated ())
-        return;
+    std::string line;
 
     try
     {
-        for (const auto &entry : folder.get_children ())
-            process_entry (entry, hash_type, path);
+        mobius::core::crypt::multi_hash::digest_list_type digests;
+
+        if (item.f.get_size () == 0 || !in_pool)
+        {
+            mobius::core::crypt::multi_hash h (hash_types);
+
+            if (item.f.get_size () > 0)
+            {
+                auto reader = item.f.new_reader ();
+
+                if (!reader)
+                    return {};
+
+                bytes += h.update (reader, BLOCK_SIZE);
+            }
+
+            digests = h.get_digests ();
+        }
+
+        else
+        {
+            auto reader = item.f.new_reader ();
+
+            if (!reader)
+                return {};
+
+            std::vector<mobius::core::crypt::hash> hashes;
+
+            for (const auto &type : hash_types)
+                hashes.emplace_back (type);
+
+            auto data = reader.read (BLOCK_SIZE);
+
+            while (data)
+            {
+                bytes += data.size ();
+
+                for (auto &h : hashes)
+                    h.update (data);
+
+                data = reader.read (BLOCK_SIZE);
+            }
+
+            for (std::size_t i = 0; i < hashes.size (); i++)
+                digests.emplace_back (hash_types[i], hashes[i].get_digest ());
+        }
+
+        for (const auto &[type, digest] : digests)
+            line += digest.to_hexstring () + '\t';
+
+        line += item.path;
     }
     catch (const std::exception &e)
     {
         std::cerr << "Warning: " << e.what () << std::endl;
+        line.clear ();
     }
+
+    return line;
 }
 
 // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
@@ -138,16 +263,17 @@ main (int argc, char **argv)
 
     std::cerr << app.get_name () << " v" << app.get_version () << std::endl;
     std::cerr << app.get_copyright () << std::endl;
-    std::cerr << "HashFS v1.3" << std::endl;
+    std::cerr << "HashFS v1.4" << std::endl;
     std::cerr << "by Eduardo Aguiar" << std::endl;
 
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     // parse command line
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
     int opt;
-    std::string hash_type = "md5";
+    std::vector<std::string> hash_types;
+    unsigned int jobs = 1;
 
-    while ((opt = getopt (argc, argv, "ht:")) != EOF)
+    while ((opt = getopt (argc, argv, "hj:t:")) != EOF)
     {
         switch (opt)
         {
@@ -156,8 +282,30 @@ main (int argc, char **argv)
             exit (EXIT_SUCCESS);
             break;
 
+        case 'j':
+            if (!mobius::core::string::is_digit (optarg) ||
+                std::string (optarg).size () > 4 ||
+                std::stoul (optarg) > MAX_JOBS)
+            {
+                std::cerr << std::endl;
+                std::cerr << "Error: Invalid number of jobs: " << optarg
+                          << std::endl;
+                usage ();
+                exit (EXIT_FAILURE);
+            }
+
+            jobs = std::stoul (optarg);
+
+            if (jobs == 0)
+                jobs = mobius::core::get_hardware_threads ();
+            break;
+
         case 't':
-            hash_type = optarg;
+            for (const auto &type : mobius::core::string::split (optarg, ","))
+            {
+                if (!type.empty ())
+                    hash_types.push_back (type);
+            }
             break;
 
         default:
@@ -166,6 +314,9 @@ main (int argc, char **argv)
         }
     }
 
+    if (hash_types.empty ())
+        hash_types.push_back ("md5");
+
     if (optind >= argc)
     {
         std::cerr << std::endl;
@@ -190,10 +341,44 @@ main (int argc, char **argv)
     }
 
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
-    // calculate hashes
+    // enumerate files
     // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::vector<file_item> items;
+
     for (const auto &entry : vfs.get_root_entries ())
-        process_entry (entry, hash_type);
+        collect_entry (entry, items);
+
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    // calculate hashes
+    // =-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
+    std::atomic<std::uint64_t> bytes = 0;
+    ordered_writer writer (items.size ());
+    mobius::core::benchmark benchmark (
+        "Hashing " + std::to_string (items.size ()) + " file(s)", "B",
+        std::cerr);
+
+    if (jobs > 1)
+    {
+        mobius::core::thread_pool pool (jobs);
+
+        for (std::size_t i = 0; i < items.size (); i++)
+        {
+            pool.submit ([&, i] {
+                writer.set_line (
+                    i, hash_file (items[i], hash_types, true, bytes));
+            });
+        }
+
+        pool.wait ();
+    }
+
+    else
+    {
+        for (std::size_t i = 0; i < items.size (); i++)
+            writer.set_line (i, hash_file (items[i], hash_types, false, bytes));
+    }
+
+    benchmark.end (bytes);
 
     app.stop ();
     return EXIT_SUCCESS;